@@ -0,0 +1,193 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// The example assets used by the benchmark (one of them is selected by the Makefile).
+// Each asset is a list of items (images or files) exported with the same parameters.
+
+// Includes
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _BENCHMARK_ASSETS_
+#define _BENCHMARK_ASSETS_
+
+// There is no program memory on the host
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#define BENCHMARK_MAX_ITEMS		25
+
+struct BenchmarkItem
+{
+	const DecompressionContext * dc;
+	const uint8_t * data;
+	uint32_t size; // Compressed data size in bytes (without the padding)
+};
+
+// Far memory chunks of AVR are joined into a single array on the host
+// (the size includes the padding of the data at the end of the last chunk)
+static inline const uint8_t * benchmarkJoinChunks(const uint8_t * const * chunks, const uint32_t * sizes, uint8_t count, uint32_t * size)
+{
+	*size = 0;
+	for (uint8_t i = 0; i < count; i++) *size += sizes[i];
+
+	uint8_t * data = (uint8_t *)malloc(*size);
+	uint32_t offset = 0;
+	for (uint8_t i = 0; i < count; i++)
+	{
+		memcpy(data + offset, chunks[i], sizes[i]);
+		offset += sizes[i];
+	}
+	return (data);
+}
+
+#define BENCHMARK_ITEM(dc, data)	{ &(dc), (data), sizeof(data) - DECOMPRESSION_DATA_PADDING }
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(BENCHMARK_ASSET_ASCII)
+
+// ASCII art text (ATtiny85 example)
+#include "../Examples/AVR/ATtiny85/ASCII.h"
+
+#define BENCHMARK_ASSET_NAME		"ascii"
+#define BENCHMARK_NUMBER_OF_FRAMES	ASCII_NUMBER_OF_FRAMES
+#define BENCHMARK_BITS_PER_FRAME	ASCII_BITS_PER_FRAME
+#define BENCHMARK_IMAGE_WIDTH		0
+#define BENCHMARK_SQUARE_SIDE		1
+
+static uint8_t benchmarkLoadItems(BenchmarkItem * items)
+{
+	const BenchmarkItem list[] = { BENCHMARK_ITEM(asciiDC, asciiData) };
+	memcpy(items, list, sizeof(list));
+	return (sizeof(list) / sizeof(list[0]));
+}
+
+#elif defined(BENCHMARK_ASSET_SLIDES)
+
+// Two 320x480 photos split into far memory chunks (Mega2560 examples)
+#include "../Examples/AVR/Arduino_boards/Mega2560_ILI9486/Slides.h"
+
+#define BENCHMARK_ASSET_NAME		"slides"
+#define BENCHMARK_NUMBER_OF_FRAMES	SLIDE_NUMBER_OF_FRAMES
+#define BENCHMARK_BITS_PER_FRAME	SLIDE_BITS_PER_FRAME
+#define BENCHMARK_IMAGE_WIDTH		SLIDE_IMAGE_WIDTH
+#define BENCHMARK_SQUARE_SIDE		SLIDE_SQUARE_SIDE
+
+static uint8_t benchmarkLoadItems(BenchmarkItem * items)
+{
+	const uint8_t * const slide1Chunks[] = { slide1Data1, slide1Data2, slide1Data3, slide1Data4, slide1Data5, slide1Data6 };
+	const uint32_t slide1Sizes[] = { sizeof(slide1Data1), sizeof(slide1Data2), sizeof(slide1Data3), sizeof(slide1Data4), sizeof(slide1Data5), sizeof(slide1Data6) };
+	const uint8_t * const slide2Chunks[] = { slide2Data1, slide2Data2, slide2Data3, slide2Data4, slide2Data5, slide2Data6, slide2Data7 };
+	const uint32_t slide2Sizes[] = { sizeof(slide2Data1), sizeof(slide2Data2), sizeof(slide2Data3), sizeof(slide2Data4), sizeof(slide2Data5), sizeof(slide2Data6), sizeof(slide2Data7) };
+
+	items[0].dc = &photoDC;
+	items[0].data = benchmarkJoinChunks(slide1Chunks, slide1Sizes, 6, &items[0].size);
+	items[1].dc = &photoDC;
+	items[1].data = benchmarkJoinChunks(slide2Chunks, slide2Sizes, 7, &items[1].size);
+	items[0].size -= DECOMPRESSION_DATA_PADDING;
+	items[1].size -= DECOMPRESSION_DATA_PADDING;
+	return (2);
+}
+
+#elif defined(BENCHMARK_ASSET_ICONS) || defined(BENCHMARK_ASSET_ICONS_SQUARES)
+
+// 25 icons 48x48 with 2 bits per pixel (Nano examples, ESP32/STM32 ones are split into squares)
+#if defined(BENCHMARK_ASSET_ICONS)
+#include "../Examples/AVR/Arduino_boards/Nano_ST7789/Icons.h"
+#define BENCHMARK_ASSET_NAME		"icons"
+#else
+#include "../Examples/ESP32/Wroom_ST7789/Icons.h"
+#define BENCHMARK_ASSET_NAME		"icons-squares"
+#endif
+
+#define BENCHMARK_NUMBER_OF_FRAMES	ICONS_NUMBER_OF_FRAMES
+#define BENCHMARK_BITS_PER_FRAME	ICONS_BITS_PER_FRAME
+#define BENCHMARK_IMAGE_WIDTH		ICONS_IMAGE_WIDTH
+#define BENCHMARK_SQUARE_SIDE		ICONS_SQUARE_SIDE
+
+static uint8_t benchmarkLoadItems(BenchmarkItem * items)
+{
+	const BenchmarkItem list[] = { BENCHMARK_ITEM(iconsDC, accessData), BENCHMARK_ITEM(iconsDC, bluetoothData), BENCHMARK_ITEM(iconsDC, bugData),
+		BENCHMARK_ITEM(iconsDC, buildData), BENCHMARK_ITEM(iconsDC, cableData), BENCHMARK_ITEM(iconsDC, checkData),
+		BENCHMARK_ITEM(iconsDC, cloudData), BENCHMARK_ITEM(iconsDC, editData), BENCHMARK_ITEM(iconsDC, emojiData),
+		BENCHMARK_ITEM(iconsDC, errorData), BENCHMARK_ITEM(iconsDC, handData), BENCHMARK_ITEM(iconsDC, lightbulbData),
+		BENCHMARK_ITEM(iconsDC, memoryData), BENCHMARK_ITEM(iconsDC, notificationsData), BENCHMARK_ITEM(iconsDC, personData),
+		BENCHMARK_ITEM(iconsDC, phoneData), BENCHMARK_ITEM(iconsDC, powerData), BENCHMARK_ITEM(iconsDC, sdData),
+		BENCHMARK_ITEM(iconsDC, smsData), BENCHMARK_ITEM(iconsDC, starData), BENCHMARK_ITEM(iconsDC, syncData),
+		BENCHMARK_ITEM(iconsDC, thermostatData), BENCHMARK_ITEM(iconsDC, thumbData), BENCHMARK_ITEM(iconsDC, warningData),
+		BENCHMARK_ITEM(iconsDC, wifiData) };
+	memcpy(items, list, sizeof(list));
+	return (sizeof(list) / sizeof(list[0]));
+}
+
+#elif defined(BENCHMARK_ASSET_LOGO)
+
+// 240x240 logo (ESP32 example, the STM32F070 one is the same)
+#include "../Examples/ESP32/Wroom_ST7789/Logo.h"
+
+#define BENCHMARK_ASSET_NAME		"logo"
+#define BENCHMARK_NUMBER_OF_FRAMES	LOGO_NUMBER_OF_FRAMES
+#define BENCHMARK_BITS_PER_FRAME	LOGO_BITS_PER_FRAME
+#define BENCHMARK_IMAGE_WIDTH		LOGO_IMAGE_WIDTH
+#define BENCHMARK_SQUARE_SIDE		LOGO_SQUARE_SIDE
+
+static uint8_t benchmarkLoadItems(BenchmarkItem * items)
+{
+	const BenchmarkItem list[] = { BENCHMARK_ITEM(logoDC, logoData) };
+	memcpy(items, list, sizeof(list));
+	return (sizeof(list) / sizeof(list[0]));
+}
+
+#elif defined(BENCHMARK_ASSET_STM_SLIDES)
+
+// Three 800x480 photos (STM32F407 example)
+#include "../Examples/STM32/F407ZGT6_NT35510_FSMC_DMA/Core/Inc/slide1.h"
+#include "../Examples/STM32/F407ZGT6_NT35510_FSMC_DMA/Core/Inc/slide2.h"
+#include "../Examples/STM32/F407ZGT6_NT35510_FSMC_DMA/Core/Inc/slide3.h"
+
+#define BENCHMARK_ASSET_NAME		"stm-slides"
+#define BENCHMARK_NUMBER_OF_FRAMES	SLIDE1_NUMBER_OF_FRAMES
+#define BENCHMARK_BITS_PER_FRAME	SLIDE1_BITS_PER_FRAME
+#define BENCHMARK_IMAGE_WIDTH		SLIDE1_IMAGE_WIDTH
+#define BENCHMARK_SQUARE_SIDE		SLIDE1_SQUARE_SIDE
+
+static uint8_t benchmarkLoadItems(BenchmarkItem * items)
+{
+	const BenchmarkItem list[] = { BENCHMARK_ITEM(slide1DC, slide1Data), BENCHMARK_ITEM(slide2DC, slide2Data), BENCHMARK_ITEM(slide3DC, slide3Data) };
+	memcpy(items, list, sizeof(list));
+	return (sizeof(list) / sizeof(list[0]));
+}
+
+#else
+#error "Select the benchmark asset (BENCHMARK_ASSET_...)"
+#endif
+
+#endif // end _BENCHMARK_ASSETS_
+
+// END-OF-FILE
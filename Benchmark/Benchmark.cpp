@@ -0,0 +1,300 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Host (Linux) benchmark of a single decompression variant on a single example asset.
+// Both are selected at compile time by the Makefile (see README.md).
+// The whole asset is decompressed into the buffer by the same portions as in the examples
+// (a row of squares or 4096 frames per call), and the best of the repetitions is reported
+// as one JSON line: throughput, time and CPU cycles per frame and the output checksum.
+
+// Includes
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// The forks (see the Makefile) are measured by the code of the variants they were copies of
+#if defined(BENCHMARK_VARIANT_FORK_FULL)
+#define BENCHMARK_VARIANT_FULL
+#define BENCHMARK_FORK
+#elif defined(BENCHMARK_VARIANT_FORK_FAST)
+#define BENCHMARK_VARIANT_FAST
+#define BENCHMARK_FORK
+#elif defined(BENCHMARK_VARIANT_FORK_PIXEL)
+#define BENCHMARK_VARIANT_PIXEL
+#define BENCHMARK_FORK
+#elif defined(BENCHMARK_VARIANT_FORK_STM)
+#define BENCHMARK_VARIANT_STM
+#define BENCHMARK_FORK
+#elif defined(BENCHMARK_VARIANT_FORK_TINY)
+#define BENCHMARK_VARIANT_TINY
+#define BENCHMARK_FORK
+#endif
+
+#if defined(BENCHMARK_VARIANT_STM)
+#include "decompression.h"
+#else
+#include "Decompression.h"
+#endif
+
+#include "Assets.h"
+
+// Variant name and the type of the output buffer
+#if defined(BENCHMARK_FORK)
+#define BENCHMARK_VARIANT_PREFIX	"fork-"
+#else
+#define BENCHMARK_VARIANT_PREFIX	""
+#endif
+
+#if defined(BENCHMARK_VARIANT_FULL)
+#define BENCHMARK_VARIANT_NAME	BENCHMARK_VARIANT_PREFIX "full"
+#elif defined(BENCHMARK_VARIANT_FAST)
+#define BENCHMARK_VARIANT_NAME	BENCHMARK_VARIANT_PREFIX "fast"
+#elif defined(BENCHMARK_VARIANT_PIXEL)
+#define BENCHMARK_VARIANT_NAME	BENCHMARK_VARIANT_PREFIX "pixel"
+#define BENCHMARK_PIXEL_BUFFER
+#elif defined(BENCHMARK_VARIANT_STM)
+#define BENCHMARK_VARIANT_NAME	BENCHMARK_VARIANT_PREFIX "stm"
+#define BENCHMARK_PIXEL_BUFFER
+#elif defined(BENCHMARK_VARIANT_TINY)
+#define BENCHMARK_VARIANT_NAME	BENCHMARK_VARIANT_PREFIX "tiny"
+#define BENCHMARK_PIXEL_BUFFER
+#else
+#error "Select the benchmark variant (BENCHMARK_VARIANT_...)"
+#endif
+
+// Frames per decompressNextFrames() call
+#if (BENCHMARK_IMAGE_WIDTH > 0) && (BENCHMARK_SQUARE_SIDE > 1)
+#define BENCHMARK_FRAMES_PER_CALL	(BENCHMARK_IMAGE_WIDTH * BENCHMARK_SQUARE_SIDE)
+#else
+#define BENCHMARK_FRAMES_PER_CALL	4096
+#endif
+
+// Minimum measurement time when the number of repetitions is not specified
+#define BENCHMARK_MIN_TIME_NS		300000000.0
+#define BENCHMARK_MIN_REPETITIONS	3
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Output buffer (up to 8 bytes per frame for the original class)
+static uint8_t outputBuffer[BENCHMARK_FRAMES_PER_CALL * 8 + 16];
+
+#if !defined(BENCHMARK_VARIANT_STM)
+static Decompression decomp;
+#endif
+
+static BenchmarkItem items[BENCHMARK_MAX_ITEMS];
+static uint8_t itemsCount;
+
+// FNV-1a checksum of the decompressed data
+static uint64_t checksum;
+
+static inline void updateChecksum(const uint8_t * data, uint32_t size)
+{
+	while (size--)
+	{
+		checksum ^= *data++;
+		checksum *= 1099511628211ULL;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Delegates (not used, since the output goes to the buffer)
+#if defined(BENCHMARK_VARIANT_FULL)
+void frameDecompressed(uint64_t frame) {}
+#elif defined(BENCHMARK_VARIANT_TINY)
+void frameDecompressed(uint8_t frame) {}
+#elif !defined(BENCHMARK_VARIANT_STM)
+void frameDecompressed(uint16_t frame) {}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Bytes of the buffer filled by the specified number of frames
+static inline uint32_t outputSize(uint32_t framesCount)
+{
+#if defined(BENCHMARK_PIXEL_BUFFER)
+	return (framesCount * 2);
+#else
+	return ((framesCount * BENCHMARK_BITS_PER_FRAME + 7) >> 3);
+#endif
+}
+
+// Decompress all the items of the asset (optionally updating the checksum)
+static void decompressAsset(bool verify)
+{
+	for (uint8_t i = 0; i < itemsCount; i++)
+	{
+#if defined(BENCHMARK_VARIANT_STM)
+		resetDecompression();
+		decompressionBufferWidth = BENCHMARK_IMAGE_WIDTH;
+#else
+		decomp.resetDecompression();
+		decomp.bufferWidth = BENCHMARK_IMAGE_WIDTH;
+#endif
+
+		uint32_t framesLeft = BENCHMARK_NUMBER_OF_FRAMES;
+		while (framesLeft)
+		{
+			uint32_t framesCount = (framesLeft < BENCHMARK_FRAMES_PER_CALL) ? framesLeft : BENCHMARK_FRAMES_PER_CALL;
+
+#if defined(BENCHMARK_VARIANT_STM)
+			decompressNextFrames((DecompressionContext *)items[i].dc, (uint8_t *)items[i].data, (uint16_t *)outputBuffer, framesCount, false);
+#elif defined(BENCHMARK_PIXEL_BUFFER)
+			decomp.decompressNextFrames((DecompressionContext *)items[i].dc, (uint8_t *)items[i].data, (uint16_t *)outputBuffer, framesCount, false);
+#else
+			decomp.decompressNextFrames((DecompressionContext *)items[i].dc, (uint8_t *)items[i].data, outputBuffer, framesCount);
+#endif
+
+			if (verify) updateChecksum(outputBuffer, outputSize(framesCount));
+			framesLeft -= framesCount;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// CPU cycles: hardware counter of the process if perf events are available,
+// otherwise the time stamp counter (x86), otherwise none.
+static int cyclesCounter = -1;
+
+static const char * openCyclesCounter()
+{
+#if defined(__linux__)
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = PERF_COUNT_HW_CPU_CYCLES;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	cyclesCounter = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+	if (cyclesCounter >= 0) return ("perf");
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+	return ("tsc");
+#else
+	return (NULL);
+#endif
+}
+
+static inline uint64_t readCycles()
+{
+#if defined(__linux__)
+	if (cyclesCounter >= 0)
+	{
+		uint64_t cycles = 0;
+		if (read(cyclesCounter, &cycles, sizeof(cycles)) != sizeof(cycles)) return (0);
+		return (cycles);
+	}
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+	return (__rdtsc());
+#else
+	return (0);
+#endif
+}
+
+static inline double readTime()
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (time.tv_sec * 1e9 + time.tv_nsec);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Usage: benchmark [repetitions]
+int main(int argc, char ** argv)
+{
+	uint32_t repetitions = (argc > 1) ? strtoul(argv[1], NULL, 10) : 0;
+
+	itemsCount = benchmarkLoadItems(items);
+
+	uint32_t compressedSize = 0;
+	for (uint8_t i = 0; i < itemsCount; i++) compressedSize += items[i].size;
+
+	// Verification pass (also warms up the caches)
+	checksum = 14695981039346656037ULL;
+	decompressAsset(true);
+
+	// Measurement: the best of the repetitions
+	const char * cyclesSource = openCyclesCounter();
+	double bestTime = 0;
+	uint64_t bestCycles = 0;
+	double totalTime = 0;
+
+	for (uint32_t r = 0; repetitions ? (r < repetitions) : ((r < BENCHMARK_MIN_REPETITIONS) || (totalTime < BENCHMARK_MIN_TIME_NS)); r++)
+	{
+		double startTime = readTime();
+		uint64_t startCycles = readCycles();
+
+		decompressAsset(false);
+
+		uint64_t cycles = readCycles() - startCycles;
+		double time = readTime() - startTime;
+
+		if ((r == 0) || (time < bestTime))
+		{
+			bestTime = time;
+			bestCycles = cycles;
+		}
+		totalTime += time;
+	}
+
+	uint32_t framesCount = (uint32_t)BENCHMARK_NUMBER_OF_FRAMES * itemsCount;
+	double decompressedSize = (double)framesCount * BENCHMARK_BITS_PER_FRAME / 8;
+
+	printf("{ \"variant\": \"%s\", \"asset\": \"%s\", \"items\": %u, \"frames\": %u, ", BENCHMARK_VARIANT_NAME, BENCHMARK_ASSET_NAME, itemsCount, framesCount);
+	printf("\"compressedBytes\": %u, \"decompressedBytes\": %.0f, \"checksum\": \"%016llx\", ", compressedSize, decompressedSize, (unsigned long long)checksum);
+	printf("\"MBps\": %.2f, \"nsPerFrame\": %.3f, ", decompressedSize * 1e3 / bestTime, bestTime / framesCount);
+	if (cyclesSource) printf("\"cyclesPerFrame\": %.2f, \"cyclesSource\": \"%s\" }\n", (double)bestCycles / framesCount, cyclesSource);
+	else printf("\"cyclesPerFrame\": null, \"cyclesSource\": null }\n");
+
+	return (0);
+}
+
+// END-OF-FILE
@@ -0,0 +1,60 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// The part of the Arduino core used by the ST7789 driver of the examples,
+// implemented on top of the display simulator (see DisplaySimulator.h).
+
+// Includes
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+// The drivers define their own BIG_ENDIAN and LITTLE_ENDIAN
+#undef BIG_ENDIAN
+#undef LITTLE_ENDIAN
+
+
+#ifndef _SIMULATOR_ARDUINO_
+#define _SIMULATOR_ARDUINO_
+
+#define LOW				0
+#define HIGH			1
+#define INPUT			0
+#define OUTPUT			1
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+void delay(unsigned long ms);
+
+// The simulated display and its DC pin (set by the pipeline)
+class ST7789Simulator;
+extern ST7789Simulator * arduinoST7789;
+extern uint8_t arduinoDataCommandPin;
+
+
+#endif // end _SIMULATOR_ARDUINO_
+
+// END-OF-FILE
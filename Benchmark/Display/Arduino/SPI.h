@@ -0,0 +1,68 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// The SPI library of the Arduino core on top of the display simulator:
+// every call is a blocking transfer at the clock of the current transaction.
+
+// Includes
+#include "Arduino.h"
+
+
+#ifndef _SIMULATOR_SPI_
+#define _SIMULATOR_SPI_
+
+#define MSBFIRST		1
+#define SPI_MODE0		0x00
+#define SPI_MODE1		0x04
+#define SPI_MODE2		0x08
+#define SPI_MODE3		0x0C
+
+class SPISettings
+{
+public:
+	SPISettings(uint32_t clock = 4000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0) : clock(clock) {}
+	uint32_t clock;
+};
+
+class SPIClass
+{
+public:
+	void begin() {}
+	void end() {}
+	void beginTransaction(SPISettings settings);
+	void endTransaction() {}
+	uint8_t transfer(uint8_t data);
+	uint16_t transfer16(uint16_t data);
+	void transfer(void * buffer, size_t size);
+	void writeBytes(const uint8_t * data, uint32_t size);
+};
+
+extern SPIClass SPI;
+
+
+#endif // end _SIMULATOR_SPI_
+
+// END-OF-FILE
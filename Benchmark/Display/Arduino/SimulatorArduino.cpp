@@ -0,0 +1,91 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Includes
+#include "Arduino.h"
+#include "SPI.h"
+#include "DisplaySimulator.h"
+
+
+SPIClass SPI;
+
+ST7789Simulator * arduinoST7789 = NULL;
+uint8_t arduinoDataCommandPin = 0xFF;
+
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+	if (arduinoST7789 && (pin == arduinoDataCommandPin)) arduinoST7789->setDataMode(value != LOW);
+}
+
+
+void delay(unsigned long ms)
+{
+	if (arduinoST7789) arduinoST7789->addCpuTime(ms * 1e6);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+void SPIClass::beginTransaction(SPISettings settings)
+{
+	if (arduinoST7789) arduinoST7789->spiClock = settings.clock;
+}
+
+
+// The received data is always zero
+uint8_t SPIClass::transfer(uint8_t data)
+{
+	if (arduinoST7789) arduinoST7789->write(&data, 1, false);
+	return (0);
+}
+
+
+uint16_t SPIClass::transfer16(uint16_t data)
+{
+	uint8_t bytes[2] = { (uint8_t)(data >> 8), (uint8_t)(data & 0xFF) };
+	if (arduinoST7789) arduinoST7789->write(bytes, sizeof(bytes), false);
+	return (0);
+}
+
+
+// The buffer is left unchanged (the real one is overwritten by the received data)
+void SPIClass::transfer(void * buffer, size_t size)
+{
+	if (arduinoST7789) arduinoST7789->write((const uint8_t *)buffer, size, false);
+}
+
+
+void SPIClass::writeBytes(const uint8_t * data, uint32_t size)
+{
+	if (arduinoST7789) arduinoST7789->write(data, size, false);
+}
+
+// END-OF-FILE
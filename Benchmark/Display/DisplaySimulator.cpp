@@ -0,0 +1,627 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Includes
+#include "DisplaySimulator.h"
+#include <stdlib.h>
+#include <string.h>
+
+
+DisplaySimulator::DisplaySimulator(uint16_t ramWidth, uint16_t ramHeight, uint16_t panelWidth, uint16_t panelHeight, bool invertedPanel)
+	: ramWidth(ramWidth), ramHeight(ramHeight), panelWidth(panelWidth), panelHeight(panelHeight), invertedPanel(invertedPanel)
+{
+	ram = (uint16_t *)calloc((size_t)ramWidth * ramHeight, sizeof(uint16_t));
+	memset(parameters, 0, sizeof(parameters));
+	memset(&statistics, 0, sizeof(statistics));
+}
+
+
+DisplaySimulator::~DisplaySimulator()
+{
+	free(dmaCopy);
+	free(ram);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Virtual time
+
+void DisplaySimulator::addCpuTime(double time)
+{
+	// The buffers have already been written by the CPU, so the writes
+	// are attributed to the beginning of this time interval
+	checkDMASource();
+	advance(now + time);
+	now += time;
+	statistics.cpuTime += time;
+}
+
+
+void DisplaySimulator::waitBus()
+{
+	checkDMASource();
+	if (inInterrupt) return;
+	advance(now);
+
+	// The interrupts may start the next transfers, which are waited for too
+	while (dmaActive || interruptPending)
+	{
+		// Never ends
+		if (dmaActive && dmaCircular)
+		{
+			statistics.protocolErrors++;
+			stopDMA();
+			break;
+		}
+		waitEvent();
+	}
+
+	if (now < busyUntil)
+	{
+		statistics.stallTime += busyUntil - now;
+		now = busyUntil;
+	}
+}
+
+
+void DisplaySimulator::idle()
+{
+	checkDMASource();
+	if (inInterrupt) return;
+	advance(now);
+	if (dmaActive || interruptPending) waitEvent();
+}
+
+
+void DisplaySimulator::advance(double time)
+{
+	if (inInterrupt) return;
+
+	for (;;)
+	{
+		// The interrupt of the part comes before the end of the next one
+		if (interruptPending && (interruptTime <= time) && (!dmaActive || (interruptTime <= busyUntil))) runInterrupt();
+		else if (dmaActive && (busyUntil <= time)) completeDMAPart();
+		else break;
+	}
+}
+
+
+// The CPU spins until the next end of a part or interrupt
+void DisplaySimulator::waitEvent()
+{
+	double time = busyUntil;
+	if (interruptPending && (!dmaActive || (interruptTime < busyUntil))) time = interruptTime;
+	if (now < time)
+	{
+		statistics.stallTime += time - now;
+		now = time;
+	}
+	advance(now);
+}
+
+
+void DisplaySimulator::beginPhase()
+{
+	memset(&statistics, 0, sizeof(statistics));
+	phaseStart = now;
+}
+
+
+// Wait for the end of the transfers and return the elapsed time
+double DisplaySimulator::endPhase()
+{
+	waitBus();
+	return (now - phaseStart);
+}
+
+
+// One JSON line per phase (times are in microseconds)
+void DisplaySimulator::printReport(FILE * file, const char * pipeline, const char * phase, uint32_t mismatches)
+{
+	double time = now - phaseStart;
+	double busTime = statistics.commandTime + statistics.pixelTime;
+
+	fprintf(file, "{ \"pipeline\": \"%s\", \"phase\": \"%s\", ", pipeline, phase);
+	fprintf(file, "\"timeUs\": %.1f, \"busTimeUs\": %.1f, \"commandTimeUs\": %.1f, \"pixelTimeUs\": %.1f, \"cpuTimeUs\": %.1f, \"stallTimeUs\": %.1f, \"busUtilization\": %.3f, ",
+		time / 1e3, busTime / 1e3, statistics.commandTime / 1e3, statistics.pixelTime / 1e3, statistics.cpuTime / 1e3, statistics.stallTime / 1e3, (time > 0) ? busTime / time : 0);
+	fprintf(file, "\"commands\": %u, \"parameters\": %u, \"windows\": %u, \"pixels\": %u, \"transfers\": %u, \"dmaTransfers\": %u, \"dmaInterrupts\": %u, ",
+		statistics.commands, statistics.parameters, statistics.windows, statistics.pixels, statistics.transfers, statistics.dmaTransfers, statistics.dmaInterrupts);
+	fprintf(file, "\"bufferConflicts\": %u, \"protocolErrors\": %u, \"mismatches\": %u }\n", statistics.bufferConflicts, statistics.protocolErrors, mismatches);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Bus
+
+bool DisplaySimulator::transfer(double duration, bool pixels)
+{
+	checkDMASource();
+	advance(now);
+
+	// The HAL rejects a transfer while the previous DMA one is in progress
+	if (isBusy())
+	{
+		statistics.protocolErrors++;
+		return (false);
+	}
+
+	busyUntil = now + duration;
+	if (pixels) statistics.pixelTime += duration;
+	else statistics.commandTime += duration;
+
+	statistics.transfers++;
+	now = busyUntil;
+	return (true);
+}
+
+
+bool DisplaySimulator::startDMA(const uint8_t * source, size_t size, double overhead, double byteTime, bool pixels, bool circular, size_t pattern)
+{
+	checkDMASource();
+	advance(now);
+
+	if (isBusy() || (size == 0) || (circular && (size & 1)))
+	{
+		statistics.protocolErrors++;
+		return (false);
+	}
+
+	statistics.dmaTransfers++;
+	dmaActive = true;
+	dmaCircular = circular;
+	dmaPixels = pixels;
+	dmaSource = source;
+	dmaSize = size;
+	dmaOffset = 0;
+	dmaPartSize = circular ? size >> 1 : size;
+	dmaPattern = pattern;
+	dmaByteTime = byteTime;
+	startDMAPart(now, overhead);
+	return (true);
+}
+
+
+// The part is copied at its start, the real DMA reads it until the end
+void DisplaySimulator::startDMAPart(double start, double overhead)
+{
+	free(dmaCopy);
+	dmaCopy = (uint8_t *)malloc(dmaPartSize);
+	if (dmaPattern)
+	{
+		for (size_t i = 0; i < dmaPartSize; i++) dmaCopy[i] = dmaSource[i % dmaPattern];
+	}
+	else memcpy(dmaCopy, dmaSource + dmaOffset, dmaPartSize);
+	dmaConflict = false;
+	dmaPartStart = start;
+	busyUntil = start + overhead + dmaPartSize * dmaByteTime;
+}
+
+
+void DisplaySimulator::completeDMAPart()
+{
+	double end = busyUntil;
+	double duration = end - dmaPartStart;
+	if (dmaPixels) statistics.pixelTime += duration;
+	else statistics.commandTime += duration;
+	deliver(dmaCopy, dmaPartSize);
+	if (dmaConflict) statistics.bufferConflicts++;
+
+	// The circular DMA goes on with the other half at once
+	bool half = false;
+	if (dmaCircular)
+	{
+		half = (dmaOffset == 0);
+		dmaOffset = half ? dmaPartSize : 0;
+		startDMAPart(end, 0);
+	}
+	else
+	{
+		dmaActive = false;
+		free(dmaCopy);
+		dmaCopy = NULL;
+	}
+
+	// The interrupt of the previous part is lost (the latency is too long)
+	if (interruptPending) statistics.protocolErrors++;
+	interruptPending = true;
+	interruptHalf = half;
+	interruptTime = end + interruptLatency;
+}
+
+
+// The handler preempts the CPU, which is delayed by its time
+void DisplaySimulator::runInterrupt()
+{
+	interruptPending = false;
+	statistics.dmaInterrupts++;
+	if (!dmaInterrupt) return;
+
+	double cpuTime = now;
+	now = interruptTime;
+	inInterrupt = true;
+	dmaInterrupt(interruptHalf);
+	inInterrupt = false;
+	now = cpuTime + (now - interruptTime);
+}
+
+
+// Bytes of the current part taken by the time
+size_t DisplaySimulator::dmaBytesSent() const
+{
+	size_t sent = 0;
+	if (now > dmaPartStart) sent = (size_t)((now - dmaPartStart) / dmaByteTime);
+	return ((sent > dmaPartSize) ? dmaPartSize : sent);
+}
+
+
+size_t DisplaySimulator::dmaBytesLeft() const
+{
+	if (!dmaActive) return (0);
+	return (dmaSize - dmaOffset - (dmaBytesSent() & ~(size_t)1));
+}
+
+
+// The bytes of the current part sent by the time are delivered.
+// The conflicts of the part are not counted: the driver stops the circular DMA
+// when it has reached a buffer not filled in time, and sends the pixels again.
+size_t DisplaySimulator::stopDMA()
+{
+	interruptPending = false;
+	if (!dmaActive) return (0);
+
+	size_t sent = dmaBytesSent();
+	if (dmaPixels) statistics.pixelTime += sent * dmaByteTime;
+	else statistics.commandTime += sent * dmaByteTime;
+	deliver(dmaCopy, sent & ~(size_t)1);
+
+	dmaActive = false;
+	free(dmaCopy);
+	dmaCopy = NULL;
+	busyUntil = now;
+	return (dmaSize - dmaOffset - (sent & ~(size_t)1));
+}
+
+
+// Any change of the part in progress by the CPU is a conflict (counted at the end of the part)
+void DisplaySimulator::checkDMASource()
+{
+	if (!dmaActive || dmaConflict || (now >= busyUntil)) return;
+
+	if (dmaPattern ? memcmp(dmaSource, dmaCopy, dmaPattern) : memcmp(dmaSource + dmaOffset, dmaCopy, dmaPartSize)) dmaConflict = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Controller
+
+void DisplaySimulator::executeCommand(uint8_t value)
+{
+	statistics.commands++;
+	command = value;
+	memoryWrite = false;
+
+	switch (value)
+	{
+	case SIMULATOR_SLPIN:
+		sleeping = true;
+		break;
+	case SIMULATOR_SLPOUT:
+		sleeping = false;
+		break;
+	case SIMULATOR_INVOFF:
+		inversion = false;
+		break;
+	case SIMULATOR_INVON:
+		inversion = true;
+		break;
+	case SIMULATOR_DISPOFF:
+		displayOn = false;
+		break;
+	case SIMULATOR_DISPON:
+		displayOn = true;
+		break;
+	case SIMULATOR_RAMWR:
+		memoryWrite = true;
+		column = columnStart;
+		row = rowStart;
+		statistics.windows++;
+		break;
+	}
+}
+
+
+void DisplaySimulator::writeParameter(uint8_t index, uint8_t value)
+{
+	if (index >= SIMULATOR_MAX_PARAMETERS) return;
+	parameters[index] = value;
+
+	switch (command)
+	{
+	case SIMULATOR_CASET:
+		if (index == 1) columnStart = (parameters[0] << 8) | parameters[1];
+		else if (index == 3) columnEnd = (parameters[2] << 8) | parameters[3];
+		break;
+	case SIMULATOR_RASET:
+		if (index == 1) rowStart = (parameters[0] << 8) | parameters[1];
+		else if (index == 3) rowEnd = (parameters[2] << 8) | parameters[3];
+		break;
+	case SIMULATOR_MADCTL:
+		if (index == 0) madctl = value;
+		break;
+	case SIMULATOR_COLORMODE:
+		if (index == 0) colorMode = value;
+		break;
+	case SIMULATOR_RAMCTRL:
+		// ENDIAN bit of the second parameter
+		if (index == 1) littleEndian = (value & 0x08) != 0;
+		break;
+	}
+}
+
+
+// Next pixel of the window: columns first, then rows, wrapping to the window start
+void DisplaySimulator::writePixel(uint16_t color)
+{
+	// 16 bits per pixel only
+	if (!memoryWrite || ((colorMode & 0x0F) != 0x05))
+	{
+		statistics.protocolErrors++;
+		return;
+	}
+
+	uint16_t x, y;
+	toPhysical(column, row, &x, &y);
+	if ((x < ramWidth) && (y < ramHeight)) ram[(uint32_t)y * ramWidth + x] = color;
+	statistics.pixels++;
+
+	if (column < columnEnd) column++;
+	else
+	{
+		column = columnStart;
+		row = (row < rowEnd) ? row + 1 : rowStart;
+	}
+}
+
+
+// Logical address to the RAM position: the row/column exchange,
+// then the mirroring of the physical axes
+void DisplaySimulator::toPhysical(uint16_t column, uint16_t row, uint16_t * x, uint16_t * y) const
+{
+	int32_t px = (madctl & SIMULATOR_MADCTL_MV) ? row : column;
+	int32_t py = (madctl & SIMULATOR_MADCTL_MV) ? column : row;
+	if (madctl & SIMULATOR_MADCTL_MX) px = ramWidth - 1 - px;
+	if (madctl & SIMULATOR_MADCTL_MY) py = ramHeight - 1 - py;
+
+	// Out of the RAM
+	*x = (px < 0) ? 0xFFFF : (uint16_t)px;
+	*y = (py < 0) ? 0xFFFF : (uint16_t)py;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Image of the panel
+
+uint16_t DisplaySimulator::imageWidth() const
+{
+	return ((madctl & SIMULATOR_MADCTL_MV) ? panelHeight : panelWidth);
+}
+
+
+uint16_t DisplaySimulator::imageHeight() const
+{
+	return ((madctl & SIMULATOR_MADCTL_MV) ? panelWidth : panelHeight);
+}
+
+
+// Logical address of the top left corner of the visible area
+void DisplaySimulator::imageOrigin(uint16_t * column, uint16_t * row) const
+{
+	uint16_t minColumn = 0xFFFF, minRow = 0xFFFF;
+	const uint16_t corners[2][2] = { { 0, 0 }, { (uint16_t)(panelWidth - 1), (uint16_t)(panelHeight - 1) } };
+
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		// Inverse of toPhysical()
+		uint16_t x = (madctl & SIMULATOR_MADCTL_MX) ? ramWidth - 1 - corners[i][0] : corners[i][0];
+		uint16_t y = (madctl & SIMULATOR_MADCTL_MY) ? ramHeight - 1 - corners[i][1] : corners[i][1];
+		uint16_t c = (madctl & SIMULATOR_MADCTL_MV) ? y : x;
+		uint16_t r = (madctl & SIMULATOR_MADCTL_MV) ? x : y;
+		if (c < minColumn) minColumn = c;
+		if (r < minRow) minRow = r;
+	}
+
+	*column = minColumn;
+	*row = minRow;
+}
+
+
+// Pixel as the panel shows it (inversion and display on/off applied)
+uint16_t DisplaySimulator::getPixel(uint16_t x, uint16_t y) const
+{
+	if (!displayOn || sleeping) return (0);
+
+	uint16_t column, row;
+	imageOrigin(&column, &row);
+	toPhysical(column + x, row + y, &x, &y);
+	if ((x >= ramWidth) || (y >= ramHeight)) return (0);
+
+	uint16_t color = ram[(uint32_t)y * ramWidth + x];
+	if (inversion != invertedPanel) color = ~color;
+	return (color);
+}
+
+
+bool DisplaySimulator::savePPM(const char * path) const
+{
+	FILE * file = fopen(path, "wb");
+	if (file == NULL) return (false);
+
+	uint16_t width = imageWidth();
+	uint16_t height = imageHeight();
+	fprintf(file, "P6\n%u %u\n255\n", width, height);
+
+	for (uint16_t y = 0; y < height; y++)
+	{
+		for (uint16_t x = 0; x < width; x++)
+		{
+			// RGB565 to RGB888
+			uint16_t color = getPixel(x, y);
+			uint8_t rgb[3] = { (uint8_t)(((color >> 11) & 0x1F) * 255 / 31), (uint8_t)(((color >> 5) & 0x3F) * 255 / 63), (uint8_t)((color & 0x1F) * 255 / 31) };
+			fwrite(rgb, 1, sizeof(rgb), file);
+		}
+	}
+
+	return (fclose(file) == 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// ST7789: the panels of the examples are normally black, so INVON is required
+
+ST7789Simulator::ST7789Simulator() : DisplaySimulator(240, 320, 240, 240, true)
+{
+}
+
+
+// DC line: switching it during a transfer corrupts the rest of the transfer
+void ST7789Simulator::setDataMode(bool data)
+{
+	checkDMASource();
+	if ((data != dataMode) && isBusy()) statistics.protocolErrors++;
+	dataMode = data;
+}
+
+
+bool ST7789Simulator::write(const uint8_t * data, size_t size, bool dma, bool circular, bool fixedSource)
+{
+	// The fixed source is a 16-bit item of the DMA (two bytes of the SPI)
+	if (dma) return (startDMA(data, size, dmaOverhead, 8e9 / spiClock, dataMode && isMemoryWrite(), circular, fixedSource ? sizeof(uint16_t) : 0));
+
+	if (!transfer(size * 8e9 / spiClock + callOverhead, dataMode && isMemoryWrite())) return (false);
+	deliver(data, size);
+	return (true);
+}
+
+
+void ST7789Simulator::deliver(const uint8_t * data, size_t size)
+{
+	for (size_t i = 0; i < size; i++)
+	{
+		uint8_t value = data[i];
+
+		if (!dataMode)
+		{
+			executeCommand(value);
+			parameterIndex = 0;
+			pendingByte = -1;
+		}
+		else if (isMemoryWrite())
+		{
+			// Two bytes per pixel in the byte order set by RAMCTRL
+			if (pendingByte < 0) pendingByte = value;
+			else
+			{
+				writePixel(isLittleEndian() ? (uint16_t)(pendingByte | (value << 8)) : (uint16_t)((pendingByte << 8) | value));
+				pendingByte = -1;
+			}
+		}
+		else
+		{
+			writeParameter(parameterIndex++, value);
+			statistics.parameters++;
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// NT35510
+
+NT35510Simulator::NT35510Simulator() : DisplaySimulator(480, 800, 480, 800, false)
+{
+}
+
+
+void NT35510Simulator::setTiming(double hclk, uint8_t addressSetup, uint8_t dataSetup)
+{
+	writeCycle = (addressSetup + dataSetup + 1) * 1e9 / hclk;
+}
+
+
+bool NT35510Simulator::writeRegister(uint16_t value)
+{
+	if (!transfer(writeCycle, false)) return (false);
+
+	executeCommand(value >> 8);
+	subAddress = value & 0xFF;
+	return (true);
+}
+
+
+bool NT35510Simulator::writeData(const uint16_t * data, size_t size, bool dma, bool fixedSource)
+{
+	if (dma) return (startDMA((const uint8_t *)data, size * sizeof(uint16_t), dmaOverhead, writeCycle / sizeof(uint16_t), isMemoryWrite(), false, fixedSource ? sizeof(uint16_t) : 0));
+
+	if (!transfer(size * writeCycle, isMemoryWrite())) return (false);
+	deliver((const uint8_t *)data, size * sizeof(uint16_t));
+	return (true);
+}
+
+
+// Words of the data bus
+void NT35510Simulator::deliver(const uint8_t * data, size_t size)
+{
+	for (size_t i = 0; i + 1 < size; i += sizeof(uint16_t))
+	{
+		uint16_t value;
+		memcpy(&value, data + i, sizeof(value));
+
+		if (isMemoryWrite()) writePixel(value);
+		else
+		{
+			// The driver writes the whole 16-bit addresses
+			// into the even sub-addresses of CASET/RASET
+			if ((currentCommand() == SIMULATOR_CASET) || (currentCommand() == SIMULATOR_RASET))
+			{
+				writeParameter(subAddress, value >> 8);
+				writeParameter(subAddress + 1, value & 0xFF);
+			}
+			else writeParameter(subAddress, value & 0xFF);
+
+			subAddress++;
+			statistics.parameters++;
+		}
+	}
+}
+
+// END-OF-FILE
@@ -0,0 +1,268 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Host model of the display controllers of the examples: ST7789 on the SPI bus
+// and NT35510 on the 16-bit FSMC bus.
+// The command stream of a driver is parsed the way the controller does it:
+// the address window (CASET/RASET), memory access control (MADCTL), color mode,
+// RAM endianness and inversion are tracked, and the RAMWR pixels are written
+// into the graphics RAM, which can be saved as an image.
+// Every transfer also takes the bus time of the configured SPI clock or FSMC timing,
+// so the end-to-end time of a pipeline is known: blocking transfers stall the CPU,
+// DMA transfers run in the background, and the CPU time of the decoder
+// is added between them by the pipeline.
+// The DMA data reaches the controller at the end of the transfer (of each half
+// of a circular one, which goes on with the other half at once), then the DMA
+// interrupt is called in the virtual time of that moment plus the interrupt latency,
+// so the driver can start the next transfer from it. The time of the interrupt
+// handler delays the CPU.
+
+// Includes
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+
+#ifndef _DISPLAY_SIMULATOR_
+#define _DISPLAY_SIMULATOR_
+
+// Commands (the NT35510 ones are shifted left by 8 bits, the low byte is a sub-address)
+#define SIMULATOR_SLPIN				0x10
+#define SIMULATOR_SLPOUT			0x11
+#define SIMULATOR_INVOFF			0x20
+#define SIMULATOR_INVON				0x21
+#define SIMULATOR_DISPOFF			0x28
+#define SIMULATOR_DISPON			0x29
+#define SIMULATOR_CASET				0x2A
+#define SIMULATOR_RASET				0x2B
+#define SIMULATOR_RAMWR				0x2C
+#define SIMULATOR_MADCTL			0x36
+#define SIMULATOR_COLORMODE			0x3A
+#define SIMULATOR_RAMCTRL			0xB0	// ST7789 only
+
+// Memory access control bits
+#define SIMULATOR_MADCTL_MY			0x80
+#define SIMULATOR_MADCTL_MX			0x40
+#define SIMULATOR_MADCTL_MV			0x20
+
+// Maximum number of command parameters kept
+#define SIMULATOR_MAX_PARAMETERS	8
+
+
+// Counters of a pipeline phase (times are in nanoseconds)
+struct DisplayStatistics
+{
+	uint32_t commands;
+	uint32_t parameters;		// Parameter bytes (SPI) or words (FSMC)
+	uint32_t windows;			// Memory writes started (RAMWR)
+	uint32_t pixels;
+	uint32_t transfers;			// Blocking transfers (HAL calls, SPI calls, FSMC writes)
+	uint32_t dmaTransfers;
+	uint32_t dmaInterrupts;
+	uint32_t bufferConflicts;	// DMA source changed by the CPU before the end of the transfer
+	uint32_t protocolErrors;	// Transfers or DC changes while the bus is busy, pixels outside RAMWR, etc.
+	double commandTime;			// Bus time of the commands and parameters
+	double pixelTime;			// Bus time of the pixels
+	double cpuTime;				// Time added by addCpuTime()
+	double stallTime;			// Time the CPU waited for the bus
+};
+
+
+class DisplaySimulator
+{
+public:
+	DisplaySimulator(uint16_t ramWidth, uint16_t ramHeight, uint16_t panelWidth, uint16_t panelHeight, bool invertedPanel);
+	virtual ~DisplaySimulator();
+
+	// Virtual time of the CPU and the end of the last bus transfer
+	double now = 0;
+	double busyUntil = 0;
+
+	DisplayStatistics statistics;
+
+	// Completion interrupt of the DMA transfers (half - the first half of a circular one is done)
+	void (*dmaInterrupt)(bool half) = NULL;
+	// Time from the end of the transfer to the interrupt handler (ns), shorter than a transfer
+	double interruptLatency = 0;
+
+	// Time spent by the CPU outside of the driver (decompression etc.)
+	void addCpuTime(double time);
+	// Spin until the bus is free (WAIT_DMA)
+	void waitBus();
+	// Spin until the next DMA interrupt
+	void idle();
+	// The HAL state of the DMA transfer is busy until its interrupt
+	bool isBusy() const { return (dmaActive || interruptPending || (now < busyUntil)); }
+
+	// Bytes left in the DMA transfer in progress (the DMA counter)
+	size_t dmaBytesLeft() const;
+	bool isDMAActive() const { return (dmaActive); }
+	// Stop of the DMA transfer (its pending interrupt is cleared), returns the number of bytes left in it
+	size_t stopDMA();
+
+	// Phases: the statistics and the elapsed time are counted from beginPhase()
+	void beginPhase();
+	double endPhase();
+	void printReport(FILE * file, const char * pipeline, const char * phase, uint32_t mismatches);
+
+	// The visible area in the orientation set by MADCTL
+	uint16_t imageWidth() const;
+	uint16_t imageHeight() const;
+	uint16_t getPixel(uint16_t x, uint16_t y) const;
+	bool savePPM(const char * path) const;
+
+protected:
+	// Controller
+	void executeCommand(uint8_t command);
+	void writeParameter(uint8_t index, uint8_t value);
+	void writePixel(uint16_t color);
+	bool isMemoryWrite() const { return (memoryWrite); }
+	bool isLittleEndian() const { return (littleEndian); }
+	uint8_t currentCommand() const { return (command); }
+
+	// Bus: returns false (and counts an error) if the bus is still busy,
+	// otherwise occupies it for the specified time (the CPU waits for the end)
+	bool transfer(double duration, bool pixels);
+	// DMA transfer of the bytes: the first one is taken after the overhead time,
+	// then each one takes the byte time. The data is delivered at the end.
+	// Fixed source - the "pattern" bytes of the source are repeated (no memory increment).
+	bool startDMA(const uint8_t * source, size_t size, double overhead, double byteTime, bool pixels, bool circular, size_t pattern = 0);
+	// DMA data reaching the controller
+	virtual void deliver(const uint8_t * data, size_t size) = 0;
+
+	// Check the source of the DMA transfer in progress
+	void checkDMASource();
+	// The CPU reaches the time: the DMA transfers ended before it are completed
+	void advance(double time);
+
+private:
+	uint16_t ramWidth, ramHeight;
+	uint16_t panelWidth, panelHeight;
+	bool invertedPanel;
+	uint16_t * ram;
+
+	uint8_t command = 0;
+	uint8_t madctl = 0;
+	uint8_t colorMode = 0x66;
+	bool littleEndian = false;
+	bool inversion = false;
+	bool sleeping = true;
+	bool displayOn = false;
+	bool memoryWrite = false;
+	uint8_t parameters[SIMULATOR_MAX_PARAMETERS];
+	uint16_t columnStart = 0, columnEnd = 0, rowStart = 0, rowEnd = 0;
+	uint16_t column = 0, row = 0;
+
+	// DMA transfer in progress: the part being sent (a half of the circular one)
+	// and its copy taken at the start of the part
+	bool dmaActive = false;
+	bool dmaCircular = false;
+	bool dmaPixels = false;
+	bool dmaConflict = false;
+	bool inInterrupt = false;
+	const uint8_t * dmaSource = NULL;
+	size_t dmaSize = 0;
+	size_t dmaOffset = 0;
+	size_t dmaPartSize = 0;
+	size_t dmaPattern = 0;
+	uint8_t * dmaCopy = NULL;
+	double dmaPartStart = 0;
+	double dmaByteTime = 0;
+
+	// The interrupt of the completed part waiting for the latency
+	bool interruptPending = false;
+	bool interruptHalf = false;
+	double interruptTime = 0;
+
+	double phaseStart = 0;
+
+	void toPhysical(uint16_t column, uint16_t row, uint16_t * x, uint16_t * y) const;
+	void imageOrigin(uint16_t * column, uint16_t * row) const;
+	void startDMAPart(double start, double overhead);
+	void completeDMAPart();
+	size_t dmaBytesSent() const;
+	void runInterrupt();
+	void waitEvent();
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// ST7789 on the 4-wire SPI bus: 240x320 RAM, 240x240 panel of the examples.
+// Bytes sent with the DC line low are commands, high - parameters or pixels.
+class ST7789Simulator : public DisplaySimulator
+{
+public:
+	ST7789Simulator();
+
+	// Bus timing
+	double spiClock = 8000000;	// Hz
+	double callOverhead = 0;	// ns per blocking call (driver and HAL code, DC/CS switching)
+	double dmaOverhead = 0;		// ns per DMA start
+
+	void setDataMode(bool data);
+	bool write(const uint8_t * data, size_t size, bool dma, bool circular = false, bool fixedSource = false);
+
+protected:
+	void deliver(const uint8_t * data, size_t size);
+
+private:
+	bool dataMode = false;
+	uint8_t parameterIndex = 0;
+	int16_t pendingByte = -1;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// NT35510 on the 16-bit FSMC bus: 480x800 RAM and panel.
+// The register (RS low) writes are the commands with the sub-address in the low byte,
+// the data (RS high) writes are the parameters or pixels.
+class NT35510Simulator : public DisplaySimulator
+{
+public:
+	NT35510Simulator();
+
+	// Bus timing: FSMC mode A write takes ADDSET + DATAST + 1 HCLK cycles
+	double writeCycle = 71.0 * 1e9 / 168000000;	// ns
+	double dmaOverhead = 0;						// ns per DMA start
+
+	void setTiming(double hclk, uint8_t addressSetup, uint8_t dataSetup);
+
+	bool writeRegister(uint16_t value);
+	bool writeData(const uint16_t * data, size_t size, bool dma, bool fixedSource = false);
+
+protected:
+	void deliver(const uint8_t * data, size_t size);
+
+private:
+	uint8_t subAddress = 0;
+};
+
+
+#endif // end _DISPLAY_SIMULATOR_
+
+// END-OF-FILE
@@ -0,0 +1,172 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Includes
+#include "SimulatorHal.h"
+#include "DisplaySimulator.h"
+
+
+GPIO_TypeDef simulatorGPIO[8] = { { 0 }, { 1 }, { 2 }, { 3 }, { 4 }, { 5 }, { 6 }, { 7 } };
+
+// The handles of the examples (defined in "main.c" there).
+// The source of the memory-to-memory DMA of the FSMC is the "peripheral" port.
+static DMA_HandleTypeDef spiDMA = { { HAL_DMA_STATE_READY }, { DMA_NORMAL, DMA_PINC_DISABLE, DMA_MINC_ENABLE } };
+static DMA_HandleTypeDef sramDMA = { { HAL_DMA_STATE_READY }, { DMA_NORMAL, DMA_PINC_ENABLE, DMA_MINC_DISABLE } };
+SPI_HandleTypeDef hspi1 = { &spiDMA };
+SRAM_HandleTypeDef hsram1 = { &sramDMA };
+
+ST7789Simulator * halST7789 = NULL;
+NT35510Simulator * halNT35510 = NULL;
+GPIO_TypeDef * halDataCommandPort = NULL;
+uint16_t halDataCommandPin = 0;
+
+
+// Bytes left in the last stopped DMA transfer
+static size_t dmaBytesLeft = 0;
+
+
+// The display the CPU works with
+static DisplaySimulator * activeDisplay()
+{
+	if (halST7789) return (halST7789);
+	return (halNT35510);
+}
+
+
+// DMA interrupts
+static void spiInterrupt(bool half)
+{
+	if (half) HAL_SPI_TxHalfCpltCallback(&hspi1);
+	else HAL_SPI_TxCpltCallback(&hspi1);
+}
+
+
+static void sramInterrupt(bool half)
+{
+	HAL_SRAM_DMA_XferCpltCallback(hsram1.hdma);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+void HAL_Delay(uint32_t delay)
+{
+	DisplaySimulator * display = activeDisplay();
+	if (display) display->addCpuTime(delay * 1e6);
+}
+
+
+void HAL_GPIO_WritePin(GPIO_TypeDef * port, uint16_t pin, GPIO_PinState state)
+{
+	if (halST7789 && (port == halDataCommandPort) && (pin == halDataCommandPin)) halST7789->setDataMode(state == GPIO_PIN_SET);
+}
+
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef * hspi, uint8_t * data, uint16_t size, uint32_t timeout)
+{
+	if (halST7789 == NULL) return (HAL_ERROR);
+	return (halST7789->write(data, size, false) ? HAL_OK : HAL_BUSY);
+}
+
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef * hspi, uint8_t * data, uint16_t size)
+{
+	if (halST7789 == NULL) return (HAL_ERROR);
+	halST7789->dmaInterrupt = spiInterrupt;
+	return (halST7789->write(data, size, true, hspi->hdmatx->Init.Mode == DMA_CIRCULAR, hspi->hdmatx->Init.MemInc == DMA_MINC_DISABLE) ? HAL_OK : HAL_BUSY);
+}
+
+
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef * hspi)
+{
+	if (halST7789 == NULL) return (HAL_ERROR);
+	dmaBytesLeft = halST7789->stopDMA();
+	return (HAL_OK);
+}
+
+
+// Memory to memory DMA of the 16-bit words to the data address of the display
+HAL_StatusTypeDef HAL_SRAM_Write_DMA(SRAM_HandleTypeDef * hsram, uint32_t * address, uint32_t * source, uint32_t size)
+{
+	if (halNT35510 == NULL) return (HAL_ERROR);
+	halNT35510->dmaInterrupt = sramInterrupt;
+	return (halNT35510->writeData((const uint16_t *)source, size, true, hsram->hdma->Init.PeriphInc == DMA_PINC_DISABLE) ? HAL_OK : HAL_BUSY);
+}
+
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef * hdma)
+{
+	return (HAL_OK);
+}
+
+
+__attribute__((weak)) void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef * hspi)
+{
+}
+
+
+__attribute__((weak)) void HAL_SPI_TxHalfCpltCallback(SPI_HandleTypeDef * hspi)
+{
+}
+
+
+__attribute__((weak)) void HAL_SRAM_DMA_XferCpltCallback(DMA_HandleTypeDef * hdma)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+uint8_t simulatorWaitDMA(void)
+{
+	DisplaySimulator * display = activeDisplay();
+	if (display) display->waitBus();
+	return (0);
+}
+
+
+// The SPI DMA moves the 8-bit data by 16-bit items
+uint32_t simulatorDMACounter(DMA_HandleTypeDef * hdma)
+{
+	if (halST7789 && halST7789->isDMAActive()) return ((uint32_t)(halST7789->dmaBytesLeft() >> 1));
+	return ((uint32_t)(dmaBytesLeft >> 1));
+}
+
+
+void simulatorIdle(void)
+{
+	DisplaySimulator * display = activeDisplay();
+	if (display) display->idle();
+}
+
+
+// A6 address line is the RS signal of the display (HADDR bit 7 on the 16-bit bus)
+void simulatorFSMCWrite(uint32_t address, uint16_t value)
+{
+	if (halNT35510 == NULL) return;
+	if (address & 0x80) halNT35510->writeData(&value, 1, false);
+	else halNT35510->writeRegister(value);
+}
+
+// END-OF-FILE
@@ -0,0 +1,199 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// The part of the STM32 HAL used by the display drivers of the examples,
+// implemented on top of the display simulator (see DisplaySimulator.h).
+// The SPI transfers go to the ST7789 simulator (the DC pin selects commands or data),
+// the FSMC writes go to the NT35510 simulator (A6 address line selects commands or data).
+// The DMA interrupts call the HAL callbacks (the drivers implement them)
+// in the virtual time of the simulator, and the wait loops of the display pipeline
+// spin until the next interrupt.
+
+// Includes
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+// The drivers define their own BIG_ENDIAN and LITTLE_ENDIAN
+#undef BIG_ENDIAN
+#undef LITTLE_ENDIAN
+
+
+#ifndef _SIMULATOR_HAL_
+#define _SIMULATOR_HAL_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __IO	volatile
+
+typedef enum
+{
+	HAL_OK = 0,
+	HAL_ERROR,
+	HAL_BUSY,
+	HAL_TIMEOUT
+} HAL_StatusTypeDef;
+
+#define HAL_MAX_DELAY		0xFFFFFFFFU
+
+
+// GPIO
+typedef struct
+{
+	uint8_t index;
+} GPIO_TypeDef;
+
+typedef enum
+{
+	GPIO_PIN_RESET = 0,
+	GPIO_PIN_SET
+} GPIO_PinState;
+
+extern GPIO_TypeDef simulatorGPIO[8];
+
+#define GPIOA				(&simulatorGPIO[0])
+#define GPIOB				(&simulatorGPIO[1])
+#define GPIOC				(&simulatorGPIO[2])
+#define GPIOD				(&simulatorGPIO[3])
+#define GPIOE				(&simulatorGPIO[4])
+#define GPIOF				(&simulatorGPIO[5])
+#define GPIOG				(&simulatorGPIO[6])
+
+#define GPIO_PIN_0			((uint16_t)0x0001)
+#define GPIO_PIN_1			((uint16_t)0x0002)
+#define GPIO_PIN_2			((uint16_t)0x0004)
+#define GPIO_PIN_3			((uint16_t)0x0008)
+#define GPIO_PIN_4			((uint16_t)0x0010)
+#define GPIO_PIN_5			((uint16_t)0x0020)
+#define GPIO_PIN_6			((uint16_t)0x0040)
+#define GPIO_PIN_7			((uint16_t)0x0080)
+#define GPIO_PIN_8			((uint16_t)0x0100)
+#define GPIO_PIN_9			((uint16_t)0x0200)
+#define GPIO_PIN_10			((uint16_t)0x0400)
+#define GPIO_PIN_11			((uint16_t)0x0800)
+#define GPIO_PIN_12			((uint16_t)0x1000)
+#define GPIO_PIN_13			((uint16_t)0x2000)
+#define GPIO_PIN_14			((uint16_t)0x4000)
+#define GPIO_PIN_15			((uint16_t)0x8000)
+
+
+// DMA
+typedef enum
+{
+	HAL_DMA_STATE_RESET = 0,
+	HAL_DMA_STATE_READY,
+	HAL_DMA_STATE_BUSY
+} HAL_DMA_StateTypeDef;
+
+#define DMA_NORMAL			0x00000000U
+#define DMA_CIRCULAR		0x00000020U
+#define DMA_PINC_DISABLE	0x00000000U
+#define DMA_PINC_ENABLE		0x00000040U
+#define DMA_MINC_DISABLE	0x00000000U
+#define DMA_MINC_ENABLE		0x00000080U
+
+typedef struct
+{
+	uint32_t Mode;
+	uint32_t PeriphInc;
+	uint32_t MemInc;
+} DMA_InitTypeDef;
+
+typedef struct
+{
+	HAL_DMA_StateTypeDef state[1];
+	DMA_InitTypeDef Init;
+} DMA_HandleTypeDef;
+
+// The drivers poll "hdma->State" in the WAIT_DMA loop.
+// Here the poll itself waits for the end of the simulated transfer
+// (i.e. the CPU spins until then) and always reads the ready state.
+#define State				state[simulatorWaitDMA()]
+
+// The channel is disabled between the transfers, the counter is read during the transfer or after the stop
+#define __HAL_DMA_DISABLE(handle)		((void)(handle))
+#define __HAL_DMA_GET_COUNTER(handle)	simulatorDMACounter(handle)
+
+
+// SPI and SRAM (FSMC)
+typedef struct
+{
+	DMA_HandleTypeDef * hdmatx;
+} SPI_HandleTypeDef;
+
+// A stopped DMA transfer delivers only the bytes sent, nothing is left in the SPI
+#define SPI_FLAG_BSY					0x00000080U
+#define __HAL_SPI_GET_FLAG(handle, flag)	((void)(handle), 0)
+
+typedef struct
+{
+	DMA_HandleTypeDef * hdma;
+} SRAM_HandleTypeDef;
+
+// FSMC writes of the NT35510 driver
+#define NT35510_WRITE_REGISTER(value)	simulatorFSMCWrite(NT35510_REG_ADDR, (value))
+#define NT35510_WRITE_DATA(value)		simulatorFSMCWrite(NT35510_DATA_ADDR, (value))
+
+// Wait loops of the display pipeline
+#define DISPLAY_PIPELINE_IDLE()			simulatorIdle()
+
+
+void HAL_Delay(uint32_t delay);
+void HAL_GPIO_WritePin(GPIO_TypeDef * port, uint16_t pin, GPIO_PinState state);
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef * hspi, uint8_t * data, uint16_t size, uint32_t timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef * hspi, uint8_t * data, uint16_t size);
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef * hspi);
+HAL_StatusTypeDef HAL_SRAM_Write_DMA(SRAM_HandleTypeDef * hsram, uint32_t * address, uint32_t * source, uint32_t size);
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef * hdma);
+
+// Interrupt callbacks (weak, as in the HAL)
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef * hspi);
+void HAL_SPI_TxHalfCpltCallback(SPI_HandleTypeDef * hspi);
+void HAL_SRAM_DMA_XferCpltCallback(DMA_HandleTypeDef * hdma);
+
+uint8_t simulatorWaitDMA(void);
+uint32_t simulatorDMACounter(DMA_HandleTypeDef * hdma);
+void simulatorIdle(void);
+void simulatorFSMCWrite(uint32_t address, uint16_t value);
+
+#ifdef __cplusplus
+}
+
+// The simulated displays and the DC pin of the SPI one (set by the pipeline)
+class ST7789Simulator;
+class NT35510Simulator;
+extern ST7789Simulator * halST7789;
+extern NT35510Simulator * halNT35510;
+extern GPIO_TypeDef * halDataCommandPort;
+extern uint16_t halDataCommandPin;
+#endif
+
+
+#endif // end _SIMULATOR_HAL_
+
+// END-OF-FILE
@@ -0,0 +1,4 @@
+// Host stand-in of the STM32 HAL header for the display simulator
+#include "SimulatorHal.h"
+
+// END-OF-FILE
@@ -0,0 +1,187 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// The pipeline of the STM32F407ZG example (NT35510 over FSMC with DMA and two buffers):
+// three 800x480 slides drawn by the unmodified driver and decompression code
+// of the example into the simulated display. The flat UI screen is drawn through
+// the buffers and with the fill requests of the decoder for comparison.
+
+// Includes
+extern "C" {
+#include "NT35510.h"
+}
+#include "decompression.h"
+#include "slide1.h"
+#include "slide2.h"
+#include "slide3.h"
+#include "DisplaySimulator.h"
+#include "Pipeline.h"
+
+#define PIPELINE_NAME				"nt35510-stm32"
+
+#define SLIDES_COUNT				3
+#define FRAMES_PER_BUFFER			(SLIDE1_IMAGE_WIDTH * SLIDE1_SQUARE_SIDE)
+#define BUFFERS_PER_SLIDE			(SLIDE1_IMAGE_HEIGHT / SLIDE1_SQUARE_SIDE)
+
+static_assert(FRAMES_PER_BUFFER <= NT35510_BUFFER_PIXELS, "The slide buffer doesn't fit into the display buffer");
+
+#define FLAT_PIXELS					((uint32_t)SLIDE1_IMAGE_WIDTH * SLIDE1_IMAGE_HEIGHT)
+// Frames per call of the decompression (up to 65535)
+#define FLAT_FRAMES_PER_CALL		(SLIDE1_IMAGE_WIDTH * 64)
+
+// The flat screen has no squares
+static const DecompressionContext flatDC = { 3, { 5, 6, 5 }, PIPELINE_FLAT_BLOCK_SIZE_BITS, { PIPELINE_FLAT_METHOD_BITS, PIPELINE_FLAT_METHOD_BITS, PIPELINE_FLAT_METHOD_BITS }, 16, false, SLIDE1_IMAGE_WIDTH, 0, 0, 0 };
+
+struct Slide
+{
+	const DecompressionContext * dc;
+	const uint8_t * data;
+};
+
+static const Slide slides[SLIDES_COUNT] = { { &slide1DC, slide1Data }, { &slide2DC, slide2Data }, { &slide3DC, slide3Data } };
+
+static uint16_t reference[SLIDE1_IMAGE_WIDTH * SLIDE1_IMAGE_HEIGHT];
+static uint8_t flatData[sizeof(reference) + sizeof(reference) / 64 + 8];
+
+static NT35510Simulator display;
+static double cpuTimePerPixel;
+
+
+// The whole slide decompressed by rows of squares (not timed)
+static void decompressReference(const Slide * slide)
+{
+	resetDecompression();
+	decompressionBufferWidth = SLIDE1_IMAGE_WIDTH;
+	for (uint16_t row = 0; row < SLIDE1_IMAGE_HEIGHT; row += SLIDE1_SQUARE_SIDE)
+	{
+		decompressNextFrames((DecompressionContext *)slide->dc, (uint8_t *)slide->data, &reference[(uint32_t)row * SLIDE1_IMAGE_WIDTH], FRAMES_PER_BUFFER, false);
+	}
+}
+
+
+// The driver for the fill requests of the decoder
+static uint16_t * flatGetBuffer(uint16_t * size)
+{
+	*size = NT35510_BUFFER_PIXELS;
+	return (NT35510_getPixelBuffer());
+}
+
+
+// Only the buffered pixels take the CPU time
+static void flatWritePixels(uint16_t * pixels, uint16_t count)
+{
+	display.addCpuTime(count * cpuTimePerPixel);
+	NT35510_writePixels(pixels, count);
+}
+
+
+static const DecompressionDisplay flatDisplay = { flatGetBuffer, flatWritePixels, NT35510_fillPixels, 0 };
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Usage: nt35510-stm32 [--hclk Hz] [--address-setup cycles] [--data-setup cycles] [--dma-overhead ns] [--interrupt-latency ns]
+//                      [--cpu-ns-per-pixel ns] [--output directory]
+int main(int argc, char ** argv)
+{
+	// HCLK 168 MHz, the FSMC timing of the example
+	display.setTiming(pipelineOption(argc, argv, "hclk", 168000000), pipelineOption(argc, argv, "address-setup", 10), pipelineOption(argc, argv, "data-setup", 60));
+	display.dmaOverhead = pipelineOption(argc, argv, "dma-overhead", 0);
+	display.interruptLatency = pipelineOption(argc, argv, "interrupt-latency", 0);
+	cpuTimePerPixel = pipelineOption(argc, argv, "cpu-ns-per-pixel", 0);
+
+	halNT35510 = &display;
+
+	// Initialization
+	display.beginPhase();
+	NT35510_init();
+	display.endPhase();
+	display.printReport(stdout, PIPELINE_NAME, "init", 0);
+
+	decompressionBufferWidth = SLIDE1_IMAGE_WIDTH;
+	NT35510_setWindow(0, 0, SLIDE1_IMAGE_WIDTH, SLIDE1_IMAGE_HEIGHT);
+
+	for (uint8_t i = 0; i < SLIDES_COUNT; i++)
+	{
+		char phase[16];
+		snprintf(phase, sizeof(phase), "slide%u", i + 1);
+
+		display.beginPhase();
+		NT35510_begin();
+		resetDecompression();
+		decompressionBufferWidth = SLIDE1_IMAGE_WIDTH;
+		for (uint16_t j = 0; j < BUFFERS_PER_SLIDE; j++)
+		{
+			uint16_t * currentScreenBuffer = NT35510_getPixelBuffer();
+			decompressNextFrames((DecompressionContext *)slides[i].dc, (uint8_t *)slides[i].data, currentScreenBuffer, FRAMES_PER_BUFFER, false);
+			display.addCpuTime(FRAMES_PER_BUFFER * cpuTimePerPixel);
+			NT35510_writePixels(currentScreenBuffer, FRAMES_PER_BUFFER);
+		}
+		NT35510_end();
+		display.endPhase();
+
+		decompressReference(&slides[i]);
+		display.printReport(stdout, PIPELINE_NAME, phase, pipelineCompare(display, 0, 0, SLIDE1_IMAGE_WIDTH, SLIDE1_IMAGE_HEIGHT, reference));
+
+		display.savePPM(pipelineImagePath(argc, argv, PIPELINE_NAME, phase));
+	}
+
+	// Flat screen: every pixel through the buffers
+	pipelineFlatScreen(reference, SLIDE1_IMAGE_WIDTH, SLIDE1_IMAGE_HEIGHT);
+	pipelineEncodeFlat(reference, FLAT_PIXELS, flatData);
+
+	display.beginPhase();
+	NT35510_begin();
+	resetDecompression();
+	for (uint32_t i = 0; i < FLAT_PIXELS; i += NT35510_BUFFER_PIXELS)
+	{
+		uint16_t frames = ((FLAT_PIXELS - i) > NT35510_BUFFER_PIXELS) ? NT35510_BUFFER_PIXELS : (FLAT_PIXELS - i);
+		uint16_t * currentScreenBuffer = NT35510_getPixelBuffer();
+		decompressNextFrames((DecompressionContext *)&flatDC, flatData, currentScreenBuffer, frames, false);
+		display.addCpuTime(frames * cpuTimePerPixel);
+		NT35510_writePixels(currentScreenBuffer, frames);
+	}
+	NT35510_end();
+	display.endPhase();
+	display.printReport(stdout, PIPELINE_NAME, "flat", pipelineCompare(display, 0, 0, SLIDE1_IMAGE_WIDTH, SLIDE1_IMAGE_HEIGHT, reference));
+
+	// The same screen with the constant blocks as the fill requests
+	display.beginPhase();
+	NT35510_begin();
+	resetDecompression();
+	for (uint32_t i = 0; i < FLAT_PIXELS; i += FLAT_FRAMES_PER_CALL)
+	{
+		uint16_t frames = ((FLAT_PIXELS - i) > FLAT_FRAMES_PER_CALL) ? FLAT_FRAMES_PER_CALL : (FLAT_PIXELS - i);
+		decompressNextFramesToDisplay((DecompressionContext *)&flatDC, flatData, &flatDisplay, frames);
+	}
+	NT35510_end();
+	display.endPhase();
+	display.printReport(stdout, PIPELINE_NAME, "flat-runs", pipelineCompare(display, 0, 0, SLIDE1_IMAGE_WIDTH, SLIDE1_IMAGE_HEIGHT, reference));
+	display.savePPM(pipelineImagePath(argc, argv, PIPELINE_NAME, "flat"));
+
+	return (0);
+}
+
+// END-OF-FILE
@@ -0,0 +1,220 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Common part of the display pipelines: command line options,
+// repeatable random numbers, the comparison of the panel image with the reference
+// and the flat UI screen (with its compressed stream) for the run fill requests.
+
+// Includes
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "DisplaySimulator.h"
+
+
+#ifndef _SIMULATOR_PIPELINE_
+#define _SIMULATOR_PIPELINE_
+
+// Icons drawn at each position of the screen (as in the examples)
+#define PIPELINE_ICONS_PER_POSITION		30
+
+// Compressed flat screen: 5-6-5 bits channels of RGB565 without squares,
+// the block size and the method declaration bits of its decompression context
+#define PIPELINE_FLAT_BLOCK_SIZE_BITS	10
+#define PIPELINE_FLAT_METHOD_BITS		3
+// Shorter runs of identical pixels go to the raw blocks
+#define PIPELINE_FLAT_MIN_RUN			8
+
+
+// Numeric option "--name value" or the default value
+static inline double pipelineOption(int argc, char ** argv, const char * name, double defaultValue)
+{
+	for (int i = 1; i < argc - 1; i++)
+	{
+		if ((argv[i][0] == '-') && (argv[i][1] == '-') && !strcmp(argv[i] + 2, name)) return (atof(argv[i + 1]));
+	}
+	return (defaultValue);
+}
+
+
+// String option "--name value" or the default value
+static inline const char * pipelineStringOption(int argc, char ** argv, const char * name, const char * defaultValue)
+{
+	for (int i = 1; i < argc - 1; i++)
+	{
+		if ((argv[i][0] == '-') && (argv[i][1] == '-') && !strcmp(argv[i] + 2, name)) return (argv[i + 1]);
+	}
+	return (defaultValue);
+}
+
+
+// Path of the image of the pipeline in the output directory ("--output", the current one by default)
+static inline const char * pipelineImagePath(int argc, char ** argv, const char * pipeline, const char * image)
+{
+	static char path[1024];
+	snprintf(path, sizeof(path), "%s/%s-%s.ppm", pipelineStringOption(argc, argv, "output", "."), pipeline, image);
+	return (path);
+}
+
+
+// The same sequence on every host (0...count-1)
+static inline uint32_t pipelineRandom(uint32_t count)
+{
+	static uint32_t state = 2463534242u;
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return (state % count);
+}
+
+
+// Number of the panel pixels in the region that differ from the reference image
+static inline uint32_t pipelineCompare(const DisplaySimulator & display, uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t * reference)
+{
+	uint32_t mismatches = 0;
+	for (uint16_t j = 0; j < height; j++)
+	{
+		for (uint16_t i = 0; i < width; i++)
+		{
+			if (display.getPixel(x + i, y + j) != reference[(uint32_t)j * width + i]) mismatches++;
+		}
+	}
+	return (mismatches);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Flat UI screen: the background, the title bar and the buttons of solid colors
+// with some "text" (the detailed pixels) on them
+static inline void pipelineFlatScreen(uint16_t * image, uint16_t width, uint16_t height)
+{
+	for (uint32_t i = 0; i < (uint32_t)width * height; i++) image[i] = 0x2104;
+
+	// Title bar, buttons and the status line: left, top, right, bottom (in 1/16 of the screen) and color
+	static const uint8_t rectangles[5][4] = { { 0, 0, 16, 2 }, { 1, 4, 7, 7 }, { 9, 4, 15, 7 }, { 1, 9, 15, 12 }, { 0, 15, 16, 16 } };
+	static const uint16_t rectangleColors[5] = { 0x03EF, 0x7BEF, 0xFBE0, 0x0400, 0x18E3 };
+
+	for (uint8_t r = 0; r < 5; r++)
+	{
+		uint16_t left = rectangles[r][0] * width / 16, right = rectangles[r][2] * width / 16;
+		uint16_t top = rectangles[r][1] * height / 16, bottom = rectangles[r][3] * height / 16;
+		for (uint16_t y = top; y < bottom; y++)
+		{
+			for (uint16_t x = left; x < right; x++)
+			{
+				// The text line in the middle of the rectangle
+				bool text = (x > left + (right - left) / 8) && (x < right - (right - left) / 4) &&
+					(y >= (top + bottom) / 2 - 4) && (y < (top + bottom) / 2 + 4) && ((((x * 7) ^ (y * 13) ^ (x * y)) & 3) == 0);
+				image[(uint32_t)y * width + x] = text ? 0xFFFF : rectangleColors[r];
+			}
+		}
+	}
+}
+
+
+// Bits of the compressed stream (MSB first)
+struct PipelineBitsWriter
+{
+	uint8_t * data;
+	size_t size;
+	uint8_t byte;
+	uint8_t bitsCount;
+
+	void write(uint32_t value, uint8_t bits)
+	{
+		while (bits--)
+		{
+			byte = (byte << 1) | ((value >> bits) & 1);
+			if (++bitsCount == 8)
+			{
+				data[size++] = byte;
+				byte = 0;
+				bitsCount = 0;
+			}
+		}
+	}
+};
+
+
+// Length of the run of identical pixels (up to the limit)
+static inline uint32_t pipelineRunLength(const uint16_t * image, uint32_t position, uint32_t pixels, uint32_t limit)
+{
+	uint32_t run = 1;
+	while ((position + run < pixels) && (run < limit) && (image[position + run] == image[position])) run++;
+	return (run);
+}
+
+
+// Compress the image by the constant blocks (all the channels with zero method
+// and the base values) for the runs and the raw blocks (the method equals
+// the channel width) for the rest. The data needs up to 2 bytes per pixel + 1%,
+// the decoder may read up to 4 bytes beyond its end (they are zero).
+static inline size_t pipelineEncodeFlat(const uint16_t * image, uint32_t pixels, uint8_t * data)
+{
+	static const uint8_t bitsPerChannels[3] = { 5, 6, 5 };
+	const uint32_t maxBlock = 1 << PIPELINE_FLAT_BLOCK_SIZE_BITS;
+	PipelineBitsWriter writer = { data, 0, 0, 0 };
+
+	for (uint32_t i = 0; i < pixels; )
+	{
+		uint32_t run = pipelineRunLength(image, i, pixels, maxBlock);
+		if (run >= PIPELINE_FLAT_MIN_RUN)
+		{
+			writer.write(run - 1, PIPELINE_FLAT_BLOCK_SIZE_BITS);
+			for (uint8_t c = 0, shift = 16; c < 3; c++)
+			{
+				shift -= bitsPerChannels[c];
+				writer.write(0, PIPELINE_FLAT_METHOD_BITS);
+				writer.write(image[i] >> shift, bitsPerChannels[c]);
+			}
+			i += run;
+			continue;
+		}
+
+		// The raw block up to the next long run
+		uint32_t end = i;
+		while ((end < pixels) && (end - i < maxBlock))
+		{
+			run = pipelineRunLength(image, end, pixels, maxBlock - (end - i));
+			if ((run >= PIPELINE_FLAT_MIN_RUN) && (end > i)) break;
+			end += run;
+		}
+
+		writer.write(end - i - 1, PIPELINE_FLAT_BLOCK_SIZE_BITS);
+		for (uint8_t c = 0; c < 3; c++) writer.write(bitsPerChannels[c], PIPELINE_FLAT_METHOD_BITS);
+		for (; i < end; i++) writer.write(image[i], 16);
+	}
+
+	writer.write(0, (8 - writer.bitsCount) & 7);
+	for (uint8_t i = 0; i < 4; i++) data[writer.size++] = 0;
+	return (writer.size);
+}
+
+
+#endif // end _SIMULATOR_PIPELINE_
+
+// END-OF-FILE
@@ -0,0 +1,170 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// The pipeline of the ESP32 example (ST7789 over the Arduino SPI library, no DMA):
+// the logo, the screen clearing and the random icons drawn by the unmodified
+// driver and decompression class of the example into the simulated display.
+// The Nano one has the same driver (except the pins).
+
+// Includes
+#include "ST7789.h"
+#include "Logo.h"
+#include "Icons.h"
+#include "DisplaySimulator.h"
+#include "Pipeline.h"
+
+#define PIPELINE_NAME				"st7789-arduino"
+
+#define FRAMES_PER_LOGO_BUFFER		(LOGO_IMAGE_WIDTH * LOGO_SQUARE_SIDE)
+#define BUFFERS_PER_LOGO			(LOGO_IMAGE_HEIGHT / LOGO_SQUARE_SIDE)
+#define FRAMES_PER_ICON_BUFFER		(ICONS_IMAGE_WIDTH * ICONS_SQUARE_SIDE)
+#define BUFFERS_PER_ICON			(ICONS_IMAGE_HEIGHT / ICONS_SQUARE_SIDE)
+
+static const uint8_t * icons[25] = { accessData, bluetoothData, bugData, buildData, cableData,
+	checkData, cloudData, editData, emojiData, errorData, handData, lightbulbData, memoryData,
+	notificationsData, personData, phoneData, powerData, sdData, smsData, starData, syncData,
+	thermostatData, thumbData, warningData, wifiData };
+
+static const uint16_t colors[7][4] = { { 0x0000, 0x5000, 0xA800, 0xF800 },		// Red
+									   { 0x0000, 0x02A0, 0x0540, 0x07E0 },		// Green
+									   { 0x0000, 0x000A, 0x0015, 0x001F },		// Blue
+									   { 0x0000, 0x52A0, 0xAD40, 0xFFE0 },		// Yellow
+									   { 0x0000, 0x02AA, 0x0555, 0x7FFF },		// Cyan
+									   { 0x0000, 0x500A, 0xA815, 0xF81F },		// Magenta
+									   { 0x0000, 0x52AA, 0xAD55, 0xFFFF } };	// White
+
+static Decompression decomp;
+static uint16_t decompressedData[FRAMES_PER_LOGO_BUFFER];
+static uint16_t reference[LOGO_IMAGE_WIDTH * LOGO_IMAGE_HEIGHT];
+
+static ST7789Simulator display;
+
+
+// The whole image decompressed by rows of squares (not timed)
+static void decompressReference(const DecompressionContext * dc, const uint8_t * data, uint16_t width, uint16_t height, uint8_t squareSide, const uint16_t * palette)
+{
+	decomp.resetDecompression();
+	decomp.bufferWidth = width;
+	for (uint16_t row = 0; row < height; row += squareSide)
+	{
+		uint16_t * buffer = &reference[(uint32_t)row * width];
+		if (palette)
+		{
+			DecompressionPaletteSink<> sink(buffer, palette);
+			decomp.decompressNextFrames(dc, data, sink, width * squareSide);
+		}
+		else decomp.decompressNextFrames(dc, data, buffer, width * squareSide, false);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Usage: st7789-arduino [--spi-clock Hz] [--call-overhead ns] [--cpu-ns-per-pixel ns] [--output directory]
+int main(int argc, char ** argv)
+{
+	// The clock the example passes to init()
+	uint32_t spiClock = pipelineOption(argc, argv, "spi-clock", 40000000);
+	display.callOverhead = pipelineOption(argc, argv, "call-overhead", 0);
+	double cpuTimePerPixel = pipelineOption(argc, argv, "cpu-ns-per-pixel", 0);
+
+	arduinoST7789 = &display;
+	arduinoDataCommandPin = DISPLAY_DC;
+
+	// Initialization (with the reset delays)
+	display.beginPhase();
+	ST7789.init(spiClock, DEFAULT_SPI_MODE, DEFAULT_ROTATION, LITTLE_ENDIAN);
+	display.endPhase();
+	display.printReport(stdout, PIPELINE_NAME, "init", 0);
+
+	// Logo
+	display.beginPhase();
+	ST7789.begin();
+	ST7789.setWindow(0, 0, LOGO_IMAGE_WIDTH, LOGO_IMAGE_HEIGHT);
+	decomp.resetDecompression();
+	decomp.bufferWidth = LOGO_IMAGE_WIDTH;
+	for (uint8_t i = 0; i < BUFFERS_PER_LOGO; i++)
+	{
+		decomp.decompressNextFrames(&logoDC, logoData, decompressedData, FRAMES_PER_LOGO_BUFFER, false);
+		display.addCpuTime(FRAMES_PER_LOGO_BUFFER * cpuTimePerPixel);
+		ST7789.writePixels(decompressedData, FRAMES_PER_LOGO_BUFFER, LITTLE_ENDIAN);
+	}
+	ST7789.end();
+	display.endPhase();
+
+	decompressReference(&logoDC, logoData, LOGO_IMAGE_WIDTH, LOGO_IMAGE_HEIGHT, LOGO_SQUARE_SIDE, NULL);
+	display.printReport(stdout, PIPELINE_NAME, "logo", pipelineCompare(display, 0, 0, LOGO_IMAGE_WIDTH, LOGO_IMAGE_HEIGHT, reference));
+	display.savePPM(pipelineImagePath(argc, argv, PIPELINE_NAME, "logo"));
+
+	// Clear screen
+	display.beginPhase();
+	ST7789.begin();
+	ST7789.fillColor(0);
+	ST7789.end();
+	display.endPhase();
+
+	// The logo covers the whole screen
+	memset(reference, 0, sizeof(reference));
+	display.printReport(stdout, PIPELINE_NAME, "clear", pipelineCompare(display, 0, 0, LOGO_IMAGE_WIDTH, LOGO_IMAGE_HEIGHT, reference));
+
+	// Icons: at every position of the screen, as the main loop of the example does
+	display.beginPhase();
+	uint32_t mismatches = 0;
+	for (uint8_t y = 0; y < DISPLAY_HEIGHT; y += ICONS_IMAGE_HEIGHT)
+	{
+		for (uint8_t x = 0; x < DISPLAY_WIDTH; x += ICONS_IMAGE_WIDTH)
+		{
+			for (uint8_t i = 0; i < PIPELINE_ICONS_PER_POSITION; i++)
+			{
+				ST7789.begin();
+				ST7789.setWindow(x, y, ICONS_IMAGE_WIDTH, ICONS_IMAGE_HEIGHT);
+				decomp.resetDecompression();
+				decomp.bufferWidth = ICONS_IMAGE_WIDTH;
+				const uint8_t * currentIcon = icons[pipelineRandom(25)];
+				const uint16_t * palette = colors[pipelineRandom(7)];
+
+				for (uint8_t j = 0; j < BUFFERS_PER_ICON; j++)
+				{
+					DecompressionPaletteSink<> sink(decompressedData, palette);
+					decomp.decompressNextFrames(&iconsDC, currentIcon, sink, FRAMES_PER_ICON_BUFFER);
+					display.addCpuTime(FRAMES_PER_ICON_BUFFER * cpuTimePerPixel);
+					ST7789.writePixels(decompressedData, FRAMES_PER_ICON_BUFFER, LITTLE_ENDIAN);
+				}
+				ST7789.end();
+
+				// Check the icon (the reference decompression doesn't take the virtual time)
+				decompressReference(&iconsDC, currentIcon, ICONS_IMAGE_WIDTH, ICONS_IMAGE_HEIGHT, ICONS_SQUARE_SIDE, palette);
+				mismatches += pipelineCompare(display, x, y, ICONS_IMAGE_WIDTH, ICONS_IMAGE_HEIGHT, reference);
+			}
+		}
+	}
+	display.endPhase();
+	display.printReport(stdout, PIPELINE_NAME, "icons", mismatches);
+	display.savePPM(pipelineImagePath(argc, argv, PIPELINE_NAME, "icons"));
+
+	return (0);
+}
+
+// END-OF-FILE
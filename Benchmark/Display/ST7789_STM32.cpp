@@ -0,0 +1,250 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// The pipeline of the STM32F070CB example (ST7789 over SPI with DMA):
+// the logo, the screen clearing and the random icons drawn by the unmodified
+// driver and decompression code of the example into the simulated display.
+// Also it is built with the circular DMA of the driver enabled.
+// The flat UI screen is drawn through the buffers and with the fill requests
+// of the decoder (decompressNextFramesToDisplay) for comparison.
+
+// Includes
+extern "C" {
+#include "ST7789.h"
+}
+#include "decompression.h"
+#include "logo.h"
+#include "icons.h"
+#include "DisplaySimulator.h"
+#include "Pipeline.h"
+
+#if defined(ST7789_USE_CIRCULAR_DMA)
+	#define PIPELINE_NAME			"st7789-stm32-circular"
+#else
+	#define PIPELINE_NAME			"st7789-stm32"
+#endif
+
+#define FRAMES_PER_LOGO_BUFFER		(LOGO_IMAGE_WIDTH * LOGO_SQUARE_SIDE)
+#define BUFFERS_PER_LOGO			(LOGO_IMAGE_HEIGHT / LOGO_SQUARE_SIDE)
+#define FRAMES_PER_ICON_BUFFER		(ICONS_IMAGE_WIDTH * ICONS_SQUARE_SIDE)
+#define BUFFERS_PER_ICON			(ICONS_IMAGE_HEIGHT / ICONS_SQUARE_SIDE)
+
+static const uint8_t * icons[25] = { accessData, bluetoothData, bugData, buildData, cableData,
+	checkData, cloudData, editData, emojiData, errorData, handData, lightbulbData, memoryData,
+	notificationsData, personData, phoneData, powerData, sdData, smsData, starData, syncData,
+	thermostatData, thumbData, warningData, wifiData };
+
+static const uint16_t colors[7][4] = { { 0x0000, 0x5000, 0xA800, 0xF800 },		// Red
+									   { 0x0000, 0x02A0, 0x0540, 0x07E0 },		// Green
+									   { 0x0000, 0x000A, 0x0015, 0x001F },		// Blue
+									   { 0x0000, 0x52A0, 0xAD40, 0xFFE0 },		// Yellow
+									   { 0x0000, 0x02AA, 0x0555, 0x7FFF },		// Cyan
+									   { 0x0000, 0x500A, 0xA815, 0xF81F },		// Magenta
+									   { 0x0000, 0x52AA, 0xAD55, 0xFFFF } };	// White
+
+static_assert((LOGO_IMAGE_WIDTH == ST7789_DISPLAY_WIDTH) && (LOGO_IMAGE_HEIGHT == ST7789_DISPLAY_HEIGHT), "The reference doesn't fit the screen");
+
+#define FLAT_PIXELS					((uint32_t)ST7789_DISPLAY_WIDTH * ST7789_DISPLAY_HEIGHT)
+
+// The flat screen has no squares
+static const DecompressionContext flatDC = { 3, { 5, 6, 5 }, PIPELINE_FLAT_BLOCK_SIZE_BITS, { PIPELINE_FLAT_METHOD_BITS, PIPELINE_FLAT_METHOD_BITS, PIPELINE_FLAT_METHOD_BITS }, 16, false, ST7789_DISPLAY_WIDTH, 0, 0, 0 };
+
+static uint16_t reference[LOGO_IMAGE_WIDTH * LOGO_IMAGE_HEIGHT];
+static uint8_t flatData[sizeof(reference) + sizeof(reference) / 64 + 8];
+
+static ST7789Simulator display;
+static double cpuTimePerPixel;
+
+
+// The whole image decompressed by rows of squares (not timed)
+static void decompressReference(const DecompressionContext * dc, const uint8_t * data, uint16_t width, uint16_t height, uint8_t squareSide, const uint16_t * palette)
+{
+	resetDecompression();
+	decompressionBufferWidth = width;
+	for (uint16_t row = 0; row < height; row += squareSide)
+	{
+		uint16_t * buffer = &reference[(uint32_t)row * width];
+		if (palette) decompressNextFramesWithPalette((DecompressionContext *)dc, (uint8_t *)data, buffer, width * squareSide, palette);
+		else decompressNextFrames((DecompressionContext *)dc, (uint8_t *)data, buffer, width * squareSide, false);
+	}
+}
+
+
+// The driver for the fill requests of the decoder
+static uint16_t * flatGetBuffer(uint16_t * size)
+{
+	*size = ST7789_BUFFER_PIXELS;
+	return (ST7789_getPixelBuffer());
+}
+
+
+// Only the buffered pixels take the CPU time
+static void flatWritePixels(uint16_t * pixels, uint16_t count)
+{
+	display.addCpuTime(count * cpuTimePerPixel);
+	ST7789_writePixels(pixels, count, LITTLE_ENDIAN);
+}
+
+
+static void flatFillPixels(uint16_t color, uint32_t count)
+{
+	while (count)
+	{
+		uint16_t part = (count > 0xFFFF) ? 0xFFFF : count;
+		ST7789_fillPixels(color, part);
+		count -= part;
+	}
+}
+
+
+static const DecompressionDisplay flatDisplay = { flatGetBuffer, flatWritePixels, flatFillPixels, 0 };
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Usage: st7789-stm32 [--spi-clock Hz] [--call-overhead ns] [--dma-overhead ns] [--interrupt-latency ns] [--cpu-ns-per-pixel ns]
+//                     [--name pipeline] [--output directory]
+int main(int argc, char ** argv)
+{
+	const char * name = pipelineStringOption(argc, argv, "name", PIPELINE_NAME);
+
+	// SYSCLK 24 MHz, SPI prescaler 4
+	display.spiClock = pipelineOption(argc, argv, "spi-clock", 6000000);
+	display.callOverhead = pipelineOption(argc, argv, "call-overhead", 0);
+	display.dmaOverhead = pipelineOption(argc, argv, "dma-overhead", 0);
+	display.interruptLatency = pipelineOption(argc, argv, "interrupt-latency", 0);
+	cpuTimePerPixel = pipelineOption(argc, argv, "cpu-ns-per-pixel", 0);
+
+	halST7789 = &display;
+	halDataCommandPort = ST7789_DC_PORT;
+	halDataCommandPin = ST7789_DC_PIN;
+
+	// Initialization (with the reset delays)
+	display.beginPhase();
+	ST7789_initWithParams(1, LITTLE_ENDIAN);
+	display.endPhase();
+	display.printReport(stdout, name, "init", 0);
+
+	// Logo
+	display.beginPhase();
+	ST7789_begin();
+	ST7789_setWindow(0, 0, LOGO_IMAGE_WIDTH, LOGO_IMAGE_HEIGHT);
+	resetDecompression();
+	decompressionBufferWidth = LOGO_IMAGE_WIDTH;
+	for (uint8_t i = 0; i < BUFFERS_PER_LOGO; i++)
+	{
+		uint16_t * currentScreenBuffer = ST7789_getPixelBuffer();
+		decompressNextFrames((DecompressionContext *)&logoDC, (uint8_t *)logoData, currentScreenBuffer, FRAMES_PER_LOGO_BUFFER, false);
+		display.addCpuTime(FRAMES_PER_LOGO_BUFFER * cpuTimePerPixel);
+		ST7789_writePixels(currentScreenBuffer, FRAMES_PER_LOGO_BUFFER, LITTLE_ENDIAN);
+	}
+	ST7789_end();
+	display.endPhase();
+
+	decompressReference(&logoDC, logoData, LOGO_IMAGE_WIDTH, LOGO_IMAGE_HEIGHT, LOGO_SQUARE_SIDE, NULL);
+	display.printReport(stdout, name, "logo", pipelineCompare(display, 0, 0, LOGO_IMAGE_WIDTH, LOGO_IMAGE_HEIGHT, reference));
+	display.savePPM(pipelineImagePath(argc, argv, name, "logo"));
+
+	// Clear screen
+	display.beginPhase();
+	ST7789_begin();
+	ST7789_fillColor(0);
+	ST7789_end();
+	display.endPhase();
+
+	// The logo covers the whole screen
+	memset(reference, 0, sizeof(reference));
+	display.printReport(stdout, name, "clear", pipelineCompare(display, 0, 0, LOGO_IMAGE_WIDTH, LOGO_IMAGE_HEIGHT, reference));
+
+	// Icons: at every position of the screen, as the main loop of the example does
+	display.beginPhase();
+	uint32_t mismatches = 0;
+	for (uint8_t y = 0; y < ST7789_DISPLAY_HEIGHT; y += ICONS_IMAGE_HEIGHT)
+	{
+		for (uint8_t x = 0; x < ST7789_DISPLAY_WIDTH; x += ICONS_IMAGE_WIDTH)
+		{
+			for (uint8_t i = 0; i < PIPELINE_ICONS_PER_POSITION; i++)
+			{
+				ST7789_begin();
+				ST7789_setWindow(x, y, ICONS_IMAGE_WIDTH, ICONS_IMAGE_HEIGHT);
+				resetDecompression();
+				decompressionBufferWidth = ICONS_IMAGE_WIDTH;
+				const uint8_t * currentIcon = icons[pipelineRandom(25)];
+				const uint16_t * palette = colors[pipelineRandom(7)];
+
+				for (uint8_t j = 0; j < BUFFERS_PER_ICON; j++)
+				{
+					uint16_t * currentScreenBuffer = ST7789_getPixelBuffer();
+					decompressNextFramesWithPalette((DecompressionContext *)&iconsDC, (uint8_t *)currentIcon, currentScreenBuffer, FRAMES_PER_ICON_BUFFER, palette);
+					display.addCpuTime(FRAMES_PER_ICON_BUFFER * cpuTimePerPixel);
+					ST7789_writePixels(currentScreenBuffer, FRAMES_PER_ICON_BUFFER, LITTLE_ENDIAN);
+				}
+				ST7789_end();
+
+				// Check the icon (the reference decompression doesn't take the virtual time)
+				decompressReference(&iconsDC, currentIcon, ICONS_IMAGE_WIDTH, ICONS_IMAGE_HEIGHT, ICONS_SQUARE_SIDE, palette);
+				mismatches += pipelineCompare(display, x, y, ICONS_IMAGE_WIDTH, ICONS_IMAGE_HEIGHT, reference);
+			}
+		}
+	}
+	display.endPhase();
+	display.printReport(stdout, name, "icons", mismatches);
+	display.savePPM(pipelineImagePath(argc, argv, name, "icons"));
+
+	// Flat screen: every pixel through the buffers
+	pipelineFlatScreen(reference, ST7789_DISPLAY_WIDTH, ST7789_DISPLAY_HEIGHT);
+	pipelineEncodeFlat(reference, FLAT_PIXELS, flatData);
+
+	display.beginPhase();
+	ST7789_begin();
+	ST7789_setWindow(0, 0, ST7789_DISPLAY_WIDTH, ST7789_DISPLAY_HEIGHT);
+	resetDecompression();
+	for (uint32_t i = 0; i < FLAT_PIXELS; i += ST7789_BUFFER_PIXELS)
+	{
+		uint16_t frames = ((FLAT_PIXELS - i) > ST7789_BUFFER_PIXELS) ? ST7789_BUFFER_PIXELS : (FLAT_PIXELS - i);
+		uint16_t * currentScreenBuffer = ST7789_getPixelBuffer();
+		decompressNextFrames((DecompressionContext *)&flatDC, flatData, currentScreenBuffer, frames, false);
+		display.addCpuTime(frames * cpuTimePerPixel);
+		ST7789_writePixels(currentScreenBuffer, frames, LITTLE_ENDIAN);
+	}
+	ST7789_end();
+	display.endPhase();
+	display.printReport(stdout, name, "flat", pipelineCompare(display, 0, 0, ST7789_DISPLAY_WIDTH, ST7789_DISPLAY_HEIGHT, reference));
+
+	// The same screen with the constant blocks as the fill requests
+	display.beginPhase();
+	ST7789_begin();
+	ST7789_setWindow(0, 0, ST7789_DISPLAY_WIDTH, ST7789_DISPLAY_HEIGHT);
+	resetDecompression();
+	decompressNextFramesToDisplay((DecompressionContext *)&flatDC, flatData, &flatDisplay, FLAT_PIXELS);
+	ST7789_end();
+	display.endPhase();
+	display.printReport(stdout, name, "flat-runs", pipelineCompare(display, 0, 0, ST7789_DISPLAY_WIDTH, ST7789_DISPLAY_HEIGHT, reference));
+	display.savePPM(pipelineImagePath(argc, argv, name, "flat"));
+
+	return (0);
+}
+
+// END-OF-FILE
@@ -29,26 +29,9 @@ SOFTWARE.
 #define MASK16_FOR_BITS_COUNT(x)  (0xFFFF >> (16 - x))
 
 // Includes
-#include "decompression.h"
+#include "Decompression.h"
 #include <stdlib.h>
-
-
-////////////////////////////////////////////////////////////////////////////////////////
-
-// Local variables
-uint32_t inputBitsBuffer;
-uint32_t inputByteIndex;
-uint8_t inputBitsCount;
-
-uint16_t currentBlockFramesCount;
-uint8_t currentBlockMethods[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
-uint8_t currentBaseValues[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
-
-uint16_t outputBitsBuffer;
-uint8_t outputBitsCount;
-
-uint16_t decompressionBufferWidth;
-
+#include <string.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////
 
@@ -63,34 +46,18 @@ uint16_t __attribute__((weak)) colorizePixel(uint16_t frame) {
 	return (frame);
 }
 
+
 ////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////
 
-// Read compressed data
-uint16_t readNextBits(uint8_t * compressedData, uint8_t bitsCount)
-{
-	if (!bitsCount) return (0);
-
-	while (inputBitsCount < bitsCount) {
-		inputBitsBuffer <<= 8;
-		inputBitsBuffer |= compressedData[inputByteIndex];
-		inputBitsCount += 8;
-		inputByteIndex++;
-	}
-
-	uint16_t bits = (inputBitsBuffer >> (inputBitsCount - bitsCount)) & MASK16_FOR_BITS_COUNT(bitsCount);
-	inputBitsCount -= bitsCount;
-
-	return (bits);
-}
-
-////////////////////////////////////////////////////////////////////////////////////////
-
 // Clear runtime variables
-void resetDecompression()
+void Decompression::resetDecompression()
 {
 	inputBitsBuffer = 0;
+#if defined(USE_FAR_MEMORY_CHUNKS)
+	inputChunkIndex = 0;
+#endif
 	inputByteIndex = 0;
 	inputBitsCount = 0;
 
@@ -100,10 +67,16 @@ void resetDecompression()
 	outputBitsCount = 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////
+
 // Batch decompression (specified number of frames)
-// Let's change buffer type to our pixel format, i.e. uint16_t,
+// Let's change buffer type to our pixel formats, i.e. uint16_t (RGB565, RGB555, RGB444),
 // and add colorize flag to call another one delegate method.
-void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, uint16_t * decompressedData, uint16_t framesCount, bool colorize)
+#if defined(USE_FAR_MEMORY_CHUNKS)
+void Decompression::decompressNextFrames(DecompressionContext * dc, uint_farptr_t * compressedData, uint16_t * decompressedData, uint16_t framesCount, bool colorize)
+#else
+void Decompression::decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, uint16_t * decompressedData, uint16_t framesCount, bool colorize)
+#endif
 {
 #if defined(DECOMPRESSION_USE_SQUARES)
 	uint8_t row = 0;
@@ -112,7 +85,7 @@ void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, u
 	uint16_t squareLineOffset = 0;
 #endif
 
-    uint16_t dataOffset = 0;
+	uint16_t dataOffset = 0;
 
 #if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
 	bool * afw = (bool *)malloc(dc->numberOfChannels);
@@ -159,7 +132,7 @@ void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, u
 						afw[c] = true;
 # endif
 
-                    }
+					}
 
 #elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_ONLY)
 					afw[c] = true;
@@ -189,7 +162,7 @@ void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, u
 					if (afw[c])
 					{
 						if (!firstFrame)
-						{
+						{            
 							uint8_t windowWidth = (uint8_t)1 << currentBlockMethods[c];
 							uint8_t halfWindowWidth = windowWidth >> 1;
 							uint8_t maxWindowStart = MASK8_FOR_BITS_COUNT(dc->bitsPerChannels[c]) - windowWidth + 1;
@@ -197,7 +170,7 @@ void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, u
 							if (halfWindowWidth < decompressedValue) {
 								decompressedValue -= halfWindowWidth;
 								if (decompressedValue > maxWindowStart) decompressedValue = maxWindowStart;
-							}
+							} 
 							else
 							{
 								decompressedValue = 0;
@@ -235,6 +208,7 @@ void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, u
 			}
 
 #if defined(DECOMPRESSION_USE_SQUARES)
+			// Calculate data offset within the buffer if split into squares used
 			bool rowChanged = false;
 			if (dc->splitToSquares)
 			{
@@ -258,7 +232,7 @@ void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, u
 
 				// We will use a buffer consisting of whole pixels, i.e. in our case it is uint16_t or 2 bytes.
 				// Therefore, we do not need to calculate the offset inside the buffer in bytes/bits.
-				if (rowChanged) dataOffset = (squareLineOffset + squareOffset + row * decompressionBufferWidth + column);
+				if (rowChanged) dataOffset = (squareLineOffset + squareOffset + row * bufferWidth + column);
 			}
 #endif
 
@@ -277,4 +251,86 @@ void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, u
 
 }
 
+// Read compressed data (two options for near and far memory).
+// The stream is MSB-first, so each refill appends one big-endian 16-bit word
+// to the bit buffer instead of looping over single bytes. The refill happens
+// only when the buffer holds fewer bits than requested (at most 15 remain),
+// so 32 bits of buffer are always enough. The last refill may fetch 1 byte
+// beyond the end of the compressed data, so the data must be followed by
+// DECOMPRESSION_DATA_PADDING zero bytes (they are never used).
+#if defined(USE_FAR_MEMORY_CHUNKS)
+
+void Decompression::refillBits(uint_farptr_t * compressedData)
+{
+	// Chunk size is even and the index always grows by 2,
+	// so the word never straddles two chunks.
+	uint16_t word = pgm_read_word_far(compressedData[inputChunkIndex] + inputByteIndex); // Read far word
+	inputBitsBuffer <<= 16;
+	inputBitsBuffer |= __builtin_bswap16(word);
+	inputBitsCount += 16;
+	inputByteIndex += 2;
+
+	// Check if next address is outside the chunk
+	if (inputByteIndex >= CHUNK_SIZE) {
+		inputChunkIndex++;
+		inputByteIndex = 0;
+	}
+}
+
+uint16_t Decompression::peekNextBits(uint_farptr_t * compressedData, uint8_t bitsCount)
+{
+	if (inputBitsCount < bitsCount) refillBits(compressedData);
+	// 32-bit mask works for zero bits as well, so there's no need for a separate check
+	return ((inputBitsBuffer >> (inputBitsCount - bitsCount)) & (((uint32_t)1 << bitsCount) - 1));
+}
+
+uint16_t Decompression::readNextBits(uint_farptr_t * compressedData, uint8_t bitsCount)
+{
+	uint16_t bits = peekNextBits(compressedData, bitsCount);
+	skipBits(bitsCount);
+	return (bits);
+}
+
+#else
+
+void Decompression::refillBits(uint8_t * compressedData)
+{
+#if defined(AVR)
+	uint16_t word = __builtin_bswap16(pgm_read_word(compressedData + inputByteIndex));
+#else
+	// memcpy is the portable unaligned load (a single instruction where the core allows it)
+	uint16_t word;
+	memcpy(&word, compressedData + inputByteIndex, sizeof(word));
+# if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	word = __builtin_bswap16(word);
+# endif
+#endif
+	inputBitsBuffer <<= 16;
+	inputBitsBuffer |= word;
+	inputBitsCount += 16;
+	inputByteIndex += 2;
+}
+
+uint16_t Decompression::peekNextBits(uint8_t * compressedData, uint8_t bitsCount)
+{
+	if (inputBitsCount < bitsCount) refillBits(compressedData);
+	// 32-bit mask works for zero bits as well, so there's no need for a separate check
+	return ((inputBitsBuffer >> (inputBitsCount - bitsCount)) & (((uint32_t)1 << bitsCount) - 1));
+}
+
+uint16_t Decompression::readNextBits(uint8_t * compressedData, uint8_t bitsCount)
+{
+	uint16_t bits = peekNextBits(compressedData, bitsCount);
+	skipBits(bitsCount);
+	return (bits);
+}
+
+#endif
+
+// Consume bits that were already peeked
+void Decompression::skipBits(uint8_t bitsCount)
+{
+	inputBitsCount -= bitsCount;
+}
+
 // END-OF-FILE
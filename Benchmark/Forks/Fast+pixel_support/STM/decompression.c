@@ -31,6 +31,7 @@ SOFTWARE.
 // Includes
 #include "decompression.h"
 #include <stdlib.h>
+#include <string.h>
 
 
 ////////////////////////////////////////////////////////////////////////////////////////
@@ -67,21 +68,44 @@ uint16_t __attribute__((weak)) colorizePixel(uint16_t frame) {
 ////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////
 
-// Read compressed data
-uint16_t readNextBits(uint8_t * compressedData, uint8_t bitsCount)
+// Read compressed data.
+// The stream is MSB-first, so each refill appends one big-endian 16-bit word
+// to the bit buffer instead of looping over single bytes. The refill happens
+// only when the buffer holds fewer bits than requested (at most 15 remain),
+// so 32 bits of buffer are always enough. The last refill may fetch 1 byte
+// beyond the end of the compressed data, so the data must be followed by
+// DECOMPRESSION_DATA_PADDING zero bytes (they are never used).
+static inline void refillBits(uint8_t * compressedData)
 {
-	if (!bitsCount) return (0);
+	// memcpy is the portable unaligned load (Cortex-M0 gets byte loads, M3/M4 a single LDRH)
+	uint16_t word;
+	memcpy(&word, compressedData + inputByteIndex, sizeof(word));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	word = __builtin_bswap16(word);
+#endif
+	inputBitsBuffer <<= 16;
+	inputBitsBuffer |= word;
+	inputBitsCount += 16;
+	inputByteIndex += 2;
+}
 
-	while (inputBitsCount < bitsCount) {
-		inputBitsBuffer <<= 8;
-		inputBitsBuffer |= compressedData[inputByteIndex];
-		inputBitsCount += 8;
-		inputByteIndex++;
-	}
+static inline uint16_t peekNextBits(uint8_t * compressedData, uint8_t bitsCount)
+{
+	if (inputBitsCount < bitsCount) refillBits(compressedData);
+	// 32-bit mask works for zero bits as well, so there's no need for a separate check
+	return ((inputBitsBuffer >> (inputBitsCount - bitsCount)) & (((uint32_t)1 << bitsCount) - 1));
+}
 
-	uint16_t bits = (inputBitsBuffer >> (inputBitsCount - bitsCount)) & MASK16_FOR_BITS_COUNT(bitsCount);
+// Consume bits that were already peeked
+static inline void skipBits(uint8_t bitsCount)
+{
 	inputBitsCount -= bitsCount;
+}
 
+uint16_t readNextBits(uint8_t * compressedData, uint8_t bitsCount)
+{
+	uint16_t bits = peekNextBits(compressedData, bitsCount);
+	skipBits(bitsCount);
 	return (bits);
 }
 
@@ -0,0 +1,537 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Auxilary macro
+#define MASK8_FOR_BITS_COUNT(x)  (0xFF >> (8 - x))
+
+// Shorter runs of identical frames are written frame by frame (bulk fill doesn't pay off)
+#define DECOMPRESSION_BULK_FILL_THRESHOLD	16
+
+// Block decoding plans (chosen once per block header)
+#define DECOMPRESSION_PLAN_CONSTANT	0	// All channels keep their base values
+#define DECOMPRESSION_PLAN_FIXED	1	// Fixed window (or raw) channels only
+#define DECOMPRESSION_PLAN_ADAPTIVE	2	// At least one channel uses the adaptive floating window
+
+// Output modes (chosen once per decompressNextFrames() call)
+#define DECOMPRESSION_OUTPUT_BYTES	0	// Whole bytes to the buffer
+#define DECOMPRESSION_OUTPUT_PACKED	1	// 1-2-4 bits frames packed into the buffer bytes
+#define DECOMPRESSION_OUTPUT_DELEGATE	2	// frameDecompressed() call per frame
+
+// Includes
+#include "Decompression.h"
+#include <stdlib.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Weak delegate method
+void __attribute__((weak)) frameDecompressed(uint16_t frame) {
+	// Do not delete this function
+}
+
+// Weak delegate method for a run of identical frames (constant blocks).
+// Override it to output the whole run at once.
+void __attribute__((weak)) frameRunDecompressed(uint16_t frame, uint16_t count) {
+	while (count--) frameDecompressed(frame);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Clear runtime variables
+void Decompression::resetDecompression()
+{
+	inputBitsBuffer = 0;
+#if defined(USE_FAR_MEMORY_CHUNKS)
+	inputChunkIndex = 0;
+#endif
+	inputByteIndex = 0;
+	inputBitsCount = 0;
+
+	currentBlockFramesCount = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Batch decompression (specified number of frames)
+void Decompression::decompressNextFrames(DecompressionContext * dc, CompressedDataPointer compressedData, uint8_t * decompressedData, uint16_t framesCount)
+{
+#if defined(DECOMPRESSION_USE_SQUARES)
+	uint8_t row = 0;
+	uint8_t column = 0;
+	uint16_t squareOffset = 0;
+	uint16_t squareLineOffset = 0;
+#endif
+
+	uint16_t dataOffset = 0;
+	uint8_t bitOffset = 0;
+
+	// The output mode doesn't change during the call, so we choose it once
+	uint8_t outputMode = DECOMPRESSION_OUTPUT_DELEGATE;
+	if (decompressedData)
+	{
+		if ((dc->bitsPerFrame % 8) == 0) outputMode = DECOMPRESSION_OUTPUT_BYTES;
+#if defined(FRAMES_LESS_THAN_BYTE_USED)
+		else if ((8 % dc->bitsPerFrame) == 0) outputMode = DECOMPRESSION_OUTPUT_PACKED;
+#endif
+		// Otherwise the frame width is not a multiple of 1, 2, 4 or 8 bits,
+		// so we must ask the delegate for help.
+	}
+
+	while (framesCount > 0)
+	{
+		if (currentBlockFramesCount == 0)
+		{
+			readBlockHeader(dc, compressedData);
+		}
+
+		// The run of frames that can be decompressed by a single specialized loop
+		uint16_t runLength = (framesCount < currentBlockFramesCount) ? framesCount : currentBlockFramesCount;
+
+#if defined(DECOMPRESSION_USE_SQUARES)
+		// The run must not cross the row of the square
+		if (dc->splitToSquares && (runLength > (uint16_t)(dc->squareSide - column))) runLength = dc->squareSide - column;
+#endif
+
+		decompressRun(dc, compressedData, decompressedData, dataOffset, bitOffset, runLength, outputMode);
+
+		framesCount -= runLength;
+		currentBlockFramesCount -= runLength;
+
+#if defined(DECOMPRESSION_USE_SQUARES)
+		// Calculate data offset within the buffer if split into squares used
+		if (dc->splitToSquares)
+		{
+			column += runLength;
+			if (column >= dc->squareSide)
+			{
+				row++;
+				if (row >= dc->squareSide)
+				{
+					squareOffset += dc->squareSide;
+					if (squareOffset >= dc->imageWidth)
+					{
+						squareLineOffset += dc->squaresPerWidthSize;
+						squareOffset = 0;
+					}
+					row = 0;
+				}
+				column = 0;
+
+#if defined(FRAMES_LESS_THAN_BYTE_USED)
+				uint32_t bitsDataOffset = (squareLineOffset + squareOffset + row * bufferWidth + column) * dc->bitsPerFrame;
+				dataOffset = bitsDataOffset >> 3;
+				bitOffset = bitsDataOffset - (dataOffset << 3);
+#else
+				dataOffset = (squareLineOffset + squareOffset + row * bufferWidth + column) * (dc->bitsPerFrame >> 3);
+#endif
+
+			}
+		}
+#endif
+
+	}
+
+}
+
+// Read the block header: length, methods and base values for every channel
+void Decompression::readBlockHeader(DecompressionContext * dc, CompressedDataPointer compressedData)
+{
+	currentBlockFramesCount = readNextBits(compressedData, dc->blockSizeBits);
+	currentBlockFramesCount++; // 0 value doesn't make any sense to us, so let's get rid of it to save bits.
+
+	uint8_t plan = DECOMPRESSION_PLAN_CONSTANT;
+
+	for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+	{
+		currentBlockMethods[c] = readNextBits(compressedData, dc->bitsPerMethodDeclaration[c]);
+
+		if (currentBlockMethods[c] != dc->bitsPerChannels[c])
+		{
+			currentBaseValues[c] = readNextBits(compressedData, dc->bitsPerChannels[c]);
+
+#if defined(DECOMPRESSION_FIXED_WINDOW_FIRST) || defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_FIRST)
+			if (currentBlockMethods[c] > dc->bitsPerChannels[c])
+			{
+				currentBlockMethods[c] -= dc->bitsPerChannels[c];
+
+# if defined(DECOMPRESSION_FIXED_WINDOW_FIRST)
+				currentBlockAFW[c] = true;
+# elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_FIRST)
+				currentBlockAFW[c] = false;
+# endif
+
+			}
+			else
+			{
+
+# if defined(DECOMPRESSION_FIXED_WINDOW_FIRST)
+				currentBlockAFW[c] = false;
+# elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_FIRST)
+				currentBlockAFW[c] = true;
+# endif
+
+			}
+
+#elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_ONLY)
+			currentBlockAFW[c] = true;
+#endif
+
+		}
+		else
+		{
+			currentBaseValues[c] = 0;
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+			currentBlockAFW[c] = false;
+#endif
+
+		}
+
+		// Channels with zero method are constant and don't affect the plan
+		if (currentBlockMethods[c])
+		{
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+			if (currentBlockAFW[c]) plan = DECOMPRESSION_PLAN_ADAPTIVE;
+			else
+#endif
+
+			if (plan == DECOMPRESSION_PLAN_CONSTANT) plan = DECOMPRESSION_PLAN_FIXED;
+		}
+	}
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+	currentBlockFirstFrame = true;
+#endif
+
+	currentBlockPlan = plan;
+}
+
+// Write the frame to the output (the mode is a template parameter, so the choice costs nothing)
+template <uint8_t output>
+static inline void writeFrame(DecompressionContext * dc, uint8_t * decompressedData, uint16_t & dataOffset, uint8_t & bitOffset, uint16_t frame)
+{
+	if (output == DECOMPRESSION_OUTPUT_BYTES)
+	{
+		if (dc->bitsPerFrame > 8) decompressedData[dataOffset++] = frame >> 8;
+		decompressedData[dataOffset++] = frame & 0xFF;
+	}
+
+#if defined(FRAMES_LESS_THAN_BYTE_USED)
+	else if (output == DECOMPRESSION_OUTPUT_PACKED)
+	{
+		uint8_t storedBufferData = (bitOffset == 0) ? 0 : decompressedData[dataOffset];
+
+		storedBufferData |= (frame << (8 - dc->bitsPerFrame - bitOffset));
+		decompressedData[dataOffset] = storedBufferData;
+
+		bitOffset += dc->bitsPerFrame;
+		if (bitOffset >= 8)
+		{
+			dataOffset++;
+			bitOffset = 0;
+		}
+	}
+#endif
+
+	else if (output == DECOMPRESSION_OUTPUT_DELEGATE)
+	{
+		frameDecompressed(frame);
+	}
+}
+
+// Write the run of identical frames (constant block) as a bulk fill
+template <uint8_t output>
+static inline void writeFrameRun(DecompressionContext * dc, uint8_t * decompressedData, uint16_t & dataOffset, uint8_t & bitOffset, uint16_t frame, uint16_t framesCount)
+{
+	if ((output != DECOMPRESSION_OUTPUT_DELEGATE) && (framesCount < DECOMPRESSION_BULK_FILL_THRESHOLD))
+	{
+		while (framesCount > 0)
+		{
+			writeFrame<output>(dc, decompressedData, dataOffset, bitOffset, frame);
+			framesCount--;
+		}
+		return;
+	}
+
+	if (output == DECOMPRESSION_OUTPUT_BYTES)
+	{
+		uint8_t * runStart = decompressedData + dataOffset;
+		uint8_t frameSize = dc->bitsPerFrame >> 3;
+		uint16_t runSize = framesCount * frameSize;
+
+		if (frameSize == 1)
+		{
+			memset(runStart, frame, runSize);
+		}
+		else
+		{
+			// Write the first frame and then keep doubling the filled part
+			for (uint8_t i = frameSize; i > 0; i--)
+			{
+				runStart[i - 1] = frame & 0xFF;
+				frame >>= 8;
+			}
+
+			for (uint16_t filled = frameSize; filled < runSize; filled <<= 1)
+			{
+				memcpy(runStart + filled, runStart, ((runSize - filled) < filled) ? (runSize - filled) : filled);
+			}
+		}
+
+		dataOffset += runSize;
+	}
+
+#if defined(FRAMES_LESS_THAN_BYTE_USED)
+	else if (output == DECOMPRESSION_OUTPUT_PACKED)
+	{
+		// Complete the partially filled byte
+		while ((framesCount > 0) && (bitOffset != 0))
+		{
+			writeFrame<output>(dc, decompressedData, dataOffset, bitOffset, frame);
+			framesCount--;
+		}
+
+		// Then fill whole bytes with the repeated frame
+		uint8_t framesPerByte = 8 / dc->bitsPerFrame;
+		uint8_t pattern = 0;
+		for (uint8_t i = 0; i < framesPerByte; i++) pattern = (pattern << dc->bitsPerFrame) | frame;
+
+		uint16_t bytesCount = framesCount / framesPerByte;
+		memset(decompressedData + dataOffset, pattern, bytesCount);
+		dataOffset += bytesCount;
+		framesCount -= bytesCount * framesPerByte;
+
+		// And the rest of the frames
+		while (framesCount > 0)
+		{
+			writeFrame<output>(dc, decompressedData, dataOffset, bitOffset, frame);
+			framesCount--;
+		}
+	}
+#endif
+
+	else if (output == DECOMPRESSION_OUTPUT_DELEGATE)
+	{
+		frameRunDecompressed(frame, framesCount);
+	}
+}
+
+// Decompress the run of frames of the current block by the loop specialized
+// for the block plan and the output mode: no per-frame decisions are left inside.
+template <uint8_t plan, uint8_t output>
+inline void Decompression::decompressPlannedFrames(DecompressionContext * dc, CompressedDataPointer compressedData, uint8_t * decompressedData, uint16_t & dataOffset, uint8_t & bitOffset, uint16_t framesCount)
+{
+	uint16_t frame = 0;
+
+	if (plan == DECOMPRESSION_PLAN_CONSTANT)
+	{
+		// The same frame for the whole block, so the run is written at once
+		for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+		{
+			frame <<= dc->bitsPerChannels[c];
+			frame |= currentBaseValues[c];
+		}
+
+		writeFrameRun<output>(dc, decompressedData, dataOffset, bitOffset, frame, framesCount);
+		return;
+	}
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+	if ((plan == DECOMPRESSION_PLAN_ADAPTIVE) && currentBlockFirstFrame)
+	{
+		// The first frame of the block: adaptive channels return their base values
+		for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+		{
+			uint8_t decompressedValue = currentBaseValues[c];
+			if (!currentBlockAFW[c]) decompressedValue += readNextBits(compressedData, currentBlockMethods[c]);
+			frame <<= dc->bitsPerChannels[c];
+			frame |= decompressedValue;
+		}
+
+		writeFrame<output>(dc, decompressedData, dataOffset, bitOffset, frame);
+		currentBlockFirstFrame = false;
+		framesCount--;
+	}
+#endif
+
+	while (framesCount > 0)
+	{
+		frame = 0;
+		for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+		{
+			uint8_t decompressedValue = currentBaseValues[c];
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+			if ((plan == DECOMPRESSION_PLAN_ADAPTIVE) && currentBlockAFW[c])
+			{
+				uint8_t windowWidth = (uint8_t)1 << currentBlockMethods[c];
+				uint8_t halfWindowWidth = windowWidth >> 1;
+				uint8_t maxWindowStart = MASK8_FOR_BITS_COUNT(dc->bitsPerChannels[c]) - windowWidth + 1;
+
+				if (halfWindowWidth < decompressedValue) {
+					decompressedValue -= halfWindowWidth;
+					if (decompressedValue > maxWindowStart) decompressedValue = maxWindowStart;
+				} 
+				else
+				{
+					decompressedValue = 0;
+				}
+				decompressedValue += readNextBits(compressedData, currentBlockMethods[c]);
+				currentBaseValues[c] = decompressedValue;
+			}
+			else
+#endif
+
+			{
+				// Constant channels read zero bits here
+				decompressedValue += readNextBits(compressedData, currentBlockMethods[c]);
+			}
+
+			frame <<= dc->bitsPerChannels[c];
+			frame |= decompressedValue;
+		}
+
+		writeFrame<output>(dc, decompressedData, dataOffset, bitOffset, frame);
+		framesCount--;
+	}
+}
+
+// Select the specialized loop (a jump table keyed on the block plan and the output mode)
+#define DECOMPRESSION_RUN_CASE(plan, output) \
+	case ((plan << 2) | output): \
+		decompressPlannedFrames<plan, output>(dc, compressedData, decompressedData, dataOffset, bitOffset, framesCount); \
+		break;
+
+#if defined(FRAMES_LESS_THAN_BYTE_USED)
+#define DECOMPRESSION_RUN_CASES(plan) \
+	DECOMPRESSION_RUN_CASE(plan, DECOMPRESSION_OUTPUT_BYTES) \
+	DECOMPRESSION_RUN_CASE(plan, DECOMPRESSION_OUTPUT_PACKED) \
+	DECOMPRESSION_RUN_CASE(plan, DECOMPRESSION_OUTPUT_DELEGATE)
+#else
+#define DECOMPRESSION_RUN_CASES(plan) \
+	DECOMPRESSION_RUN_CASE(plan, DECOMPRESSION_OUTPUT_BYTES) \
+	DECOMPRESSION_RUN_CASE(plan, DECOMPRESSION_OUTPUT_DELEGATE)
+#endif
+
+void Decompression::decompressRun(DecompressionContext * dc, CompressedDataPointer compressedData, uint8_t * decompressedData, uint16_t & dataOffset, uint8_t & bitOffset, uint16_t framesCount, uint8_t outputMode)
+{
+	switch ((currentBlockPlan << 2) | outputMode)
+	{
+		DECOMPRESSION_RUN_CASES(DECOMPRESSION_PLAN_CONSTANT)
+		DECOMPRESSION_RUN_CASES(DECOMPRESSION_PLAN_FIXED)
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+		DECOMPRESSION_RUN_CASES(DECOMPRESSION_PLAN_ADAPTIVE)
+#endif
+	}
+}
+
+// Read compressed data (two options for near and far memory).
+// The stream is MSB-first, so each refill appends one big-endian 16-bit word
+// to the bit buffer instead of looping over single bytes. The refill happens
+// only when the buffer holds fewer bits than requested (at most 15 remain),
+// so 32 bits of buffer are always enough. The last refill may fetch 1 byte
+// beyond the end of the compressed data, so the data must be followed by
+// DECOMPRESSION_DATA_PADDING zero bytes (they are never used).
+#if defined(USE_FAR_MEMORY_CHUNKS)
+
+void Decompression::refillBits(uint_farptr_t * compressedData)
+{
+	// Chunk size is even and the index always grows by 2,
+	// so the word never straddles two chunks.
+	uint16_t word = pgm_read_word_far(compressedData[inputChunkIndex] + inputByteIndex); // Read far word
+	inputBitsBuffer <<= 16;
+	inputBitsBuffer |= __builtin_bswap16(word);
+	inputBitsCount += 16;
+	inputByteIndex += 2;
+
+	// Check if next address is outside the chunk
+	if (inputByteIndex >= CHUNK_SIZE) {
+		inputChunkIndex++;
+		inputByteIndex = 0;
+	}
+}
+
+uint16_t Decompression::peekNextBits(uint_farptr_t * compressedData, uint8_t bitsCount)
+{
+	if (inputBitsCount < bitsCount) refillBits(compressedData);
+	// 32-bit mask works for zero bits as well, so there's no need for a separate check
+	return ((inputBitsBuffer >> (inputBitsCount - bitsCount)) & (((uint32_t)1 << bitsCount) - 1));
+}
+
+uint16_t Decompression::readNextBits(uint_farptr_t * compressedData, uint8_t bitsCount)
+{
+	uint16_t bits = peekNextBits(compressedData, bitsCount);
+	skipBits(bitsCount);
+	return (bits);
+}
+
+#else
+
+void Decompression::refillBits(uint8_t * compressedData)
+{
+#if defined(AVR)
+	uint16_t word = __builtin_bswap16(pgm_read_word(compressedData + inputByteIndex));
+#else
+	// memcpy is the portable unaligned load (a single instruction where the core allows it)
+	uint16_t word;
+	memcpy(&word, compressedData + inputByteIndex, sizeof(word));
+# if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	word = __builtin_bswap16(word);
+# endif
+#endif
+	inputBitsBuffer <<= 16;
+	inputBitsBuffer |= word;
+	inputBitsCount += 16;
+	inputByteIndex += 2;
+}
+
+uint16_t Decompression::peekNextBits(uint8_t * compressedData, uint8_t bitsCount)
+{
+	if (inputBitsCount < bitsCount) refillBits(compressedData);
+	// 32-bit mask works for zero bits as well, so there's no need for a separate check
+	return ((inputBitsBuffer >> (inputBitsCount - bitsCount)) & (((uint32_t)1 << bitsCount) - 1));
+}
+
+uint16_t Decompression::readNextBits(uint8_t * compressedData, uint8_t bitsCount)
+{
+	uint16_t bits = peekNextBits(compressedData, bitsCount);
+	skipBits(bitsCount);
+	return (bits);
+}
+
+#endif
+
+// Consume bits that were already peeked
+void Decompression::skipBits(uint8_t bitsCount)
+{
+	inputBitsCount -= bitsCount;
+}
+
+// END-OF-FILE
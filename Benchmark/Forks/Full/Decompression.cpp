@@ -0,0 +1,422 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Seek index may be placed in the program memory on AVR
+#if defined(AVR)
+#define SEEK_POINT_FIELD(p, f)  pgm_read_dword(&((p)->f))
+#else
+#define SEEK_POINT_FIELD(p, f)  ((p)->f)
+#endif
+
+// Includes
+#include "Decompression.h"
+#include <stdlib.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Weak delegate method
+void __attribute__((weak)) frameDecompressed(uint64_t frame) {
+	// Do not delete this function
+}
+
+// Weak delegate method for a run of identical frames (constant blocks).
+// Override it to output the whole run at once.
+void __attribute__((weak)) frameRunDecompressed(uint64_t frame, uint32_t count) {
+	while (count--) frameDecompressed(frame);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Clear runtime variables
+void Decompression::resetDecompression()
+{
+	inputBitsBuffer = 0;
+#if defined(USE_FAR_MEMORY_CHUNKS)
+	inputChunkIndex = 0;
+#endif
+	inputByteIndex = 0;
+	inputBitsCount = 0;
+
+	currentBlockFramesCount = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Output sinks behind the buffer and delegate version of decompressNextFrames()
+
+// Whole bytes frames (the frame size is known at runtime only)
+class DecompressionBytesSink {
+
+public:
+
+	DecompressionBytesSink(uint8_t * buffer, uint8_t frameSize) : buffer(buffer), data(buffer), frameSize(frameSize) {}
+
+	inline void writeFrame(uint64_t frame)
+	{
+		for (uint8_t shift = frameSize << 3; shift > 0; )
+		{
+			shift -= 8;
+			*data++ = (frame >> shift) & 0xFF;
+		}
+	}
+
+	inline void writeRun(uint64_t frame, uint32_t count)
+	{
+		if (count < DECOMPRESSION_BULK_FILL_THRESHOLD)
+		{
+			while (count--) writeFrame(frame);
+		}
+		else
+		{
+			data = decompressionFillFrames(data, frame, frameSize, count);
+		}
+	}
+
+	inline void moveTo(uint32_t position) { data = buffer + position * frameSize; }
+
+private:
+
+	uint8_t * buffer;
+	uint8_t * data;
+	uint8_t frameSize;
+
+};
+
+#if defined(FRAMES_LESS_THAN_BYTE_USED)
+
+// 1-2-4 bits frames packed into the buffer bytes
+class DecompressionPackedSink {
+
+public:
+
+	DecompressionPackedSink(uint8_t * buffer, uint8_t bitsPerFrame) : buffer(buffer), dataOffset(0), bitOffset(0), bitsPerFrame(bitsPerFrame) {}
+
+	inline void writeFrame(uint64_t frame)
+	{
+		uint8_t storedBufferData = (bitOffset == 0) ? 0 : buffer[dataOffset];
+
+		storedBufferData |= (frame << (8 - bitsPerFrame - bitOffset));
+		buffer[dataOffset] = storedBufferData;
+
+		bitOffset += bitsPerFrame;
+		if (bitOffset >= 8)
+		{
+			dataOffset++;
+			bitOffset = 0;
+		}
+	}
+
+	inline void writeRun(uint64_t frame, uint32_t count)
+	{
+		if (count >= DECOMPRESSION_BULK_FILL_THRESHOLD)
+		{
+			// Complete the partially filled byte
+			while (bitOffset != 0)
+			{
+				writeFrame(frame);
+				count--;
+			}
+
+			// Then fill whole bytes with the repeated frame
+			uint8_t framesPerByte = 8 / bitsPerFrame;
+			uint8_t pattern = 0;
+			for (uint8_t i = 0; i < framesPerByte; i++) pattern = (pattern << bitsPerFrame) | frame;
+
+			uint32_t bytesCount = count / framesPerByte;
+			memset(buffer + dataOffset, pattern, bytesCount);
+			dataOffset += bytesCount;
+			count -= bytesCount * framesPerByte;
+		}
+
+		// And the rest of the frames
+		while (count--) writeFrame(frame);
+	}
+
+	inline void moveTo(uint32_t position)
+	{
+		uint64_t bitsDataOffset = (uint64_t)position * bitsPerFrame;
+		dataOffset = bitsDataOffset >> 3;
+		bitOffset = bitsDataOffset - (dataOffset << 3);
+	}
+
+private:
+
+	uint8_t * buffer;
+	uint32_t dataOffset;
+	uint8_t bitOffset;
+	uint8_t bitsPerFrame;
+
+};
+
+#endif
+
+// Weak delegate methods
+class DecompressionDelegateSink {
+
+public:
+
+	inline void writeFrame(uint64_t frame) { frameDecompressed(frame); }
+	inline void writeRun(uint64_t frame, uint32_t count) { frameRunDecompressed(frame, count); }
+	inline void moveTo(uint32_t position) {}
+
+};
+
+// No output (used for seeking)
+class DecompressionDiscardSink {
+
+public:
+
+	inline void writeFrame(uint64_t frame) {}
+	inline void writeRun(uint64_t frame, uint32_t count) {}
+	inline void moveTo(uint32_t position) {}
+
+};
+
+// Batch decompression (specified number of frames) into the buffer or to the delegate.
+// The output doesn't change during the call, so we choose the sink once.
+void Decompression::decompressNextFrames(DecompressionContext * dc, CompressedDataPointer compressedData, uint8_t * decompressedData, uint32_t framesCount)
+{
+	if (decompressedData)
+	{
+		if ((dc->bitsPerFrame % 8) == 0)
+		{
+			DecompressionBytesSink sink(decompressedData, dc->bitsPerFrame >> 3);
+			decompressNextFrames(dc, compressedData, sink, framesCount);
+			return;
+		}
+
+#if defined(FRAMES_LESS_THAN_BYTE_USED)
+		if ((8 % dc->bitsPerFrame) == 0)
+		{
+			DecompressionPackedSink sink(decompressedData, dc->bitsPerFrame);
+			decompressNextFrames(dc, compressedData, sink, framesCount);
+			return;
+		}
+#endif
+
+		// Otherwise the frame width is not a multiple of 1, 2, 4 or 8 bits,
+		// so we must ask the delegate for help.
+	}
+
+	DecompressionDelegateSink sink;
+	decompressNextFrames(dc, compressedData, sink, framesCount);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Jump to the specified frame using the seek index exported along with the compressed data.
+// Seek points are block starts, so the restored state is just a bit position:
+// methods, base values and window flags will be read from the block header.
+// The frames between the seek point and the requested one are decompressed silently.
+bool Decompression::seekToFrame(DecompressionContext * dc, CompressedDataPointer compressedData, const DecompressionSeekPoint * seekIndex, uint16_t seekPointsCount, uint32_t frame)
+{
+	if (!seekPointsCount) return (false);
+
+	// Binary search for the last seek point at or before the frame
+	uint16_t low = 0;
+	uint16_t high = seekPointsCount - 1;
+	while (low < high)
+	{
+		uint16_t middle = (low + high + 1) >> 1;
+		if (SEEK_POINT_FIELD(seekIndex + middle, frame) <= frame) low = middle;
+		else high = middle - 1;
+	}
+
+	uint32_t seekPointFrame = SEEK_POINT_FIELD(seekIndex + low, frame);
+	if (seekPointFrame > frame) return (false);
+
+	resetDecompression();
+	setBitPosition(compressedData, SEEK_POINT_FIELD(seekIndex + low, bitOffset));
+	discardFrames(dc, compressedData, frame - seekPointFrame);
+	return (true);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Read the block header: length, methods and base values for every channel
+void Decompression::readBlockHeader(DecompressionContext * dc, CompressedDataPointer compressedData)
+{
+	currentBlockFramesCount = readNextBits(compressedData, dc->blockSizeBits);
+	currentBlockFramesCount++; // 0 value doesn't make any sense to us, so let's get rid of it to save bits.
+
+	uint8_t plan = DECOMPRESSION_PLAN_CONSTANT;
+
+	for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+	{
+		currentBlockMethods[c] = readNextBits(compressedData, dc->bitsPerMethodDeclaration[c]);
+
+		if (currentBlockMethods[c] != dc->bitsPerChannels[c])
+		{
+			currentBaseValues[c] = readNextBits(compressedData, dc->bitsPerChannels[c]);
+
+#if defined(DECOMPRESSION_FIXED_WINDOW_FIRST) || defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_FIRST)
+			if (currentBlockMethods[c] > dc->bitsPerChannels[c])
+			{
+				currentBlockMethods[c] -= dc->bitsPerChannels[c];
+
+# if defined(DECOMPRESSION_FIXED_WINDOW_FIRST)
+				currentBlockAFW[c] = true;
+# elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_FIRST)
+				currentBlockAFW[c] = false;
+# endif
+
+			}
+			else
+			{
+
+# if defined(DECOMPRESSION_FIXED_WINDOW_FIRST)
+				currentBlockAFW[c] = false;
+# elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_FIRST)
+				currentBlockAFW[c] = true;
+# endif
+
+			}
+
+#elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_ONLY)
+			currentBlockAFW[c] = true;
+#endif
+
+		}
+		else
+		{
+			currentBaseValues[c] = 0;
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+			currentBlockAFW[c] = false;
+#endif
+
+		}
+
+		// Channels with zero method are constant and don't affect the plan
+		if (currentBlockMethods[c])
+		{
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+			if (currentBlockAFW[c]) plan = DECOMPRESSION_PLAN_ADAPTIVE;
+			else
+#endif
+
+			if (plan == DECOMPRESSION_PLAN_CONSTANT) plan = DECOMPRESSION_PLAN_FIXED;
+		}
+	}
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+	currentBlockFirstFrame = true;
+#endif
+
+	currentBlockPlan = plan;
+}
+
+// Decompress frames without any output (used to reach the exact frame after a seek)
+void Decompression::discardFrames(DecompressionContext * dc, CompressedDataPointer compressedData, uint32_t framesCount)
+{
+	DecompressionDiscardSink sink;
+
+	while (framesCount > 0)
+	{
+		if (currentBlockFramesCount == 0) readBlockHeader(dc, compressedData);
+
+		uint32_t runLength = (framesCount < currentBlockFramesCount) ? framesCount : currentBlockFramesCount;
+		decompressRun(dc, compressedData, sink, runLength);
+
+		framesCount -= runLength;
+		currentBlockFramesCount -= runLength;
+	}
+}
+
+// Move the read position to the specified bit of the compressed data
+void Decompression::setBitPosition(CompressedDataPointer compressedData, uint32_t bitOffset)
+{
+	uint32_t byteOffset = (bitOffset >> 3) & ~(uint32_t)3; // Keep word reads aligned
+
+#if defined(USE_FAR_MEMORY_CHUNKS)
+	inputChunkIndex = byteOffset / CHUNK_SIZE;
+	inputByteIndex = byteOffset % CHUNK_SIZE;
+#else
+	inputByteIndex = byteOffset;
+#endif
+
+	inputBitsBuffer = 0;
+	inputBitsCount = 0;
+
+	uint8_t bitsToSkip = bitOffset - (byteOffset << 3);
+	peekNextBits(compressedData, bitsToSkip);
+	skipBits(bitsToSkip);
+}
+
+// Read compressed data (two options for near and far memory).
+// The stream is MSB-first, so each refill appends one big-endian 32-bit word
+// to the bit buffer instead of looping over single bytes. The refill happens
+// only when the buffer holds fewer bits than requested (at most 31 remain),
+// so 64 bits of buffer are always enough. The last refill may fetch up to 3 bytes
+// beyond the end of the compressed data, so the data must be followed by
+// DECOMPRESSION_DATA_PADDING zero bytes (they are never used).
+#if defined(USE_FAR_MEMORY_CHUNKS)
+
+void Decompression::refillBits(CompressedDataPointer compressedData)
+{
+	// Chunk size is a multiple of 4 and the index always grows by 4,
+	// so the word never straddles two chunks.
+	uint32_t word = pgm_read_dword_far(compressedData[inputChunkIndex] + inputByteIndex); // Read far word
+	inputBitsBuffer <<= 32;
+	inputBitsBuffer |= __builtin_bswap32(word);
+	inputBitsCount += 32;
+	inputByteIndex += 4;
+
+	// Check if next address is outside the chunk
+	if (inputByteIndex >= CHUNK_SIZE) {
+		inputChunkIndex++;
+		inputByteIndex = 0;
+	}
+}
+
+#else
+
+void Decompression::refillBits(CompressedDataPointer compressedData)
+{
+#if defined(AVR)
+	uint32_t word = __builtin_bswap32(pgm_read_dword(compressedData + inputByteIndex));
+#else
+	// memcpy is the portable unaligned load (a single instruction where the core allows it)
+	uint32_t word;
+	memcpy(&word, compressedData + inputByteIndex, sizeof(word));
+# if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	word = __builtin_bswap32(word);
+# endif
+#endif
+	inputBitsBuffer <<= 32;
+	inputBitsBuffer |= word;
+	inputBitsCount += 32;
+	inputByteIndex += 4;
+}
+
+#endif
+
+// END-OF-FILE
@@ -0,0 +1,474 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+This file is part of the most complete decompression class, which has extensive
+decompression capabilities for various source data formats. 
+Both this class and all its modifications may not be very effective in terms of performance
+or non-standard usage, so they can (and should) be modified for each specific task.
+
+As examples, I have made several modifications to the decompression code that differ in capabilities and performance:
+
+1) The original class (THIS ONE) - maximum features:
+	- supported image size up to 65535x65535px,
+	- up to 32 bits per data channel,
+	- up to 64 bits per frame (modification is required for a larger frame width),
+	- decompression per 1 request: up to 2^32 frames (pixels), up to 2^32 compressed/decompressed data size,
+	- decompression of 1-2-4 bits frames,
+	- AVR "far" memory access support*,
+	- splitting compressed data into memory chunks (up to 32767 bytes)**.
+Source: /Decompression
+Example: /AVR/Arduino_boards/Mega2560_ILI9486 (ATMega2560 + ILI9486 480x320 display).
+
+2) High-speed adaptation:
+	- focusing on the low-bit-length operations,
+	- supported image size is up to 255x255px,
+	- up to 8 bits per data channel,
+	- up to 16 bits per frame,
+	- decompression of 1-2-4 bits frames,
+	- AVR "far" memory access support*,
+	- splitting compressed data into memory chunks (up to 32767 bytes)**,
+	- high performance.
+Source: /Decompression/Mods/Fast
+Examples:
+	/AVR/Arduino_boards/Mega2560_ILI9486_Fast (ATMega2560 + ILI9486 480x320 display).
+
+3) High-speed with pixel support:
+	- focusing on the low-bit-length operations,
+	- supported image size is up to 255x255px,
+	- up to 8 bits per data channel,
+	- up to 16 bits per frame,
+	- colorizing pixels during decompression (if used),
+	- direct use of the RGB565 pixel buffer (if needed),
+	- AVR "far" memory access support*,
+	- splitting compressed data into memory chunks (up to 32767 bytes)**,
+	- high performance+.
+Source: /Decompression/Mods/Fast+pixel_support
+Examples:
+	/AVR/Arduino_boards/Nano_ST7789 (Arduino Nano + ST7789 240x240 display),
+	/ESP32/Wroom_ST7789 (ESP32 DEVKIT board + ST7789 240x240 display),
+	/STM32/F070CB_ST7789_DMA (STM32F070CB chip + ST7789 240x240 display),
+	/STM32/F407ZGT6_NT35510_FSMC_DMA (mcudev DevEBox board + NT35510 800x480 display).
+
+4) Tiny adaptation:
+	- focusing on the 8-bit operations,
+	- supported image size is up to 255x255px,
+	- up to 8 bits per data channel,
+	- up to 8 bits per frame supported,
+	- colorizing pixels during decompression (if used),
+	- direct use of the RGB565 pixel buffer (if needed),
+	- high performance++.
+Source: /Decompression/Mods/Tiny+pixel_support
+Examples:
+	/AVR/Arduino_boards/Nano_ST7789_Tiny (Arduino Nano + ST7789 240x240 display),
+	/AVR/ATtiny85 (ATtiny85 chip + SPI output).
+
+The decoder reads the compressed data by words of up to 4 bytes, so the last read may go
+up to 3 bytes beyond the end of the data. The compressor appends
+DECOMPRESSION_DATA_PADDING (3) zero bytes to every exported data array,
+so if you prepare the data in some other way, then append them too.
+
+* Relevant only for the AVR platform.
+** To do this, a pointer to an array of far pointers should be passed 
+to the decompression procedure instead of a direct pointer to a data array:
+
+static uint_farptr_t dataChunks[n];
+decompressNextFrames(dc, dataChunks, decompressedData, framesCount);
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+The description in the code body will be quite brief, so if you want more detailed information,
+then please refer to the following links, where I talk about how this compression method works,
+about problems that arose during the development and how I solved them:
+
+Boosty (Russian):
+Sprint 1 - https://boosty.to/muravyev/posts/9241e5a2-a490-4530-a376-e9cae0f9e9bf?share=post_link
+Sprint 2 - https://boosty.to/muravyev/posts/dfdd0b1d-f27d-446a-ab38-d55cbc7cd580?share=post_link
+Sprint 3 - https://boosty.to/muravyev/posts/bc58a9af-f075-4004-a98e-6535edab9925?share=post_link
+
+Patreon (Eng subs):
+Sprint 1 - https://www.patreon.com/posts/delta-encoding-1-106850934
+Sprint 2 - https://www.patreon.com/posts/delta-encoding-2-108056837
+Sprint 3 - https://www.patreon.com/posts/delta-encoding-3-108236064
+
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include <stdint.h>
+#include "DecompressionSinks.h"
+
+#if defined(AVR)
+#include <avr/pgmspace.h>
+#endif
+
+#ifndef _DELTA_DECOMPRESSION_
+#define _DELTA_DECOMPRESSION_
+
+// Global definitions
+
+// Use only one option that matches your data.
+// Using DECOMPRESSION_FIXED_WINDOW_FIRST, you can decompress data 
+// compressed not only by this method (Fixed + Adaptive), but also
+// a data, compressed by Fixed Window only.
+// Likewise using DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_FIRST, 
+// you can decompress data, compressed both by Adaptive + Fixed
+// and only by Adaptive Window methods.
+////////////////////////////////////////////////////////////////////////////////////////
+//#define DECOMPRESSION_FIXED_WINDOW_ONLY
+//#define DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_ONLY
+#define DECOMPRESSION_FIXED_WINDOW_FIRST
+//#define DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_FIRST
+////////////////////////////////////////////////////////////////////////////////////////
+
+// The maximum number of channels in the data that you will decompress
+#define DECOMPRESSION_MAX_NUMBER_OF_CHANNELS	3
+
+// Uncomment if you have data splitted into squares among those you will decompress
+#define DECOMPRESSION_USE_SQUARES
+
+// Zero bytes that follow the compressed data (the compressor appends them),
+// so the last word read never goes beyond the end of the array
+#define DECOMPRESSION_DATA_PADDING	3
+
+// Uncomment if your data contains frames of 1, 2 or 4 bits
+//#define FRAMES_LESS_THAN_BYTE_USED
+
+#if defined(AVR)
+// Maximum array size for the AVR platform is 32767 bytes,
+// so if we want to use large arrays of compressed data, 
+// then we must put the array in the "far" memory area and split it into chunks.
+// Hide the string below if you don't want to use far memory and chunks.
+#define USE_FAR_MEMORY_CHUNKS
+// For example, we can divide the data by 16K chunks.
+// The size must be a multiple of 4, because data is read by 4-byte words.
+#define CHUNK_SIZE	16384
+
+#endif
+
+// Block decoding plans (chosen once per block header)
+#define DECOMPRESSION_PLAN_CONSTANT	0	// All channels keep their base values
+#define DECOMPRESSION_PLAN_FIXED	1	// Fixed window (or raw) channels only
+#define DECOMPRESSION_PLAN_ADAPTIVE	2	// At least one channel uses the adaptive floating window
+
+// Auxilary macro
+#define MASK32_FOR_BITS_COUNT(x)  (0xFFFFFFFF >> (32 - x))
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Pointer to the compressed data (or to the array of far chunks)
+#if defined(USE_FAR_MEMORY_CHUNKS)
+typedef uint_farptr_t * CompressedDataPointer;
+#else
+typedef uint8_t * CompressedDataPointer;
+#endif
+
+struct DecompressionContext
+{
+	uint8_t numberOfChannels;
+	uint8_t bitsPerChannels[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
+	uint8_t blockSizeBits;
+	uint8_t bitsPerMethodDeclaration[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
+	uint8_t bitsPerFrame;
+#if defined(DECOMPRESSION_USE_SQUARES)
+	bool splitToSquares;
+	uint16_t imageWidth;
+	uint8_t squareSide;
+	uint16_t squaresPerWidth;
+	uint16_t squaresPerWidthSize;
+#endif
+};
+
+// Seek point (optionally exported along with the compressed data):
+// the first frame of a block and the bit offset of its header.
+struct DecompressionSeekPoint
+{
+	uint32_t frame;
+	uint32_t bitOffset;
+};
+
+
+// Delegate methods declaration
+void frameDecompressed(uint64_t frame);
+void frameRunDecompressed(uint64_t frame, uint32_t count);
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+class Decompression {
+
+public:
+
+	uint64_t inputBitsBuffer;
+#if defined(USE_FAR_MEMORY_CHUNKS)
+	uint8_t inputChunkIndex; // Additional variable for ROM chunk index
+#endif
+	uint32_t inputByteIndex;
+	uint8_t inputBitsCount;
+
+	uint32_t currentBlockFramesCount;
+	uint8_t currentBlockMethods[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
+	uint32_t currentBaseValues[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+	bool currentBlockAFW[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
+	bool currentBlockFirstFrame;
+#endif
+	uint8_t currentBlockPlan; // Specialized decoding loop chosen by the block header
+
+	// In the case of decompression images divided into squares, 
+	// set this variable to the width of your decompression buffer in pixels.
+	uint16_t bufferWidth;
+
+	void resetDecompression();
+	void decompressNextFrames(DecompressionContext * dc, CompressedDataPointer compressedData, uint8_t * decompressedData, uint32_t framesCount);
+
+	// Decompression into the output sink (see DecompressionSinks.h).
+	// The sink methods are inlined into the decompression loops.
+	template <class Sink>
+	void decompressNextFrames(DecompressionContext * dc, CompressedDataPointer compressedData, Sink & sink, uint32_t framesCount);
+
+	// Restore the state at the nearest seek point and decompress (without output)
+	// up to the specified frame. For data split into squares, request the frame
+	// at the beginning of a squares line (a multiple of squaresPerWidthSize)
+	// to keep the layout of the next decompressNextFrames() call.
+	bool seekToFrame(DecompressionContext * dc, CompressedDataPointer compressedData, const DecompressionSeekPoint * seekIndex, uint16_t seekPointsCount, uint32_t frame);
+
+private:
+
+	void readBlockHeader(DecompressionContext * dc, CompressedDataPointer compressedData);
+	template <class Sink>
+	void decompressRun(DecompressionContext * dc, CompressedDataPointer compressedData, Sink & sink, uint32_t framesCount);
+	template <uint8_t plan, class Sink>
+	void decompressPlannedFrames(DecompressionContext * dc, CompressedDataPointer compressedData, Sink & sink, uint32_t framesCount);
+	void discardFrames(DecompressionContext * dc, CompressedDataPointer compressedData, uint32_t framesCount);
+	void setBitPosition(CompressedDataPointer compressedData, uint32_t bitOffset);
+
+	void refillBits(CompressedDataPointer compressedData);
+	uint32_t peekNextBits(CompressedDataPointer compressedData, uint8_t bitsCount);
+	uint32_t readNextBits(CompressedDataPointer compressedData, uint8_t bitsCount);
+	void skipBits(uint8_t bitsCount);
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////
+// The sink version of decompressNextFrames() is compiled together with the sink,
+// so the decompression loops and the bits reading live in the header.
+
+// Batch decompression (specified number of frames) into the sink
+template <class Sink>
+void Decompression::decompressNextFrames(DecompressionContext * dc, CompressedDataPointer compressedData, Sink & sink, uint32_t framesCount)
+{
+#if defined(DECOMPRESSION_USE_SQUARES)
+	uint8_t row = 0;
+	uint8_t column = 0;
+	uint16_t squareOffset = 0;
+	uint32_t squareLineOffset = 0;
+#endif
+
+	while (framesCount > 0)
+	{
+		if (currentBlockFramesCount == 0)
+		{
+			readBlockHeader(dc, compressedData);
+		}
+
+		// The run of frames that can be decompressed by a single specialized loop
+		uint32_t runLength = (framesCount < currentBlockFramesCount) ? framesCount : currentBlockFramesCount;
+
+#if defined(DECOMPRESSION_USE_SQUARES)
+		// The run must not cross the row of the square
+		if (dc->splitToSquares && (runLength > (uint32_t)(dc->squareSide - column))) runLength = dc->squareSide - column;
+#endif
+
+		decompressRun(dc, compressedData, sink, runLength);
+
+		framesCount -= runLength;
+		currentBlockFramesCount -= runLength;
+
+#if defined(DECOMPRESSION_USE_SQUARES)
+		// Move the output to the next row of the square
+		if (dc->splitToSquares)
+		{
+			column += runLength;
+			if (column >= dc->squareSide)
+			{
+				row++;
+				if (row >= dc->squareSide)
+				{
+					squareOffset += dc->squareSide;
+					if (squareOffset >= dc->imageWidth)
+					{
+						squareLineOffset += dc->squaresPerWidthSize;
+						squareOffset = 0;
+					}
+					row = 0;
+				}
+				column = 0;
+
+				sink.moveTo(squareLineOffset + squareOffset + (uint32_t)row * bufferWidth);
+			}
+		}
+#endif
+
+	}
+
+}
+
+// Select the specialized loop for the block plan
+template <class Sink>
+inline void Decompression::decompressRun(DecompressionContext * dc, CompressedDataPointer compressedData, Sink & sink, uint32_t framesCount)
+{
+	switch (currentBlockPlan)
+	{
+		case DECOMPRESSION_PLAN_CONSTANT:
+			decompressPlannedFrames<DECOMPRESSION_PLAN_CONSTANT>(dc, compressedData, sink, framesCount);
+			break;
+
+		case DECOMPRESSION_PLAN_FIXED:
+			decompressPlannedFrames<DECOMPRESSION_PLAN_FIXED>(dc, compressedData, sink, framesCount);
+			break;
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+		case DECOMPRESSION_PLAN_ADAPTIVE:
+			decompressPlannedFrames<DECOMPRESSION_PLAN_ADAPTIVE>(dc, compressedData, sink, framesCount);
+			break;
+#endif
+	}
+}
+
+// Decompress the run of frames of the current block by the loop specialized
+// for the block plan and the sink: no per-frame decisions are left inside.
+template <uint8_t plan, class Sink>
+inline void Decompression::decompressPlannedFrames(DecompressionContext * dc, CompressedDataPointer compressedData, Sink & sink, uint32_t framesCount)
+{
+	uint64_t frame = 0;
+
+	if (plan == DECOMPRESSION_PLAN_CONSTANT)
+	{
+		// The same frame for the whole block, so the run is written at once
+		for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+		{
+			frame <<= dc->bitsPerChannels[c];
+			frame |= currentBaseValues[c];
+		}
+
+		sink.writeRun(frame, framesCount);
+		return;
+	}
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+	if ((plan == DECOMPRESSION_PLAN_ADAPTIVE) && currentBlockFirstFrame)
+	{
+		// The first frame of the block: adaptive channels return their base values
+		for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+		{
+			uint32_t decompressedValue = currentBaseValues[c];
+			if (!currentBlockAFW[c]) decompressedValue += readNextBits(compressedData, currentBlockMethods[c]);
+			frame <<= dc->bitsPerChannels[c];
+			frame |= decompressedValue;
+		}
+
+		sink.writeFrame(frame);
+		currentBlockFirstFrame = false;
+		framesCount--;
+	}
+#endif
+
+	while (framesCount > 0)
+	{
+		frame = 0;
+		for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+		{
+			uint32_t decompressedValue = currentBaseValues[c];
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+			if ((plan == DECOMPRESSION_PLAN_ADAPTIVE) && currentBlockAFW[c])
+			{
+				uint32_t windowWidth = (uint32_t)1 << currentBlockMethods[c];
+				uint32_t halfWindowWidth = windowWidth >> 1;
+				uint32_t maxWindowStart = MASK32_FOR_BITS_COUNT(dc->bitsPerChannels[c]) - windowWidth + 1;
+
+				if (halfWindowWidth < decompressedValue) {
+					decompressedValue -= halfWindowWidth;
+					if (decompressedValue > maxWindowStart) decompressedValue = maxWindowStart;
+				} 
+				else
+				{
+					decompressedValue = 0;
+				}
+				decompressedValue += readNextBits(compressedData, currentBlockMethods[c]);
+				currentBaseValues[c] = decompressedValue;
+			}
+			else
+#endif
+
+			{
+				// Constant channels read zero bits here
+				decompressedValue += readNextBits(compressedData, currentBlockMethods[c]);
+			}
+
+			frame <<= dc->bitsPerChannels[c];
+			frame |= decompressedValue;
+		}
+
+		sink.writeFrame(frame);
+		framesCount--;
+	}
+}
+
+inline uint32_t Decompression::peekNextBits(CompressedDataPointer compressedData, uint8_t bitsCount)
+{
+	if (inputBitsCount < bitsCount) refillBits(compressedData);
+	// 64-bit mask works for zero bits as well, so there's no need for a separate check
+	return ((inputBitsBuffer >> (inputBitsCount - bitsCount)) & (((uint64_t)1 << bitsCount) - 1));
+}
+
+inline uint32_t Decompression::readNextBits(CompressedDataPointer compressedData, uint8_t bitsCount)
+{
+	uint32_t bits = peekNextBits(compressedData, bitsCount);
+	skipBits(bitsCount);
+	return (bits);
+}
+
+// Consume bits that were already peeked
+inline void Decompression::skipBits(uint8_t bitsCount)
+{
+	inputBitsCount -= bitsCount;
+}
+
+#endif // end _DELTA_DECOMPRESSION_
+
+// END-OF-FILE
@@ -0,0 +1,256 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+Output sinks for the template version of decompressNextFrames():
+
+static uint8_t buffer[...];
+DecompressionBufferSink<2> sink(buffer);
+decomp.decompressNextFrames(dc, compressedData, sink, framesCount);
+
+The sink is a template parameter, so its methods are inlined into the decompression
+loops instead of calling the delegate for every frame. Any class with these methods can be a sink:
+
+template <typename Frame> void writeFrame(Frame frame)
+	- the next decompressed frame;
+template <typename Frame, typename Count> void writeRun(Frame frame, Count count)
+	- the run of identical frames (the whole constant block or its part);
+void moveTo(uint32_t position)
+	- images split into squares only: the next frame goes to the specified position
+	(in frames) of the buffer which is bufferWidth frames wide.
+	Stream sinks (callback, SPI, FSMC) can't move, so the address window
+	of the display must be set by the caller.
+
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include <stdint.h>
+#include <string.h>
+
+#if defined(AVR)
+#include <avr/io.h>
+#endif
+
+#ifndef _DELTA_DECOMPRESSION_SINKS_
+#define _DELTA_DECOMPRESSION_SINKS_
+
+// Shorter runs of identical frames are written frame by frame (bulk fill doesn't pay off)
+#define DECOMPRESSION_BULK_FILL_THRESHOLD	16
+
+// Fill the buffer with the run of identical frames (big-endian bytes of the specified size)
+static inline uint8_t * decompressionFillFrames(uint8_t * data, uint64_t frame, uint8_t frameSize, uint32_t framesCount)
+{
+	uint32_t runSize = framesCount * frameSize;
+
+	if (frameSize == 1)
+	{
+		memset(data, frame, runSize);
+	}
+	else
+	{
+		// Write the first frame and then keep doubling the filled part
+		for (uint8_t i = frameSize; i > 0; i--)
+		{
+			data[i - 1] = frame & 0xFF;
+			frame >>= 8;
+		}
+
+		for (uint32_t filled = frameSize; filled < runSize; filled <<= 1)
+		{
+			memcpy(data + filled, data, ((runSize - filled) < filled) ? (runSize - filled) : filled);
+		}
+	}
+
+	return (data + runSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Raw buffer: frames of the specified size (in bytes) are stored as big-endian bytes
+// (the same layout as the buffer version of decompressNextFrames() produces).
+template <uint8_t frameSize>
+class DecompressionBufferSink {
+
+public:
+
+	DecompressionBufferSink(uint8_t * buffer) : buffer(buffer), data(buffer) {}
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame)
+	{
+		for (uint8_t shift = frameSize << 3; shift > 0; )
+		{
+			shift -= 8;
+			*data++ = (frame >> shift) & 0xFF;
+		}
+	}
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count)
+	{
+		if (count < DECOMPRESSION_BULK_FILL_THRESHOLD)
+		{
+			while (count--) writeFrame(frame);
+		}
+		else
+		{
+			data = decompressionFillFrames(data, frame, frameSize, count);
+		}
+	}
+
+	inline void moveTo(uint32_t position) { data = buffer + position * frameSize; }
+
+private:
+
+	uint8_t * buffer;
+	uint8_t * data;
+
+};
+
+// RGB565 (or any 16-bit frames) pixel buffer. Set swapBytes to store pixels
+// with the swapped byte order, which most SPI displays expect when
+// the buffer of a little-endian MCU is sent by DMA as a byte stream.
+template <bool swapBytes = false>
+class DecompressionRGB565Sink {
+
+public:
+
+	DecompressionRGB565Sink(uint16_t * buffer) : buffer(buffer), pixels(buffer) {}
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame)
+	{
+		*pixels++ = pixel(frame);
+	}
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count)
+	{
+		uint16_t value = pixel(frame);
+		while (count--) *pixels++ = value;
+	}
+
+	inline void moveTo(uint32_t position) { pixels = buffer + position; }
+
+private:
+
+	uint16_t * buffer;
+	uint16_t * pixels;
+
+	static inline uint16_t pixel(uint16_t frame) { return (swapBytes ? ((frame << 8) | (frame >> 8)) : frame); }
+
+};
+
+// Direct call of the function for every frame. Unlike the weak delegate
+// the function is known at compile time, so the call can be inlined.
+template <typename FrameType, void (*callback)(FrameType)>
+class DecompressionCallbackSink {
+
+public:
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame) { callback(frame); }
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count)
+	{
+		while (count--) callback(frame);
+	}
+
+	inline void moveTo(uint32_t position) {}
+
+};
+
+#if defined(AVR) && defined(SPDR)
+
+// Direct writes to the AVR hardware SPI (frames of the specified size are sent MSB first).
+// The bus must be already configured (SPI.beginTransaction() or similar).
+template <uint8_t frameSize>
+class DecompressionSPISink {
+
+public:
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame)
+	{
+		for (uint8_t shift = frameSize << 3; shift > 0; )
+		{
+			shift -= 8;
+			transfer(frame >> shift);
+		}
+	}
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count)
+	{
+		while (count--) writeFrame(frame);
+	}
+
+	inline void moveTo(uint32_t position) {}
+
+private:
+
+	static inline void transfer(uint8_t data)
+	{
+		SPDR = data;
+		asm volatile("nop"); // The same trick as in the SPI library: the flag is checked one cycle later
+		while (!(SPSR & _BV(SPIF))) ;
+	}
+
+};
+
+#endif
+
+// Direct writes of 16-bit frames to the memory-mapped data register
+// of the display (STM32 FSMC/FMC and similar parallel buses).
+template <uintptr_t dataAddress>
+class DecompressionFSMCSink {
+
+public:
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame) { *(volatile uint16_t *)dataAddress = frame; }
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count)
+	{
+		while (count--) *(volatile uint16_t *)dataAddress = frame;
+	}
+
+	inline void moveTo(uint32_t position) {}
+
+};
+
+#endif // end _DELTA_DECOMPRESSION_SINKS_
+
+// END-OF-FILE
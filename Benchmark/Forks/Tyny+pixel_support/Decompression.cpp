@@ -0,0 +1,201 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Includes
+#include "Decompression.h"
+#include <stdlib.h>
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Weak delegate method
+void __attribute__((weak)) frameDecompressed(uint8_t frame) {
+	// Do not delete this function
+}
+
+// Weak delegate method for a run of identical frames (constant blocks).
+// Override it to output the whole run at once.
+void __attribute__((weak)) frameRunDecompressed(uint8_t frame, uint16_t count) {
+	while (count--) frameDecompressed(frame);
+}
+
+// Another one delegate method to colorize grayscale pixels
+uint16_t __attribute__((weak)) colorizePixel(uint8_t frame) {
+	// Do not delete this function
+	return (frame);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Clear runtime variables
+void Decompression::resetDecompression()
+{
+	inputBitsBuffer = 0;
+	inputByteIndex = 0;
+	inputBitsCount = 0;
+
+	currentBlockFramesCount = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Output sinks behind the buffer and delegate version of decompressNextFrames()
+
+// colorizePixel() results to the pixel buffer
+class DecompressionColorizeSink {
+
+public:
+
+	DecompressionColorizeSink(uint16_t * buffer) : buffer(buffer), pixels(buffer) {}
+
+	inline void writeFrame(uint8_t frame) { *pixels++ = colorizePixel(frame); }
+
+	inline void writeRun(uint8_t frame, uint16_t count)
+	{
+		uint16_t pixel = colorizePixel(frame);
+		while (count--) *pixels++ = pixel;
+	}
+
+	inline void moveTo(uint16_t position) { pixels = buffer + position; }
+
+private:
+
+	uint16_t * buffer;
+	uint16_t * pixels;
+
+};
+
+// Weak delegate methods
+class DecompressionDelegateSink {
+
+public:
+
+	inline void writeFrame(uint8_t frame) { frameDecompressed(frame); }
+	inline void writeRun(uint8_t frame, uint16_t count) { frameRunDecompressed(frame, count); }
+	inline void moveTo(uint16_t position) {}
+
+};
+
+// Batch decompression (specified number of frames)
+// Let's change buffer type to our pixel formats, i.e. uint16_t (RGB565, RGB555, RGB444),
+// and add colorize flag to call another one delegate method.
+// The output doesn't change during the call, so we choose the sink once.
+void Decompression::decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, uint16_t * decompressedData, uint16_t framesCount, bool colorize)
+{
+	if (!decompressedData)
+	{
+		DecompressionDelegateSink sink;
+		decompressNextFrames(dc, compressedData, sink, framesCount);
+	}
+	else if (colorize)
+	{
+		DecompressionColorizeSink sink(decompressedData);
+		decompressNextFrames(dc, compressedData, sink, framesCount);
+	}
+	else
+	{
+		DecompressionRGB565Sink<> sink(decompressedData);
+		decompressNextFrames(dc, compressedData, sink, framesCount);
+	}
+}
+
+// Read the block header: length, methods and base values for every channel
+void Decompression::readBlockHeader(DecompressionContext * dc, uint8_t * compressedData)
+{
+	currentBlockFramesCount = readNextBits(compressedData, dc->blockSizeBits);
+	currentBlockFramesCount++; // 0 value doesn't make any sense to us, so let's get rid of it to save bits.
+
+	uint8_t plan = DECOMPRESSION_PLAN_CONSTANT;
+
+	for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+	{
+		currentBlockMethods[c] = readNextBits(compressedData, dc->bitsPerMethodDeclaration[c]);
+
+		if (currentBlockMethods[c] != dc->bitsPerChannels[c])
+		{
+			currentBaseValues[c] = readNextBits(compressedData, dc->bitsPerChannels[c]);
+
+#if defined(DECOMPRESSION_FIXED_WINDOW_FIRST) || defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_FIRST)
+			if (currentBlockMethods[c] > dc->bitsPerChannels[c])
+			{
+				currentBlockMethods[c] -= dc->bitsPerChannels[c];
+
+# if defined(DECOMPRESSION_FIXED_WINDOW_FIRST)
+				currentBlockAFW[c] = true;
+# elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_FIRST)
+				currentBlockAFW[c] = false;
+# endif
+
+			}
+			else
+			{
+
+# if defined(DECOMPRESSION_FIXED_WINDOW_FIRST)
+				currentBlockAFW[c] = false;
+# elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_FIRST)
+				currentBlockAFW[c] = true;
+# endif
+
+			}
+
+#elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_ONLY)
+			currentBlockAFW[c] = true;
+#endif
+
+		}
+		else
+		{
+			currentBaseValues[c] = 0;
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+			currentBlockAFW[c] = false;
+#endif
+
+		}
+
+		// Channels with zero method are constant and don't affect the plan
+		if (currentBlockMethods[c])
+		{
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+			if (currentBlockAFW[c]) plan = DECOMPRESSION_PLAN_ADAPTIVE;
+			else
+#endif
+
+			if (plan == DECOMPRESSION_PLAN_CONSTANT) plan = DECOMPRESSION_PLAN_FIXED;
+		}
+	}
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+	currentBlockFirstFrame = true;
+#endif
+
+	currentBlockPlan = plan;
+}
+
+// END-OF-FILE
@@ -0,0 +1,449 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+This class is the next modification of the decompression class, 
+which is focused on an 8-bit architecture. It uses as small 
+bit width of variables as possible and has great performance.
+
+As examples, I have made several modifications to the decompression code that differ in capabilities and performance:
+
+1) The original class - maximum features:
+	- supported image size up to 65535x65535px,
+	- up to 32 bits per data channel,
+	- up to 64 bits per frame (modification is required for a larger frame width),
+	- decompression per 1 request: up to 2^32 frames (pixels), up to 2^32 compressed/decompressed data size,
+	- decompression of 1-2-4 bits frames,
+	- AVR "far" memory access support*,
+	- splitting compressed data into memory chunks (up to 32767 bytes)**.
+Source: /Decompression
+Example: /AVR/Arduino_boards/Mega2560_ILI9486 (ATMega2560 + ILI9486 480x320 display).
+
+2) High-speed adaptation:
+	- focusing on the low-bit-length operations,
+	- supported image size is up to 255x255px,
+	- up to 8 bits per data channel,
+	- up to 16 bits per frame,
+	- decompression of 1-2-4 bits frames,
+	- AVR "far" memory access support*,
+	- splitting compressed data into memory chunks (up to 32767 bytes)**,
+	- high performance.
+Source: /Decompression/Mods/Fast
+Examples:
+	/AVR/Arduino_boards/Mega2560_ILI9486_Fast (ATMega2560 + ILI9486 480x320 display).
+
+3) High-speed with pixel support:
+	- focusing on the low-bit-length operations,
+	- supported image size is up to 255x255px,
+	- up to 8 bits per data channel,
+	- up to 16 bits per frame,
+	- colorizing pixels during decompression (if used),
+	- direct use of the RGB565 pixel buffer (if needed),
+	- AVR "far" memory access support*,
+	- splitting compressed data into memory chunks (up to 32767 bytes)**,
+	- high performance+.
+Source: /Decompression/Mods/Fast+pixel_support
+Examples:
+	/AVR/Arduino_boards/Nano_ST7789 (Arduino Nano + ST7789 240x240 display),
+	/ESP32/Wroom_ST7789 (ESP32 DEVKIT board + ST7789 240x240 display),
+	/STM32/F070CB_ST7789_DMA (STM32F070CB chip + ST7789 240x240 display),
+	/STM32/F407ZGT6_NT35510_FSMC_DMA (mcudev DevEBox board + NT35510 800x480 display).
+	
+4) Tiny adaptation (THIS ONE):
+	- focusing on the 8-bit operations,
+	- supported image size is up to 255x255px,
+	- up to 8 bits per data channel,
+	- up to 8 bits per frame supported,
+	- colorizing pixels during decompression (if used),
+	- direct use of the RGB565 pixel buffer (if needed),
+	- high performance++.
+Source: /Decompression/Mods/Tiny+pixel_support
+Examples:
+	/AVR/Arduino_boards/Nano_ST7789_Tiny (Arduino Nano + ST7789 240x240 display),
+	/AVR/ATtiny85 (ATtiny85 chip + SPI output).
+
+The decoder reads the compressed data by words of up to 4 bytes, so the last read may go
+up to 3 bytes beyond the end of the data. The compressor appends
+DECOMPRESSION_DATA_PADDING (3) zero bytes to every exported data array,
+so if you prepare the data in some other way, then append them too.
+
+* Relevant only for the AVR platform.
+** To do this, a pointer to an array of far pointers should be passed 
+to the decompression procedure instead of a direct pointer to a data array:
+
+static uint_farptr_t dataChunks[n];
+decompressNextFrames(dc, dataChunks, decompressedData, framesCount);
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+The description in the code body will be quite brief, so if you want more detailed information,
+then please refer to the following links, where I talk about how this compression method works,
+about problems that arose during the development and how I solved them:
+
+Boosty (Russian):
+Sprint 1 - https://boosty.to/muravyev/posts/9241e5a2-a490-4530-a376-e9cae0f9e9bf?share=post_link
+Sprint 2 - https://boosty.to/muravyev/posts/dfdd0b1d-f27d-446a-ab38-d55cbc7cd580?share=post_link
+Sprint 3 - https://boosty.to/muravyev/posts/bc58a9af-f075-4004-a98e-6535edab9925?share=post_link
+
+Patreon (Eng subs):
+Sprint 1 - https://www.patreon.com/posts/delta-encoding-1-106850934
+Sprint 2 - https://www.patreon.com/posts/delta-encoding-2-108056837
+Sprint 3 - https://www.patreon.com/posts/delta-encoding-3-108236064
+
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include <stdint.h>
+#include "DecompressionSinks.h"
+
+#if defined(AVR)
+#include <avr/pgmspace.h>
+#endif
+
+#ifndef _DELTA_DECOMPRESSION_
+#define _DELTA_DECOMPRESSION_
+
+// Global definitions
+
+// Use only one option that matches your data.
+// Using DECOMPRESSION_FIXED_WINDOW_FIRST, you can decompress data 
+// compressed not only by this method (Fixed + Adaptive), but also
+// a data, compressed by Fixed Window only.
+// Likewise using DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_FIRST, 
+// you can decompress data, compressed both by Adaptive + Fixed
+// and only by Adaptive Window methods.
+////////////////////////////////////////////////////////////////////////////////////////
+#define DECOMPRESSION_FIXED_WINDOW_ONLY
+//#define DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_ONLY
+//#define DECOMPRESSION_FIXED_WINDOW_FIRST
+//#define DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_FIRST
+////////////////////////////////////////////////////////////////////////////////////////
+
+// The maximum number of channels in the data that you will decompress
+#define DECOMPRESSION_MAX_NUMBER_OF_CHANNELS	1
+
+// Uncomment if you have data splitted into squares among those you will decompress
+#define DECOMPRESSION_USE_SQUARES
+
+// Zero bytes that follow the compressed data (the compressor appends them),
+// so the last word read never goes beyond the end of the array
+#define DECOMPRESSION_DATA_PADDING	3
+
+// Block decoding plans (chosen once per block header)
+#define DECOMPRESSION_PLAN_CONSTANT	0	// All channels keep their base values
+#define DECOMPRESSION_PLAN_FIXED	1	// Fixed window (or raw) channels only
+#define DECOMPRESSION_PLAN_ADAPTIVE	2	// At least one channel uses the adaptive floating window
+
+// Auxilary macro
+#define MASK8_FOR_BITS_COUNT(x)  (0xFF >> (8 - x))
+#define MASK16_FOR_BITS_COUNT(x)  (0xFFFF >> (16 - x))
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+struct DecompressionContext
+{
+	uint8_t numberOfChannels;
+	uint8_t bitsPerChannels[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
+	uint8_t blockSizeBits;
+	uint8_t bitsPerMethodDeclaration[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
+	uint8_t bitsPerFrame;
+#if defined(DECOMPRESSION_USE_SQUARES)
+	bool splitToSquares;
+	uint16_t imageWidth;
+	uint8_t squareSide;
+	uint8_t squaresPerWidth;
+	uint16_t squaresPerWidthSize;
+#endif
+};
+
+
+// Delegate methods declaration
+void frameDecompressed(uint8_t frame);
+void frameRunDecompressed(uint8_t frame, uint16_t count);
+uint16_t colorizePixel(uint8_t frame);
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+class Decompression {
+
+public:
+
+	uint16_t inputBitsBuffer;
+	uint16_t inputByteIndex;
+	uint8_t inputBitsCount;
+
+	uint16_t currentBlockFramesCount;
+	uint8_t currentBlockMethods[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
+	uint8_t currentBaseValues[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+	bool currentBlockAFW[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
+	bool currentBlockFirstFrame;
+#endif
+	uint8_t currentBlockPlan; // Specialized decoding loop chosen by the block header
+
+	// In the case of decompression images divided into squares, 
+	// set this variable to the width of your decompression buffer in pixels.
+	uint8_t bufferWidth;
+
+	void resetDecompression();
+	void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, uint16_t * decompressedData, uint16_t framesCount, bool colorize);
+
+	// Decompression into the output sink (see DecompressionSinks.h).
+	// The sink methods are inlined into the decompression loops.
+	template <class Sink>
+	void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, Sink & sink, uint16_t framesCount);
+
+private:
+
+	void readBlockHeader(DecompressionContext * dc, uint8_t * compressedData);
+	template <class Sink>
+	void decompressRun(DecompressionContext * dc, uint8_t * compressedData, Sink & sink, uint16_t framesCount);
+	template <uint8_t plan, class Sink>
+	void decompressPlannedFrames(DecompressionContext * dc, uint8_t * compressedData, Sink & sink, uint16_t framesCount);
+
+	void refillBits(uint8_t * compressedData);
+	uint16_t peekNextBits(uint8_t * compressedData, uint8_t bitsCount);
+	void skipBits(uint8_t bitsCount);
+	uint16_t readNextBits(uint8_t * compressedData, uint8_t bitsCount);
+
+};
+
+////////////////////////////////////////////////////////////////////////////////////////
+// The sink version of decompressNextFrames() is compiled together with the sink,
+// so the decompression loops and the bits reading live in the header.
+
+// Batch decompression (specified number of frames) into the sink
+template <class Sink>
+void Decompression::decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, Sink & sink, uint16_t framesCount)
+{
+#if defined(DECOMPRESSION_USE_SQUARES)
+	uint8_t row = 0;
+	uint8_t column = 0;
+	uint8_t squareOffset = 0;
+	uint16_t squareLineOffset = 0;
+#endif
+
+	while (framesCount > 0)
+	{
+		if (currentBlockFramesCount == 0)
+		{
+			readBlockHeader(dc, compressedData);
+		}
+
+		// The run of frames that can be decompressed by a single specialized loop
+		uint16_t runLength = (framesCount < currentBlockFramesCount) ? framesCount : currentBlockFramesCount;
+
+#if defined(DECOMPRESSION_USE_SQUARES)
+		// The run must not cross the row of the square
+		if (dc->splitToSquares && (runLength > (uint16_t)(dc->squareSide - column))) runLength = dc->squareSide - column;
+#endif
+
+		decompressRun(dc, compressedData, sink, runLength);
+
+		framesCount -= runLength;
+		currentBlockFramesCount -= runLength;
+
+#if defined(DECOMPRESSION_USE_SQUARES)
+		// Move the output to the next row of the square
+		if (dc->splitToSquares)
+		{
+			column += runLength;
+			if (column >= dc->squareSide)
+			{
+				row++;
+				if (row >= dc->squareSide)
+				{
+					squareOffset += dc->squareSide;
+					if (squareOffset >= dc->imageWidth)
+					{
+						squareLineOffset += dc->squaresPerWidthSize;
+						squareOffset = 0;
+					}
+					row = 0;
+				}
+				column = 0;
+
+				sink.moveTo((uint16_t)(squareLineOffset + squareOffset + row * bufferWidth));
+			}
+		}
+#endif
+
+	}
+
+}
+
+// Select the specialized loop for the block plan
+template <class Sink>
+inline void Decompression::decompressRun(DecompressionContext * dc, uint8_t * compressedData, Sink & sink, uint16_t framesCount)
+{
+	switch (currentBlockPlan)
+	{
+		case DECOMPRESSION_PLAN_CONSTANT:
+			decompressPlannedFrames<DECOMPRESSION_PLAN_CONSTANT>(dc, compressedData, sink, framesCount);
+			break;
+
+		case DECOMPRESSION_PLAN_FIXED:
+			decompressPlannedFrames<DECOMPRESSION_PLAN_FIXED>(dc, compressedData, sink, framesCount);
+			break;
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+		case DECOMPRESSION_PLAN_ADAPTIVE:
+			decompressPlannedFrames<DECOMPRESSION_PLAN_ADAPTIVE>(dc, compressedData, sink, framesCount);
+			break;
+#endif
+	}
+}
+
+// Decompress the run of frames of the current block by the loop specialized
+// for the block plan and the sink: no per-frame decisions are left inside.
+template <uint8_t plan, class Sink>
+inline void Decompression::decompressPlannedFrames(DecompressionContext * dc, uint8_t * compressedData, Sink & sink, uint16_t framesCount)
+{
+	uint8_t frame = 0;
+
+	if (plan == DECOMPRESSION_PLAN_CONSTANT)
+	{
+		// The same frame for the whole block, so the run is written at once
+		for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+		{
+			frame <<= dc->bitsPerChannels[c];
+			frame |= currentBaseValues[c];
+		}
+
+		sink.writeRun(frame, framesCount);
+		return;
+	}
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+	if ((plan == DECOMPRESSION_PLAN_ADAPTIVE) && currentBlockFirstFrame)
+	{
+		// The first frame of the block: adaptive channels return their base values
+		for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+		{
+			uint8_t decompressedValue = currentBaseValues[c];
+			if (!currentBlockAFW[c]) decompressedValue += readNextBits(compressedData, currentBlockMethods[c]);
+			frame <<= dc->bitsPerChannels[c];
+			frame |= decompressedValue;
+		}
+
+		sink.writeFrame(frame);
+		currentBlockFirstFrame = false;
+		framesCount--;
+	}
+#endif
+
+	while (framesCount > 0)
+	{
+		frame = 0;
+		for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+		{
+			uint8_t decompressedValue = currentBaseValues[c];
+
+#if !defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+			if ((plan == DECOMPRESSION_PLAN_ADAPTIVE) && currentBlockAFW[c])
+			{
+				uint8_t windowWidth = (uint8_t)1 << currentBlockMethods[c];
+				uint8_t halfWindowWidth = windowWidth >> 1;
+				uint8_t maxWindowStart = MASK8_FOR_BITS_COUNT(dc->bitsPerChannels[c]) - windowWidth + 1;
+
+				if (halfWindowWidth < decompressedValue) {
+					decompressedValue -= halfWindowWidth;
+					if (decompressedValue > maxWindowStart) decompressedValue = maxWindowStart;
+				} 
+				else
+				{
+					decompressedValue = 0;
+				}
+				decompressedValue += readNextBits(compressedData, currentBlockMethods[c]);
+				currentBaseValues[c] = decompressedValue;
+			}
+			else
+#endif
+
+			{
+				// Constant channels read zero bits here
+				decompressedValue += readNextBits(compressedData, currentBlockMethods[c]);
+			}
+
+			frame <<= dc->bitsPerChannels[c];
+			frame |= decompressedValue;
+		}
+
+		sink.writeFrame(frame);
+		framesCount--;
+	}
+}
+
+// Read compressed data.
+// Channels never exceed 8 bits here, so the loop almost always runs once
+// (only a long block size declaration may need two bytes). Wider loads
+// would only cost extra shifts on the 8-bit core, so we stay byte-wise.
+inline void Decompression::refillBits(uint8_t * compressedData)
+{
+	inputBitsBuffer <<= 8;
+#if defined(AVR)
+	inputBitsBuffer |= pgm_read_byte(compressedData + inputByteIndex);
+#else
+	inputBitsBuffer |= compressedData[inputByteIndex];
+#endif
+	inputBitsCount += 8;
+	inputByteIndex++;
+}
+
+inline uint16_t Decompression::peekNextBits(uint8_t * compressedData, uint8_t bitsCount)
+{
+	if (!bitsCount) return (0);
+	while (inputBitsCount < bitsCount) refillBits(compressedData);
+	return ((inputBitsBuffer >> (inputBitsCount - bitsCount)) & MASK16_FOR_BITS_COUNT(bitsCount));
+}
+
+// Consume bits that were already peeked
+inline void Decompression::skipBits(uint8_t bitsCount)
+{
+	inputBitsCount -= bitsCount;
+}
+
+inline uint16_t Decompression::readNextBits(uint8_t * compressedData, uint8_t bitsCount)
+{
+	uint16_t bits = peekNextBits(compressedData, bitsCount);
+	skipBits(bitsCount);
+	return (bits);
+}
+
+#endif // end _DELTA_DECOMPRESSION_
+
+// END-OF-FILE
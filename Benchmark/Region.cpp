@@ -0,0 +1,215 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+// Host benchmark of the region decompression (the full class on a single example asset,
+// selected at compile time by the Makefile): a part of the image decompressed by
+// decompressRegion() against the whole image decompressed and the part copied from it.
+// Every region is reported as one JSON line with the best times of both ways
+// and the number of the region pixels that differ between them.
+// Then skipFrames() over a half of the image (as the scrolling or the partial redraw
+// needs) is compared with the decompression of these frames into a throwaway buffer.
+
+// Includes
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "Decompression.h"
+#include "Assets.h"
+
+#if (BENCHMARK_IMAGE_WIDTH == 0) || (BENCHMARK_BITS_PER_FRAME > 16)
+#error "The region benchmark needs an image asset of up to 16 bits per pixel"
+#endif
+
+#define BENCHMARK_IMAGE_HEIGHT		(BENCHMARK_NUMBER_OF_FRAMES / BENCHMARK_IMAGE_WIDTH)
+
+// Frames of a row of squares (a row of pixels if the image is not split)
+#define BENCHMARK_BAND_FRAMES		(BENCHMARK_IMAGE_WIDTH * BENCHMARK_SQUARE_SIDE)
+// Skipped frames: a half of the image and a few more (off the edge of the square)
+#define BENCHMARK_SKIP_FRAMES		(BENCHMARK_NUMBER_OF_FRAMES / 2 + 3)
+
+// Minimum measurement time of each way
+#define BENCHMARK_MIN_TIME_NS		100000000.0
+#define BENCHMARK_MIN_REPETITIONS	3
+
+// Regions in 1/8 of the image: left, top, width, height and the shift in pixels
+// (moves the left-top corner, so the region doesn't start at the edge of the square)
+struct BenchmarkRegion
+{
+	const char * name;
+	uint8_t x, y, width, height;
+	uint8_t shift;
+};
+
+static const BenchmarkRegion regions[] = { { "popup", 2, 2, 4, 4, 0 }, { "popup-shifted", 2, 2, 4, 4, 1 },
+	{ "top-strip", 0, 0, 8, 1, 0 }, { "bottom-right", 6, 6, 2, 2, 0 }, { "column", 3, 0, 1, 8, 0 } };
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+static Decompression decomp;
+
+static BenchmarkItem items[BENCHMARK_MAX_ITEMS];
+static uint8_t itemsCount;
+
+static uint16_t image[BENCHMARK_NUMBER_OF_FRAMES];
+static uint16_t fullRegion[BENCHMARK_NUMBER_OF_FRAMES];
+static uint16_t region[BENCHMARK_NUMBER_OF_FRAMES];
+
+// Delegate (not used, since the output goes to the buffer)
+void frameDecompressed(uint64_t frame) {}
+
+static inline double readTime()
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (time.tv_sec * 1e9 + time.tv_nsec);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// The whole image and the copy of the region
+static void decompressFull(const BenchmarkItem * item, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+	decomp.resetDecompression();
+	decomp.bufferWidth = BENCHMARK_IMAGE_WIDTH;
+	DecompressionRGB565Sink<> sink(image);
+	decomp.decompressNextFrames(item->dc, item->data, sink, BENCHMARK_NUMBER_OF_FRAMES);
+
+	for (uint16_t row = 0; row < height; row++)
+	{
+		memcpy(&fullRegion[(uint32_t)row * width], &image[(uint32_t)(y + row) * BENCHMARK_IMAGE_WIDTH + x], width * sizeof(uint16_t));
+	}
+}
+
+// The way to skip the frames without skipFrames(): by the rows of squares into the throwaway buffer
+static void discardFrames(const BenchmarkItem * item, uint32_t framesCount)
+{
+	decomp.resetDecompression();
+	decomp.bufferWidth = BENCHMARK_IMAGE_WIDTH;
+	while (framesCount)
+	{
+		uint32_t frames = (framesCount < BENCHMARK_BAND_FRAMES) ? framesCount : BENCHMARK_BAND_FRAMES;
+		DecompressionRGB565Sink<> sink(region);
+		decomp.decompressNextFrames(item->dc, item->data, sink, frames);
+		framesCount -= frames;
+	}
+}
+
+static void skipFrames(const BenchmarkItem * item, uint32_t framesCount)
+{
+	decomp.resetDecompression();
+	decomp.bufferWidth = BENCHMARK_IMAGE_WIDTH;
+	decomp.skipFrames(item->dc, item->data, framesCount);
+}
+
+// Best time of the way for all the items
+template <class Way>
+static double measure(Way way)
+{
+	double bestTime = 0;
+	double totalTime = 0;
+
+	for (uint32_t r = 0; (r < BENCHMARK_MIN_REPETITIONS) || (totalTime < BENCHMARK_MIN_TIME_NS); r++)
+	{
+		double startTime = readTime();
+		for (uint8_t i = 0; i < itemsCount; i++) way(&items[i]);
+		double time = readTime() - startTime;
+
+		if ((r == 0) || (time < bestTime)) bestTime = time;
+		totalTime += time;
+	}
+	return (bestTime);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char ** argv)
+{
+	itemsCount = benchmarkLoadItems(items);
+
+	for (uint8_t r = 0; r < sizeof(regions) / sizeof(regions[0]); r++)
+	{
+		uint16_t x = regions[r].x * BENCHMARK_IMAGE_WIDTH / 8 + regions[r].shift;
+		uint16_t y = regions[r].y * BENCHMARK_IMAGE_HEIGHT / 8 + regions[r].shift;
+		uint16_t width = regions[r].width * BENCHMARK_IMAGE_WIDTH / 8 - regions[r].shift * 2;
+		uint16_t height = regions[r].height * BENCHMARK_IMAGE_HEIGHT / 8 - regions[r].shift * 2;
+
+		// Verification: the region of every item must be the same both ways
+		uint32_t mismatches = 0;
+		for (uint8_t i = 0; i < itemsCount; i++)
+		{
+			decompressFull(&items[i], x, y, width, height);
+			decomp.decompressRegion(items[i].dc, items[i].data, region, BENCHMARK_IMAGE_WIDTH, x, y, width, height);
+			for (uint32_t p = 0; p < (uint32_t)width * height; p++)
+			{
+				if (region[p] != fullRegion[p]) mismatches++;
+			}
+		}
+
+		double fullTime = measure([&](const BenchmarkItem * item) { decompressFull(item, x, y, width, height); });
+		double regionTime = measure([&](const BenchmarkItem * item) { decomp.decompressRegion(item->dc, item->data, region, BENCHMARK_IMAGE_WIDTH, x, y, width, height); });
+
+		printf("{ \"asset\": \"%s\", \"region\": \"%s\", \"x\": %u, \"y\": %u, \"width\": %u, \"height\": %u, ", BENCHMARK_ASSET_NAME, regions[r].name, x, y, width, height);
+		printf("\"fullUs\": %.2f, \"regionUs\": %.2f, \"speedup\": %.2f, \"mismatches\": %u }\n", fullTime / 1e3, regionTime / 1e3, fullTime / regionTime, mismatches);
+	}
+
+	// Verification of the skip: the rest of the row of squares decompressed after it
+	// must complete the row taken from the whole image (the frames of the image
+	// that is not split go to the beginning of the buffer)
+	uint32_t bandStart = BENCHMARK_SKIP_FRAMES / BENCHMARK_BAND_FRAMES * BENCHMARK_BAND_FRAMES;
+	uint32_t mismatches = 0;
+	for (uint8_t i = 0; i < itemsCount; i++)
+	{
+		decompressFull(&items[i], 0, 0, 0, 0);
+		memcpy(region, &image[bandStart], BENCHMARK_BAND_FRAMES * sizeof(uint16_t));
+
+		skipFrames(&items[i], BENCHMARK_SKIP_FRAMES);
+		DecompressionRGB565Sink<> sink(items[i].dc->splitToSquares ? region : &region[BENCHMARK_SKIP_FRAMES - bandStart]);
+		decomp.decompressNextFrames(items[i].dc, items[i].data, sink, bandStart + BENCHMARK_BAND_FRAMES - BENCHMARK_SKIP_FRAMES);
+		for (uint32_t p = 0; p < BENCHMARK_BAND_FRAMES; p++)
+		{
+			if (region[p] != image[bandStart + p]) mismatches++;
+		}
+	}
+
+	double discardTime = measure([&](const BenchmarkItem * item) { discardFrames(item, BENCHMARK_SKIP_FRAMES); });
+	double skipTime = measure([&](const BenchmarkItem * item) { skipFrames(item, BENCHMARK_SKIP_FRAMES); });
+
+	printf("{ \"asset\": \"%s\", \"skip\": %u, \"decompressUs\": %.2f, \"skipUs\": %.2f, ", BENCHMARK_ASSET_NAME, BENCHMARK_SKIP_FRAMES, discardTime / 1e3, skipTime / 1e3);
+	printf("\"speedup\": %.2f, \"mismatches\": %u }\n", discardTime / skipTime, mismatches);
+
+	return (0);
+}
+
+// END-OF-FILE
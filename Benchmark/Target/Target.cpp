@@ -0,0 +1,466 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Firmware benchmark of a single decompression variant on a single example asset
+// for AVR (ATmega2560, ATtiny85) and Cortex-M (STM32F070, STM32F407).
+// It is built by the Makefile and runs under simavr or Renode (see README.md).
+// The CPU cycles are counted by a hardware timer clocked by the CPU and extended
+// by its overflow interrupt, so the same firmware gives the real numbers on a board.
+// The whole asset is decompressed once by the same calls as in the examples, then once more
+// block by block to get the cycles per block plan (constant, fixed or adaptive window).
+// The results are printed to the console as one JSON line.
+
+// Includes
+#include <stdint.h>
+#include <string.h>
+
+#include "Decompression.h"
+#include "../Assets.h"
+
+// Variant name
+#if defined(BENCHMARK_VARIANT_FULL)
+#define BENCHMARK_VARIANT_NAME	"full"
+#elif defined(BENCHMARK_VARIANT_FAST)
+#define BENCHMARK_VARIANT_NAME	"fast"
+#elif defined(BENCHMARK_VARIANT_PIXEL)
+#define BENCHMARK_VARIANT_NAME	"pixel"
+#elif defined(BENCHMARK_VARIANT_TINY)
+#define BENCHMARK_VARIANT_NAME	"tiny"
+#else
+#error "Select the benchmark variant (BENCHMARK_VARIANT_...)"
+#endif
+
+// Delta option name
+#if defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+#define BENCHMARK_OPTION_NAME	"fwo"
+#elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_ONLY)
+#define BENCHMARK_OPTION_NAME	"afwo"
+#elif defined(DECOMPRESSION_FIXED_WINDOW_FIRST)
+#define BENCHMARK_OPTION_NAME	"fwf"
+#else
+#define BENCHMARK_OPTION_NAME	"afwf"
+#endif
+
+// Frames per decompressNextFrames() call
+#if (BENCHMARK_IMAGE_WIDTH > 0) && (BENCHMARK_SQUARE_SIDE > 1)
+#define BENCHMARK_FRAMES_PER_CALL	(BENCHMARK_IMAGE_WIDTH * BENCHMARK_SQUARE_SIDE)
+#else
+#define BENCHMARK_FRAMES_PER_CALL	4096
+#endif
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Platform: cycle counter, interrupts and console output
+
+#if defined(AVR)
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <avr/sleep.h>
+
+// simavr takes the MCU, its clock and the console register from the firmware itself
+#include "avr_mcu_section.h"
+AVR_MCU(F_CPU, TARGET_NAME);
+AVR_MCU_SIMAVR_CONSOLE(&GPIOR0);
+
+#if defined(TIMSK1)
+// ATmega: 16-bit Timer1 without prescaler
+typedef uint16_t CounterValue;
+#define COUNTER_BITS		16
+#define COUNTER_VALUE()		TCNT1
+#define COUNTER_OVERFLOWED()	(TIFR1 & _BV(TOV1))
+static inline void startCounter() { TCCR1A = 0; TCNT1 = 0; TIMSK1 = _BV(TOIE1); TCCR1B = _BV(CS10); }
+#else
+// ATtiny85: 8-bit Timer1 without prescaler
+typedef uint8_t CounterValue;
+#define COUNTER_BITS		8
+#define COUNTER_VALUE()		TCNT1
+#define COUNTER_OVERFLOWED()	(TIFR & _BV(TOV1))
+static inline void startCounter() { TCNT1 = 0; TIMSK = _BV(TOIE1); TCCR1 = _BV(CS10); }
+#endif
+
+#define COUNTER_INTERRUPT()	ISR(TIMER1_OVF_vect)
+#define DISABLE_INTERRUPTS()	cli()
+#define ENABLE_INTERRUPTS()	sei()
+
+// Interrupt cycles are measured against the exact delay (the 8-bit timer overflows every 256 cycles)
+#define CALIBRATION_CYCLES	1000000UL
+
+// Text constants are kept in the program memory
+#define TEXT(s)			PSTR(s)
+#define TEXT_CHAR(p)		pgm_read_byte(p)
+
+static inline void startConsole() {}
+static inline void writeChar(char c) { GPIOR0 = c; }
+
+// simavr quits when the CPU sleeps with interrupts disabled
+static inline void stop()
+{
+	cli();
+	sleep_enable();
+	for (;;) sleep_cpu();
+}
+
+#else
+
+// Cortex-M: 24-bit SysTick clocked by the CPU
+#define SYST_CSR		(*(volatile uint32_t *)0xE000E010)
+#define SYST_RVR		(*(volatile uint32_t *)0xE000E014)
+#define SYST_CVR		(*(volatile uint32_t *)0xE000E018)
+#define SCB_ICSR		(*(volatile uint32_t *)0xE000ED04)
+
+typedef uint32_t CounterValue;
+#define COUNTER_BITS		24
+#define COUNTER_VALUE()		(0xFFFFFF - SYST_CVR) // SysTick counts down
+#define COUNTER_OVERFLOWED()	(SCB_ICSR & (1UL << 26)) // PENDSTSET
+static inline void startCounter() { SYST_RVR = 0xFFFFFF; SYST_CVR = 0; SYST_CSR = 0x07; } // CPU clock, interrupt, enable
+
+#define COUNTER_INTERRUPT()	extern "C" void SysTick_Handler()
+#define DISABLE_INTERRUPTS()	__asm volatile ("cpsid i" ::: "memory")
+#define ENABLE_INTERRUPTS()	__asm volatile ("cpsie i" ::: "memory")
+
+#define TEXT(s)			(s)
+#define TEXT_CHAR(p)		(*(p))
+
+// Console: USART2 at 115200 from the reset clock (the pins are not configured,
+// the emulator doesn't need them, on a board set up PA2 as USART2_TX)
+#if defined(STM32F0)
+#define RCC_APB1ENR		(*(volatile uint32_t *)0x4002101C)
+#define USART2_CR1		(*(volatile uint32_t *)0x40004400)
+#define USART2_BRR		(*(volatile uint32_t *)0x4000440C)
+#define USART2_ISR		(*(volatile uint32_t *)0x4000441C)
+#define USART2_TDR		(*(volatile uint32_t *)0x40004428)
+#define USART2_ENABLE		0x09 // UE, TE
+#define USART2_BAUD		69 // 8 MHz HSI
+#else
+#define RCC_APB1ENR		(*(volatile uint32_t *)0x40023840)
+#define USART2_ISR		(*(volatile uint32_t *)0x40004400)
+#define USART2_TDR		(*(volatile uint32_t *)0x40004404)
+#define USART2_BRR		(*(volatile uint32_t *)0x40004408)
+#define USART2_CR1		(*(volatile uint32_t *)0x4000440C)
+#define USART2_ENABLE		0x2008 // UE, TE
+#define USART2_BAUD		139 // 16 MHz HSI
+#endif
+
+static inline void startConsole()
+{
+	RCC_APB1ENR |= (1UL << 17); // USART2EN
+	USART2_BRR = USART2_BAUD;
+	USART2_CR1 = USART2_ENABLE;
+}
+
+static inline void writeChar(char c)
+{
+	while (!(USART2_ISR & 0x80)); // TXE
+	USART2_TDR = c;
+}
+
+static inline void stop()
+{
+	for (;;) __asm volatile ("wfi");
+}
+
+// Startup: data and bss initialization, vector table
+extern uint32_t _sidata, _sdata, _edata, _sbss, _ebss, _estack;
+int main();
+COUNTER_INTERRUPT();
+
+extern "C" void Reset_Handler()
+{
+	uint32_t * source = &_sidata;
+	for (uint32_t * destination = &_sdata; destination < &_edata; ) *destination++ = *source++;
+	for (uint32_t * destination = &_sbss; destination < &_ebss; ) *destination++ = 0;
+	main();
+	stop();
+}
+
+extern "C" void Default_Handler()
+{
+	for (;;);
+}
+
+__attribute__((section(".isr_vector"), used))
+static void (* const vectors[16])() = {
+	(void (*)())&_estack, Reset_Handler, Default_Handler, Default_Handler,
+	Default_Handler, Default_Handler, Default_Handler, 0,
+	0, 0, 0, Default_Handler,
+	Default_Handler, 0, Default_Handler, SysTick_Handler
+};
+
+#endif
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Cycle counter: timer value extended by the overflows count
+static volatile uint32_t counterOverflows;
+
+COUNTER_INTERRUPT()
+{
+	counterOverflows++;
+}
+
+static inline uint32_t readCycles(uint32_t * overflows)
+{
+	DISABLE_INTERRUPTS();
+	CounterValue value = COUNTER_VALUE();
+	uint32_t high = counterOverflows;
+	// The overflow that is not handled yet
+	if (COUNTER_OVERFLOWED() && (value < ((CounterValue)1 << (COUNTER_BITS - 1)))) high++;
+	ENABLE_INTERRUPTS();
+
+	*overflows = high;
+	return ((high << COUNTER_BITS) | value);
+}
+
+// Measurement excluding its own overhead and the cycles of the overflow interrupts
+struct Measurement
+{
+	uint32_t cycles;
+	uint32_t overflows;
+};
+
+static uint32_t measurementOverhead;
+static uint16_t interruptCycles;
+
+static inline void startMeasurement(Measurement * measurement)
+{
+	measurement->cycles = readCycles(&measurement->overflows);
+}
+
+static inline uint32_t stopMeasurement(const Measurement * measurement)
+{
+	uint32_t overflows;
+	uint32_t cycles = readCycles(&overflows) - measurement->cycles;
+	return (cycles - measurementOverhead - (overflows - measurement->overflows) * interruptCycles);
+}
+
+static void calibrate()
+{
+	Measurement measurement;
+	startMeasurement(&measurement);
+	measurementOverhead = stopMeasurement(&measurement);
+
+#if defined(CALIBRATION_CYCLES)
+	startMeasurement(&measurement);
+	__builtin_avr_delay_cycles(CALIBRATION_CYCLES);
+	uint32_t overflows;
+	uint32_t cycles = readCycles(&overflows) - measurement.cycles - measurementOverhead;
+	interruptCycles = (cycles - CALIBRATION_CYCLES) / (overflows - measurement.overflows);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Console output
+static void printText(const char * text)
+{
+	char c;
+	while ((c = TEXT_CHAR(text++))) writeChar(c);
+}
+
+static void printNumber(uint32_t value)
+{
+	char digits[10];
+	uint8_t count = 0;
+	do
+	{
+		digits[count++] = '0' + value % 10;
+		value /= 10;
+	} while (value);
+
+	while (count) writeChar(digits[--count]);
+}
+
+// Cycles per frame with two decimal places
+static void printRatio(uint32_t cycles, uint32_t frames)
+{
+	if (!frames) frames = 1;
+	printNumber(cycles / frames);
+	writeChar('.');
+	uint8_t hundredths = ((cycles % frames) * 100) / frames;
+	if (hundredths < 10) writeChar('0');
+	printNumber(hundredths);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Output sink: frames are stored to a volatile variable, so nothing is optimized away,
+// the output costs the same for all variants and no RAM is needed for the buffer.
+struct TargetSink
+{
+	volatile Decompression::Frame lastFrame;
+	volatile uint32_t lastPosition;
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame) { lastFrame = frame; }
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count) { while (count--) lastFrame = frame; }
+
+	inline void moveTo(uint32_t position) { lastPosition = position; }
+};
+
+static Decompression decomp;
+static TargetSink sink;
+
+static BenchmarkItem items[BENCHMARK_MAX_ITEMS];
+static uint8_t itemsCount;
+
+// Statistics per block plan (DECOMPRESSION_PLAN_...)
+struct PlanStatistics
+{
+	uint32_t blocks;
+	uint32_t frames;
+	uint32_t cycles;
+};
+
+static PlanStatistics planStatistics[3];
+
+// Delegates (not used, since the output goes to the sink)
+#if defined(BENCHMARK_VARIANT_FULL)
+void frameDecompressed(uint64_t frame) {}
+#elif defined(BENCHMARK_VARIANT_TINY)
+void frameDecompressed(uint8_t frame) {}
+#else
+void frameDecompressed(uint16_t frame) {}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Decompress the item by the same calls as in the examples
+static void decompressItem(const BenchmarkItem * item)
+{
+	decomp.resetDecompression();
+	decomp.bufferWidth = BENCHMARK_IMAGE_WIDTH;
+
+	uint32_t framesLeft = BENCHMARK_NUMBER_OF_FRAMES;
+	while (framesLeft)
+	{
+		uint32_t framesCount = (framesLeft < BENCHMARK_FRAMES_PER_CALL) ? framesLeft : BENCHMARK_FRAMES_PER_CALL;
+		decomp.decompressNextFrames(item->dc, item->data, sink, framesCount);
+		framesLeft -= framesCount;
+	}
+}
+
+// Decompress the item block by block: the first frame of the block reads its header
+// (so the plan is known), then the rest of the block is decompressed by the second call
+static void decompressItemBlocks(const BenchmarkItem * item)
+{
+	decomp.resetDecompression();
+	decomp.bufferWidth = BENCHMARK_IMAGE_WIDTH;
+
+	uint32_t framesLeft = BENCHMARK_NUMBER_OF_FRAMES;
+	while (framesLeft)
+	{
+		Measurement measurement;
+		startMeasurement(&measurement);
+
+		decomp.decompressNextFrames(item->dc, item->data, sink, 1);
+		uint32_t framesCount = decomp.currentBlockFramesCount;
+		if (framesCount > framesLeft - 1) framesCount = framesLeft - 1;
+		if (framesCount) decomp.decompressNextFrames(item->dc, item->data, sink, framesCount);
+
+		uint32_t cycles = stopMeasurement(&measurement);
+
+		PlanStatistics * statistics = &planStatistics[decomp.currentBlockPlan];
+		statistics->blocks++;
+		statistics->frames += framesCount + 1;
+		statistics->cycles += cycles;
+		framesLeft -= framesCount + 1;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+	startConsole();
+	startCounter();
+	ENABLE_INTERRUPTS();
+	calibrate();
+
+	itemsCount = benchmarkLoadItems(items);
+
+	uint32_t compressedSize = 0;
+	for (uint8_t i = 0; i < itemsCount; i++) compressedSize += items[i].size;
+	uint32_t framesCount = (uint32_t)BENCHMARK_NUMBER_OF_FRAMES * itemsCount;
+
+	// Whole asset
+	Measurement measurement;
+	startMeasurement(&measurement);
+	for (uint8_t i = 0; i < itemsCount; i++) decompressItem(&items[i]);
+	uint32_t cycles = stopMeasurement(&measurement);
+
+	// Block by block
+	for (uint8_t i = 0; i < itemsCount; i++) decompressItemBlocks(&items[i]);
+
+	printText(TEXT("{ \"target\": \"" TARGET_NAME "\", \"variant\": \"" BENCHMARK_VARIANT_NAME "\", \"asset\": \"" BENCHMARK_ASSET_NAME "\", \"option\": \"" BENCHMARK_OPTION_NAME "\", \"items\": "));
+	printNumber(itemsCount);
+	printText(TEXT(", \"frames\": "));
+	printNumber(framesCount);
+	printText(TEXT(", \"compressedBytes\": "));
+	printNumber(compressedSize);
+	printText(TEXT(", \"cycles\": "));
+	printNumber(cycles);
+	printText(TEXT(", \"cyclesPerFrame\": "));
+	printRatio(cycles, framesCount);
+	printText(TEXT(", \"interruptCycles\": "));
+	printNumber(interruptCycles);
+
+	printText(TEXT(", \"plans\": { "));
+	for (uint8_t plan = 0; plan < 3; plan++)
+	{
+		const PlanStatistics * statistics = &planStatistics[plan];
+		if (plan == DECOMPRESSION_PLAN_CONSTANT) printText(TEXT("\"constant\": { \"blocks\": "));
+		else if (plan == DECOMPRESSION_PLAN_FIXED) printText(TEXT(", \"fixed\": { \"blocks\": "));
+		else printText(TEXT(", \"adaptive\": { \"blocks\": "));
+		printNumber(statistics->blocks);
+		printText(TEXT(", \"frames\": "));
+		printNumber(statistics->frames);
+		printText(TEXT(", \"cycles\": "));
+		printNumber(statistics->cycles);
+		printText(TEXT(", \"cyclesPerFrame\": "));
+		printRatio(statistics->cycles, statistics->frames);
+		printText(TEXT(", \"cyclesPerBlock\": "));
+		printRatio(statistics->cycles, statistics->blocks);
+		printText(TEXT(" }"));
+	}
+	printText(TEXT(" } }\n"));
+
+	stop();
+	return (0);
+}
+
+// END-OF-FILE
@@ -56,13 +56,22 @@ namespace DeltaComp
             // The maximum number of elements in a string used to write an array of compressed data
             // in the form of a hexadecimal byte values list.
             public const int ElementsPerRow = 100;
+            // Zero bytes after the compressed data (the last word read of the decoder
+            // may go beyond the end of the data, see DECOMPRESSION_DATA_PADDING).
+            public const int DataPaddingBytes = 3;
             // Write lock request timeout in case we need to write an array by several threads.
             public const int WriterLockTimeout = 1000; // You might wanna change timeout value
             // The limit for issuing an array size warning.
             public const string DataNodeXPath = "//data[@platform='{0}']";
             public const string AllPlatformsIdentifier = "all";
             public const string ChunkSizeAttribute = "chunkSize";
+            public const string ProgmemAttribute = "progmem";
             public const string LimitStringFormat = "// Limit of {0} bytes reached.";
+            // Seek index table (see Decompression::seekToFrame())
+            public const string SeekIndexComment = "// Seek index: the first frame of a block and the bit offset of its header";
+            public const string SeekPointsDefineFormat = "#define {0}_SEEK_POINTS\t\t{1}";
+            public const string SeekIndexFormat = "static const DecompressionSeekPoint {0}SeekIndex[{1}_SEEK_POINTS]{2} = {{";
+            public const string SeekPointFormat = "\t{{{0}, {1}}}";
 
             // Error messages
             public const string ExportAlreadyRunning = "The export already started. To start a new one, you need to finish the current one.";
@@ -79,6 +88,8 @@ namespace DeltaComp
         private bool _isFirstElementWritten = false;
         private int _elementColumn = 0;
         private int _elementIndex = 0;
+        private string _baseName = "";
+        private bool _progmemData = false;
 
         // We will write an array not from the main thread,
         // but there will only be one writing thread, so we do not need a lock.
@@ -132,6 +143,8 @@ namespace DeltaComp
             }
 
             _exportArrayNeeded = withArray;
+            _baseName = baseName;
+            _progmemData = false;
             bool platformDefined = (platform.Length > 0);
 
             // Check if the platform is specified.
@@ -195,6 +208,7 @@ namespace DeltaComp
                 if (dataElement != null)
                 {
                     int.TryParse(dataElement.GetAttribute(Constants.ChunkSizeAttribute), out ChunkSizeWarning);
+                    _progmemData = (dataElement.GetAttribute(Constants.ProgmemAttribute) == "1");
                 }
 
                 XPathNavigator? sourceXmlNavigator = sourceXml.CreateNavigator();
@@ -341,12 +355,27 @@ namespace DeltaComp
 
         // Write the footer to the output file and close it.
         public bool FinalizeExport(out string errorMessage)
+        {
+            return FinalizeExport(null, out errorMessage);
+        }
+
+
+        // The same, but also write the seek index table (if any) after the data array.
+        public bool FinalizeExport(List<Compressor.SeekPoint>? seekIndex, out string errorMessage)
         {
             if (_outputStreamWriter != null)
             {
                 try
                 {
-                    if (_exportArrayNeeded) _outputStreamWriter.WriteLine("};");
+                    if (_exportArrayNeeded)
+                    {
+                        for (int i = 0; i < Constants.DataPaddingBytes; i++)
+                        {
+                            if (!AppendArrayElement(0)) throw new Exception(LastErrorMessage);
+                        }
+                        _outputStreamWriter.WriteLine("};");
+                    }
+                    if ((seekIndex != null) && (seekIndex.Count > 0)) WriteSeekIndex(seekIndex);
                     _outputStreamWriter.WriteLine("");
                     _outputStreamWriter.WriteLine("// END-OF-FILE");
                     _outputStreamWriter.Flush();
@@ -375,6 +404,27 @@ namespace DeltaComp
         }
 
 
+        // Write the seek index as an array of DecompressionSeekPoint structures
+        private void WriteSeekIndex(List<Compressor.SeekPoint> seekIndex)
+        {
+            if (_outputStreamWriter == null) return;
+
+            _outputStreamWriter.WriteLine("");
+            _outputStreamWriter.WriteLine(Constants.SeekIndexComment);
+            _outputStreamWriter.WriteLine(String.Format(Constants.SeekPointsDefineFormat, _baseName.ToUpper(), seekIndex.Count));
+            _outputStreamWriter.WriteLine(String.Format(Constants.SeekIndexFormat, _baseName.ToLower(), _baseName.ToUpper(),
+                _progmemData ? " PROGMEM" : ""));
+
+            for (int i = 0; i < seekIndex.Count; i++)
+            {
+                _outputStreamWriter.Write(String.Format(Constants.SeekPointFormat, seekIndex[i].Frame, seekIndex[i].BitOffset));
+                _outputStreamWriter.WriteLine((i < seekIndex.Count - 1) ? "," : "");
+            }
+
+            _outputStreamWriter.WriteLine("};");
+        }
+
+
         // Check if XML and XSLT files exist
         private bool CheckSourceFilesExist()
         {
@@ -109,8 +109,10 @@ namespace DeltaComp
             public const byte DefaultBlockSizeBits = 8;
             public const byte DefaultWidthOfSquare = 1;
             public const int WaitForTasksSleepDuration = 100;
-            public const int WaitForBestBlockReadyEventTimeout = 1000;
+            public const int WaitForBestBlockReadyTimeout = 1000;
+            public const UInt32 BestBlocksPerTask = 256;
             public const double MinProgressIcrease = 0.1d;
+            public const double EfficiencyBoundMargin = 1e-9d; // For the rounding of the efficiency bound
         }
 
 
@@ -137,11 +139,11 @@ namespace DeltaComp
             public double Efficiency;
         }
 
-        // This one is used to find the best blocks and analyze them in parallel
-        private struct DistributedBlock
+        // A single seek index entry: the first frame of a block and the offset of its header in bits
+        public struct SeekPoint
         {
-            public Block Block;
-            public volatile bool Ready;
+            public UInt32 Frame;
+            public UInt32 BitOffset;
         }
 
         // Source data channels list
@@ -158,12 +160,24 @@ namespace DeltaComp
         private readonly bool _bestBlocksArrayUsed = false;
 
         // Compression global variables
-        private volatile DistributedBlock[] _bestBlocks = null!;
+        // The best blocks found in parallel: a flat table of all frames (the methods and initial values
+        // of the frame take ChannelsCount entries from frame * ChannelsCount) instead of the block objects
+        private UInt32[] _bestBlockLengths = null!;
+        private byte[] _bestBlockMethods = null!;
+        private UInt32[] _bestBlockInitialValues = null!;
+        private double[] _bestBlockEfficiencies = null!;
+        private UInt32[][][] _fixedWindowLengths = null!; // [channel][real method][frame]
+        private UInt32[][][] _fixedWindowInitialValues = null!;
+        private UInt32[][][] _floatingWindowLengths = null!;
         private UInt128 _bitsBuffer = 0;
         private byte _bitsBufferCount = 0;
+        private UInt32 _compressedBitsCount = 0;
 
         // Handling multithreading and workflow operations
-        private EventWaitHandle _bestBlocksBufferEWH = null!;
+        private readonly object _bestBlocksLock = new object();
+        private bool[] _bestBlocksTasksDone = null!;
+        private UInt32 _nextBestBlocksTask = 0;
+        private UInt32 _bestBlocksReady = 0; // All the best blocks before this frame are ready
         private CancellationToken? _cancellationToken = null;
         private bool _waitForTasksFinished = false;
         private bool _fallIntoErrorRequested = false;
@@ -211,7 +225,10 @@ namespace DeltaComp
         }
 
         public bool UseBruteForceBestBlockSearch = true;
+        public bool UseOptimalBlockPartition = false; // The minimum total bits instead of the block search
         public bool SplitToSquares = false;
+        public UInt32 SeekIndexStep = 0; // 0 - don't build the seek index
+        public List<SeekPoint> SeekIndex = new List<SeekPoint>();
         public byte WidthOfSquare
         {
             get { return _widthOfSquare; }
@@ -250,13 +267,7 @@ namespace DeltaComp
 
             TotalFrames = (UInt32)(ImageWidth * ImageHeight);
 
-            if (multithreadedRead)
-            {
-                _bestBlocksArrayUsed = true;
-                _bestBlocks = new DistributedBlock[TotalFrames];
-                for(UInt32 i = 0; i < TotalFrames; i++) _bestBlocks[i].Ready = false;
-                _bestBlocksBufferEWH = new EventWaitHandle(false, EventResetMode.AutoReset);
-            }
+            if (multithreadedRead) _bestBlocksArrayUsed = true;
             
             BlockSizeBits = Constants.DefaultBlockSizeBits;
 
@@ -275,13 +286,7 @@ namespace DeltaComp
 
             TotalFrames = totalFrames;
             
-            if (multithreadedRead)
-            {
-                _bestBlocksArrayUsed = true;
-                _bestBlocks = new DistributedBlock[TotalFrames];
-                for (UInt32 i = 0; i < TotalFrames; i++) _bestBlocks[i].Ready = false;
-                _bestBlocksBufferEWH = new EventWaitHandle(false, EventResetMode.AutoReset);
-            }
+            if (multithreadedRead) _bestBlocksArrayUsed = true;
             
             BlockSizeBits = Constants.DefaultBlockSizeBits;
 
@@ -346,11 +351,15 @@ namespace DeltaComp
             // Let's start from the Preparation stage
             UpdateStatus(CompressionStage.Preparation, 0);
 
+            // The maximum block lengths of all methods for every frame
+            // are calculated once, the search only looks them up.
+            BuildMaxBlockLengths();
+
             // I used this while optimizing the performance of the algorithms
             //var watch = Stopwatch.StartNew();
 
             // Multithreaded search for the best blocks
-            if (_bestBlocksArrayUsed)
+            if (_bestBlocksArrayUsed && !UseOptimalBlockPartition)
             {
                 // We could use Parallel.For for this purpose...
 
@@ -364,7 +373,7 @@ namespace DeltaComp
 
                 Parallel.For(0, TotalFrames, parallelOptions, i =>
                 {
-                    FindBestBlock((UInt32)i);
+                    StoreBestBlock((UInt32)i, GetBestBlock((UInt32)i, TotalFrames));
 
                     //Interlocked.Increment(ref framesDone);
                     framesDone++;
@@ -389,11 +398,16 @@ namespace DeltaComp
             // Process data analysis (building a chain of blocks).
             UpdateStatus(CompressionStage.Analysis, 0);
 
-            var mainBlockChain = SmartBuildBlocks(0, TotalFrames);
+            var mainBlockChain = UseOptimalBlockPartition ? BuildOptimalBlocks() : SmartBuildBlocks(0, TotalFrames);
 
             // Compressing stage
             UpdateStatus(CompressionStage.Compression, 0);
 
+            // Seek points are placed at the beginning of the first block
+            // starting at or after every SeekIndexStep frames
+            SeekIndex.Clear();
+            UInt32 nextSeekFrame = 0;
+
             for (int i = 0; i < mainBlockChain.Count; i++)
             {
                 // First, check whether the compression cancellation has been requested
@@ -413,6 +427,12 @@ namespace DeltaComp
                     mainBlockChain[i].StartFrame + mainBlockChain[i].Length, mainBlockChain[i].Length);
                 */
 
+                if ((SeekIndexStep > 0) && (mainBlockChain[i].StartFrame >= nextSeekFrame))
+                {
+                    SeekIndex.Add(new SeekPoint { Frame = mainBlockChain[i].StartFrame, BitOffset = _compressedBitsCount });
+                    nextSeekFrame = mainBlockChain[i].StartFrame + SeekIndexStep;
+                }
+
                 CompressBlock(mainBlockChain[i]);
                 UpdateStatus(CompressionStage.Compression, mainBlockChain[i].StartFrame + mainBlockChain[i].Length);
             }
@@ -544,24 +564,94 @@ namespace DeltaComp
         // Run a multithreaded search for the most effective blocks
         private async void FillBestBlocksArray()
         {
-            List<Task> tasks = new List<Task>();
-            for (UInt32 i = 0; i < TotalFrames; i++)
+            // The table is allocated here, since the channels configuration may change between the compressions
+            _bestBlockLengths = new UInt32[TotalFrames];
+            _bestBlockMethods = new byte[TotalFrames * ChannelsCount];
+            _bestBlockInitialValues = new UInt32[TotalFrames * ChannelsCount];
+            _bestBlockEfficiencies = new double[TotalFrames];
+            _bestBlocksTasksDone = new bool[(TotalFrames + Constants.BestBlocksPerTask - 1) / Constants.BestBlocksPerTask];
+            _nextBestBlocksTask = 0;
+            Volatile.Write(ref _bestBlocksReady, 0);
+
+            // Let's limit the number of parallel tasks by the number of processors,
+            // each of them takes the frames by the small tasks until the end of the data
+            Task[] tasks = new Task[Environment.ProcessorCount];
+            for (int i = 0; i < tasks.Length; i++)
             {
-                UInt32 position = i;
-                tasks.Add(Task.Run(() => { FindBestBlock(position); }));
+                tasks[i] = Task.Run(() => { FindBestBlocks(); });
+            }
+            await Task.WhenAll(tasks);
+            _waitForTasksFinished = false;
+        }
 
-                // Let's limit the number of parallel tasks by the number of processors
-                if (tasks.Count >= Environment.ProcessorCount)
-                {
-                    tasks.Remove(await Task.WhenAny(tasks.ToArray()));
-                }
 
-                // And we have to check if cancellation was requested
+        // This one is used for multithreaded search of the best blocks for each frame.
+        private void FindBestBlocks()
+        {
+            while (true)
+            {
+                // We have to check if cancellation was requested
                 if ((_fallIntoErrorRequested) || 
                     ((_cancellationToken != null) && _cancellationToken.Value.IsCancellationRequested)) break;
+
+                UInt32 task = Interlocked.Increment(ref _nextBestBlocksTask) - 1;
+                if (task >= _bestBlocksTasksDone.Length) break;
+
+                UInt32 position = task * Constants.BestBlocksPerTask;
+                UInt32 end = ((TotalFrames - position) > Constants.BestBlocksPerTask) ? position + Constants.BestBlocksPerTask : TotalFrames;
+                for (; position < end; position++) StoreBestBlock(position, GetBestBlock(position, TotalFrames));
+
+                // The tasks may finish in any order, so the ready frames are moved forward
+                // through all the finished tasks following the last ready one
+                lock (_bestBlocksLock)
+                {
+                    _bestBlocksTasksDone[task] = true;
+
+                    UInt32 ready = _bestBlocksReady;
+                    while ((ready < TotalFrames) && _bestBlocksTasksDone[ready / Constants.BestBlocksPerTask])
+                    {
+                        ready = ((TotalFrames - ready) > Constants.BestBlocksPerTask) ? ready + Constants.BestBlocksPerTask : TotalFrames;
+                    }
+                    Volatile.Write(ref _bestBlocksReady, ready);
+                    Monitor.PulseAll(_bestBlocksLock);
+                }
             }
-            await Task.WhenAll(tasks.ToArray());
-            _waitForTasksFinished = false;
+        }
+
+
+        // Save the best block of the frame into the table
+        private void StoreBestBlock(UInt32 position, Block block)
+        {
+            _bestBlockLengths[position] = block.Length;
+            _bestBlockEfficiencies[position] = block.Efficiency;
+            Array.Copy(block.Methods, 0, _bestBlockMethods, position * ChannelsCount, ChannelsCount);
+            Array.Copy(block.InitialValues, 0, _bestBlockInitialValues, position * ChannelsCount, ChannelsCount);
+        }
+
+
+        // Wait for the best block of the frame and get it from the table
+        private Block GetStoredBestBlock(UInt32 position)
+        {
+            while (Volatile.Read(ref _bestBlocksReady) <= position)
+            {
+                lock (_bestBlocksLock)
+                {
+                    if (_bestBlocksReady <= position) Monitor.Wait(_bestBlocksLock, Constants.WaitForBestBlockReadyTimeout);
+                }
+
+                // The search tasks stop if cancellation was requested
+                CheckCompressionCanceled();
+            }
+
+            Block block = new Block();
+            block.StartFrame = position;
+            block.Length = _bestBlockLengths[position];
+            block.Efficiency = _bestBlockEfficiencies[position];
+            block.Methods = new byte[ChannelsCount];
+            block.InitialValues = new UInt32[ChannelsCount];
+            Array.Copy(_bestBlockMethods, position * ChannelsCount, block.Methods, 0, ChannelsCount);
+            Array.Copy(_bestBlockInitialValues, position * ChannelsCount, block.InitialValues, 0, ChannelsCount);
+            return (block);
         }
 
 
@@ -591,17 +681,13 @@ namespace DeltaComp
                 // We will better use the best blocks prepared earlier (if any)
                 // Single-threaded version
                 //Block currentBlock = ((boundary == TotalFrames) && _bestBlocksArrayUsed) ? 
-                //    _bestBlocks[currentPosition].Block : GetBestBlock(currentPosition, boundary);
+                //    GetStoredBestBlock(currentPosition) : GetBestBlock(currentPosition, boundary);
 
-                // Multithreaded version
+                // Multithreaded version (the block is taken from the table when it's ready)
                 Block currentBlock;
                 if ((boundary == TotalFrames) && (_bestBlocksArrayUsed))
                 {
-                    while (!_bestBlocks[currentPosition].Ready)
-                    {
-                        _bestBlocksBufferEWH.WaitOne(Constants.WaitForBestBlockReadyEventTimeout);
-                    }
-                    currentBlock = _bestBlocks[currentPosition].Block;
+                    currentBlock = GetStoredBestBlock(currentPosition);
                 }
                 else
                 {
@@ -682,12 +768,159 @@ namespace DeltaComp
         }
 
 
-        // This one is used for multithreaded search of the best blocks for each frame.
-        private void FindBestBlock(UInt32 position)
+        // Build the chain of blocks with the minimum total number of bits.
+        // The block boundaries are the shortest path over the frame positions:
+        // the block [position, position + length) costs GetBitsPerBlock() with the cheapest
+        // method of each channel that is still applicable at this length. Only the lengths
+        // up to the longest compressed method are checked one by one, the longer blocks
+        // are uncompressed in all channels, so their cost is linear and the best of them
+        // is the minimum of the sliding window of the previous positions.
+        private List<Block> BuildOptimalBlocks()
         {
-            _bestBlocks[position].Block = GetBestBlock(position, TotalFrames);
-            _bestBlocks[position].Ready = true;
-            _bestBlocksBufferEWH.Set();
+            UInt64[] bits = new UInt64[TotalFrames + 1];
+            UInt32[] previous = new UInt32[TotalFrames + 1];
+            UInt32[] rawQueue = new UInt32[TotalFrames];
+            UInt32 rawHead = 0, rawTail = 0;
+            byte[] fixedWidths = new byte[ChannelsCount];
+            byte[] floatingWidths = new byte[ChannelsCount];
+
+            for (UInt32 i = 1; i <= TotalFrames; i++) bits[i] = UInt64.MaxValue;
+
+            for (UInt32 position = 0; position <= TotalFrames; position++)
+            {
+                // Uncompressed blocks ending here
+                if (position > 0)
+                {
+                    UInt32 last = position - 1;
+                    while ((rawHead < rawTail) && (GetRawPathBits(bits, rawQueue[rawTail - 1]) >= GetRawPathBits(bits, last))) rawTail--;
+                    rawQueue[rawTail++] = last;
+                    if ((position - rawQueue[rawHead]) > _maxBlockSize) rawHead++;
+
+                    UInt64 rawBits = (UInt64)(GetRawPathBits(bits, rawQueue[rawHead]) + _headerBits + (Int64)BitsPerFrame * position);
+                    if (rawBits < bits[position])
+                    {
+                        bits[position] = rawBits;
+                        previous[position] = rawQueue[rawHead];
+                    }
+                }
+
+                if (position == TotalFrames) break;
+
+                CheckCompressionCanceled();
+                UpdateStatus(CompressionStage.Analysis, position);
+
+                // The longest compressed method at this position limits the lengths to check
+                UInt32 limit = ((TotalFrames - position) > _maxBlockSize) ? _maxBlockSize : TotalFrames - position;
+                UInt32 bound = 0;
+                for (byte c = 0; c < ChannelsCount; c++)
+                {
+                    fixedWidths[c] = 0;
+                    floatingWidths[c] = 0;
+                    for (byte w = 0; w < BitsPerChannel[c]; w++)
+                    {
+                        if ((_fixedWindowLengths[c][w] != null) && (_fixedWindowLengths[c][w][position] > bound)) bound = _fixedWindowLengths[c][w][position];
+                        if ((_floatingWindowLengths[c][w] != null) && (_floatingWindowLengths[c][w][position] > bound)) bound = _floatingWindowLengths[c][w][position];
+                    }
+                }
+                if (bound > limit) bound = limit;
+
+                for (UInt32 length = 1; length <= bound; length++)
+                {
+                    UInt64 blockBits = _headerBits;
+                    for (byte c = 0; c < ChannelsCount; c++)
+                    {
+                        // The narrowest applicable window is the cheapest one,
+                        // and it can only become wider as the block grows
+                        fixedWidths[c] = GetApplicableWidth(_fixedWindowLengths[c], fixedWidths[c], position, length);
+                        floatingWidths[c] = GetApplicableWidth(_floatingWindowLengths[c], floatingWidths[c], position, length);
+                        blockBits += GetOptimalChannelBits(c, length, fixedWidths[c], floatingWidths[c]);
+                    }
+
+                    if ((bits[position] + blockBits) < bits[position + length])
+                    {
+                        bits[position + length] = bits[position] + blockBits;
+                        previous[position + length] = position;
+                    }
+                }
+            }
+
+            // Collect the blocks from the end of the path
+            var mainBlockChain = new List<Block>();
+            for (UInt32 end = TotalFrames; end > 0; end = previous[end])
+            {
+                Block block = new Block();
+                block.StartFrame = previous[end];
+                block.Length = end - block.StartFrame;
+                block.Methods = new byte[ChannelsCount];
+                block.InitialValues = new UInt32[ChannelsCount];
+
+                for (byte c = 0; c < ChannelsCount; c++)
+                {
+                    byte fixedWidth = GetApplicableWidth(_fixedWindowLengths[c], 0, block.StartFrame, block.Length);
+                    byte floatingWidth = GetApplicableWidth(_floatingWindowLengths[c], 0, block.StartFrame, block.Length);
+                    UInt64 channelBits = (UInt64)block.Length * BitsPerChannel[c];
+                    block.Methods[c] = BitsPerChannel[c];
+
+                    if ((fixedWidth < BitsPerChannel[c]) && ((BitsPerChannel[c] + (UInt64)block.Length * fixedWidth) < channelBits))
+                    {
+                        channelBits = BitsPerChannel[c] + (UInt64)block.Length * fixedWidth;
+                        block.Methods[c] = GetMethodIndex(c, fixedWidth, false);
+                        block.InitialValues[c] = _fixedWindowInitialValues[c][fixedWidth][block.StartFrame];
+                    }
+
+                    if ((floatingWidth < BitsPerChannel[c]) && ((BitsPerChannel[c] + (UInt64)(block.Length - 1) * floatingWidth) < channelBits))
+                    {
+                        block.Methods[c] = GetMethodIndex(c, floatingWidth, true);
+                        block.InitialValues[c] = GetFrameForChannel(block.StartFrame, c);
+                    }
+                }
+
+                block.Efficiency = GetBlockEfficiency(block.Length, block.Methods);
+                mainBlockChain.Add(block);
+            }
+
+            mainBlockChain.Reverse();
+            return (mainBlockChain);
+        }
+
+
+        // Bits of the path to the position minus the bits of the frames before it
+        // (the uncompressed blocks starting at the position are compared by this value)
+        private Int64 GetRawPathBits(UInt64[] bits, UInt32 position)
+        {
+            return ((Int64)bits[position] - (Int64)BitsPerFrame * position);
+        }
+
+
+        // The narrowest window (starting from the specified one) with the block length
+        // not less than the specified one, or the bit depth of the channel if there is none
+        private byte GetApplicableWidth(UInt32[][] lengths, byte width, UInt32 position, UInt32 length)
+        {
+            while ((width < lengths.Length) && ((lengths[width] == null) || (lengths[width][position] < length))) width++;
+            return (width);
+        }
+
+
+        // The bits of the cheapest method of the channel for the block length
+        private UInt64 GetOptimalChannelBits(byte channel, UInt32 length, byte fixedWidth, byte floatingWidth)
+        {
+            byte bitDepth = BitsPerChannel[channel];
+            UInt64 channelBits = (UInt64)length * bitDepth;
+            if ((fixedWidth < bitDepth) && ((bitDepth + (UInt64)length * fixedWidth) < channelBits)) channelBits = bitDepth + (UInt64)length * fixedWidth;
+            if ((floatingWidth < bitDepth) && ((bitDepth + (UInt64)(length - 1) * floatingWidth) < channelBits)) channelBits = bitDepth + (UInt64)(length - 1) * floatingWidth;
+            return (channelBits);
+        }
+
+
+        // The method index of the window width and type for the delta option used
+        private byte GetMethodIndex(byte channel, byte width, bool afw)
+        {
+            for (byte m = 0; m < GetMethodsCount(channel); m++)
+            {
+                bool methodAfw = false;
+                if ((GetRealMethod(m, BitsPerChannel[channel], ref methodAfw) == width) && (methodAfw == afw)) return (m);
+            }
+            return (BitsPerChannel[channel]);
         }
 
 
@@ -781,7 +1014,10 @@ namespace DeltaComp
         {
             Block bestBlock = new Block();
             Method[] currentMethods = new Method[ChannelsCount];
+            byte[] methods = new byte[ChannelsCount];
             bestBlock.StartFrame = position;
+            bestBlock.Methods = new byte[ChannelsCount];
+            bestBlock.InitialValues = new UInt32[ChannelsCount];
             bestBlock.Efficiency = double.MinValue;
 
             // Calculate in advance and save the applicability of all possible methods for all channels
@@ -813,46 +1049,77 @@ namespace DeltaComp
                 }
             }
 
+            // The bits per frame of every channel can't be less than the best one of its methods
+            // (the longer the block, the fewer bits per frame), so the sums of them for the channels
+            // after the current one bound the efficiency of the combinations not finished yet.
+            double[] minBitsPerFrame = new double[ChannelsCount + 1];
+            for (int c = ChannelsCount - 1; c >= 0; c--)
+            {
+                double channelMinBits = double.MaxValue;
+                for (byte m = 0; m < allMethods[c].Length; m++)
+                {
+                    UInt32 length = (allMethods[c][m].Length < (boundary - position)) ? allMethods[c][m].Length : boundary - position;
+                    double bits = (double)GetCompressedBitsForMethod(length, m, BitsPerChannel[c]) / length;
+                    if (bits < channelMinBits) channelMinBits = bits;
+                }
+                minBitsPerFrame[c] = minBitsPerFrame[c + 1] + channelMinBits;
+            }
+
+            // The block of the fast search is one of the combinations (or a shorter one),
+            // so the combinations which can't reach its efficiency are skipped from the start.
+            double minEfficiency = GetBestBlockFast(position, boundary).Efficiency - Constants.EfficiencyBoundMargin;
+
             // Run recursive combinations search
-            SearchBestBlockRecursive(position, boundary, 0, ref currentMethods, ref allMethods, ref bestBlock);
+            SearchBestBlockRecursive(position, boundary, 0, ref currentMethods, ref allMethods, ref bestBlock, methods, minBitsPerFrame, minEfficiency);
             return (bestBlock);
         }
 
 
         // Recursive search for the best block by sequentially iterating through all methods of all channels
         private void SearchBestBlockRecursive(UInt32 position, UInt32 boundary, byte currentChannel, 
-            ref Method[] currentMethods, ref Method[][] allMethods, ref Block bestBlock)
+            ref Method[] currentMethods, ref Method[][] allMethods, ref Block bestBlock, byte[] methods, double[] minBitsPerFrame, double minEfficiency)
         {
             for (byte m = 0; m < GetMethodsCount(currentChannel); m++)
             {
                 currentMethods[currentChannel] = allMethods[currentChannel][m];
+                methods[currentChannel] = m;
+
+                // Trim the length to the shortest method chosen so far,
+                // this is OK here, since we will eventually go through all the combinations.
+                UInt32 minLength = boundary - position;
+                for (byte c = 0; c <= currentChannel; c++)
+                {
+                    if (minLength > currentMethods[c].Length) minLength = currentMethods[c].Length;
+                }
 
                 byte nextChannel = (byte)(currentChannel + 1);
                 if (nextChannel < ChannelsCount)
                 {
-                    // If current channel is not the last one then run recursive search for the next one.
-                    SearchBestBlockRecursive(position, boundary, nextChannel, ref currentMethods, ref allMethods, ref bestBlock);
-                } else
-                {
-                    // If the channel is the last one, then trim the length to the shortest method,
-                    // this is OK here, since we will eventually go through all the combinations.
-                    UInt32 minLength = boundary - position;
-                    byte[] methods = new byte[ChannelsCount];
-                    UInt32[] initialValues = new UInt32[ChannelsCount];
-                    for (byte c = 0; c < ChannelsCount; c++)
+                    // The next channels can only shorten the block, so skip the combinations
+                    // which can't be better than the best one found even with their best methods.
+                    UInt64 bits = _headerBits;
+                    for (byte c = 0; c <= currentChannel; c++)
                     {
-                        if (minLength > currentMethods[c].Length) minLength = currentMethods[c].Length;
-                        methods[c] = currentMethods[c].Index;
-                        initialValues[c] = currentMethods[c].InitialValue;
+                        bits += GetCompressedBitsForMethod(minLength, methods[c], BitsPerChannel[c]);
                     }
+                    double maxEfficiency = 1.0d - ((double)bits / minLength + minBitsPerFrame[nextChannel]) / BitsPerFrame;
+                    if ((maxEfficiency < minEfficiency) || 
+                        (maxEfficiency < (bestBlock.Efficiency - Constants.EfficiencyBoundMargin))) continue;
 
+                    // If current channel is not the last one then run recursive search for the next one.
+                    SearchBestBlockRecursive(position, boundary, nextChannel, ref currentMethods, ref allMethods, ref bestBlock, methods, minBitsPerFrame, minEfficiency);
+                } else
+                {
                     // Calculate the efficiency and if it is better than previously found, then save this combination.
                     double efficiency = GetBlockEfficiency(minLength, methods);
 
                     if (efficiency > bestBlock.Efficiency)
                     {
-                        bestBlock.Methods = methods;
-                        bestBlock.InitialValues = initialValues;
+                        for (byte c = 0; c < ChannelsCount; c++)
+                        {
+                            bestBlock.Methods[c] = methods[c];
+                            bestBlock.InitialValues[c] = currentMethods[c].InitialValue;
+                        }
                         bestBlock.Length = minLength;
                         bestBlock.Efficiency = efficiency;
                     }
@@ -922,49 +1189,121 @@ namespace DeltaComp
         // see the link at the beginning of the file)
         private UInt32 GetMaxBlockLength(UInt32 position, byte method, byte channel, out UInt32 initialValue)
         {
-            initialValue = 0;
-            UInt32 length = 0;
-            UInt32 min = UInt32.MaxValue;
-            UInt32 max = 0;
-            UInt32 maxDelta = (UInt32)(Math.Pow(2, method) - 1);
+            initialValue = _fixedWindowInitialValues[channel][method][position];
+            return (_fixedWindowLengths[channel][method][position]);
+        }
 
-            while ((length < _maxBlockSize) && (position < TotalFrames))
+
+        // Get maximum Adaptive Floating Window block length
+        // (I gave a detailed description in the 1st sprint,
+        // see the link at the beginning of the file)
+        private UInt32 GetMaxBlockLength3(UInt32 position, byte method, byte channel, out UInt32 initialValue)
+        {
+            initialValue = GetFrameForChannel(position, channel);
+            return (_floatingWindowLengths[channel][method][position]);
+        }
+
+
+        // Calculate the maximum block lengths of the methods used for every frame.
+        // Scanning the data from every position again costs up to _maxBlockSize frames
+        // per position, method and channel, but the neighboring positions share almost
+        // the whole window, so a single pass per method is enough.
+        private void BuildMaxBlockLengths()
+        {
+            _fixedWindowLengths = new UInt32[ChannelsCount][][];
+            _fixedWindowInitialValues = new UInt32[ChannelsCount][][];
+            _floatingWindowLengths = new UInt32[ChannelsCount][][];
+
+            UInt32[] frames = new UInt32[TotalFrames];
+            UInt32[] minQueue = new UInt32[TotalFrames];
+            UInt32[] maxQueue = new UInt32[TotalFrames];
+
+            for (byte c = 0; c < ChannelsCount; c++)
             {
-                UInt32 currentFrame = GetFrameForChannel(position, channel);
-                if (currentFrame < min) min = currentFrame;
-                if (currentFrame > max) max = currentFrame;
-                if ((max - min) > maxDelta)
+                for (UInt32 i = 0; i < TotalFrames; i++) frames[i] = GetFrameForChannel(i, c);
+
+                _fixedWindowLengths[c] = new UInt32[BitsPerChannel[c]][];
+                _fixedWindowInitialValues[c] = new UInt32[BitsPerChannel[c]][];
+                _floatingWindowLengths[c] = new UInt32[BitsPerChannel[c]][];
+
+                for (byte m = 0; m < GetMethodsCount(c); m++)
                 {
-                    break;
+                    bool afw = false;
+                    byte realMethod = GetRealMethod(m, BitsPerChannel[c], ref afw);
+                    if (realMethod == BitsPerChannel[c]) continue;
+
+                    if (afw)
+                    {
+                        if (_floatingWindowLengths[c][realMethod] != null) continue;
+                        _floatingWindowLengths[c][realMethod] = new UInt32[TotalFrames];
+                        FillFloatingWindowLengths(frames, realMethod, c, _floatingWindowLengths[c][realMethod]);
+                    }
+                    else
+                    {
+                        if (_fixedWindowLengths[c][realMethod] != null) continue;
+                        _fixedWindowLengths[c][realMethod] = new UInt32[TotalFrames];
+                        _fixedWindowInitialValues[c][realMethod] = new UInt32[TotalFrames];
+                        FillFixedWindowLengths(frames, realMethod, _fixedWindowLengths[c][realMethod],
+                            _fixedWindowInitialValues[c][realMethod], minQueue, maxQueue);
+                    }
                 }
-                else
+            }
+        }
+
+
+        // Fixed Window: the window [position, end) only moves forward, so the minimum and maximum
+        // of its frames are kept in the monotonic queues (of the frame numbers), each frame
+        // gets into the queues and leaves them once.
+        private void FillFixedWindowLengths(UInt32[] frames, byte method, UInt32[] lengths, UInt32[] initialValues,
+            UInt32[] minQueue, UInt32[] maxQueue)
+        {
+            UInt32 maxDelta = (UInt32)(Math.Pow(2, method) - 1);
+            UInt32 minHead = 0, minTail = 0, maxHead = 0, maxTail = 0;
+            UInt32 end = 0;
+
+            for (UInt32 position = 0; position < TotalFrames; position++)
+            {
+                // The previous frame leaves the window
+                if ((minHead < minTail) && (minQueue[minHead] < position)) minHead++;
+                if ((maxHead < maxTail) && (maxQueue[maxHead] < position)) maxHead++;
+
+                UInt32 limit = ((TotalFrames - position) > _maxBlockSize) ? position + _maxBlockSize : TotalFrames;
+                while (end < limit)
                 {
-                    initialValue = min;
-                    length++;
-                    position++;
+                    UInt32 currentFrame = frames[end];
+                    UInt32 min = ((minHead < minTail) && (frames[minQueue[minHead]] < currentFrame)) ? frames[minQueue[minHead]] : currentFrame;
+                    UInt32 max = ((maxHead < maxTail) && (frames[maxQueue[maxHead]] > currentFrame)) ? frames[maxQueue[maxHead]] : currentFrame;
+                    if ((max - min) > maxDelta) break;
+
+                    while ((minHead < minTail) && (frames[minQueue[minTail - 1]] >= currentFrame)) minTail--;
+                    minQueue[minTail++] = end;
+                    while ((maxHead < maxTail) && (frames[maxQueue[maxTail - 1]] <= currentFrame)) maxTail--;
+                    maxQueue[maxTail++] = end;
+                    end++;
                 }
-            }
 
-            return (length);
+                lengths[position] = end - position;
+                initialValues[position] = frames[minQueue[minHead]];
+            }
         }
 
 
-        // Get maximum Adaptive Floating Window block length
-        // (I gave a detailed description in the 1st sprint,
-        // see the link at the beginning of the file)
-        private UInt32 GetMaxBlockLength3(UInt32 position, byte method, byte channel, out UInt32 initialValue)
+        // Adaptive Floating Window: the window of every frame depends only on the previous one,
+        // so the block of the position is the frame itself and the block of the next position
+        // if they are compatible (calculated from the end of the data).
+        private void FillFloatingWindowLengths(UInt32[] frames, byte method, byte channel, UInt32[] lengths)
         {
-            UInt32 lastFrame = GetFrameForChannel(position++, channel);
-            initialValue = lastFrame;
-
             UInt32 windowWidth = (UInt32)Math.Pow(2, method);
             UInt32 halfWindowWidth = windowWidth >> 1;
             UInt32 frameWidth = (UInt32)Math.Pow(2, BitsPerChannel[channel]);
             UInt32 maxFrameStart = frameWidth - windowWidth;
-            UInt32 length = 1;
 
-            while ((length < _maxBlockSize) && (position < TotalFrames))
+            if (TotalFrames == 0) return;
+            lengths[TotalFrames - 1] = 1;
+
+            for (UInt32 position = TotalFrames - 1; position-- > 0;)
             {
+                UInt32 lastFrame = frames[position];
                 UInt32 windowStart;
                 if (halfWindowWidth < lastFrame)
                 {
@@ -976,20 +1315,16 @@ namespace DeltaComp
                     windowStart = 0;
                 }
 
-                UInt32 currentFrame = GetFrameForChannel(position, channel);
+                UInt32 currentFrame = frames[position + 1];
                 if ((currentFrame >= windowStart) && ((currentFrame - windowStart) < windowWidth))
                 {
-                    lastFrame = currentFrame;
-                    length++;
-                    position++;
+                    lengths[position] = (lengths[position + 1] < _maxBlockSize) ? lengths[position + 1] + 1 : _maxBlockSize;
                 }
                 else
                 {
-                    break;
+                    lengths[position] = 1;
                 }
             }
-
-            return (length);
         }
 
 
@@ -1252,6 +1587,7 @@ namespace DeltaComp
             _bitsBuffer <<= count;
             _bitsBuffer |= bits;
             _bitsBufferCount += count;
+            _compressedBitsCount += count;
 
             while (_bitsBufferCount >= 8)
             {
@@ -89,6 +89,14 @@ Examples:
 	/AVR/Arduino_boards/Nano_ST7789_Tiny (Arduino Nano + ST7789 240x240 display),
 	/AVR/ATtiny85 (ATtiny85 chip + SPI output).
 
+All the modifications are configurations of the same decompression template (DeltaDecoder.h),
+so copy DeltaDecoder.h and DecompressionSinks.h from /Decompression along with them.
+
+The decoder reads the compressed data by words of up to 4 bytes, so the last read may go
+up to 3 bytes beyond the end of the data. The compressor appends
+DECOMPRESSION_DATA_PADDING (3) zero bytes to every exported data array,
+so if you prepare the data in some other way, then append them too.
+
 * Relevant only for the AVR platform.
 ** To do this, a pointer to an array of far pointers should be passed 
 to the decompression procedure instead of a direct pointer to a data array:
@@ -121,6 +129,7 @@ Sprint 3 - https://www.patreon.com/posts/delta-encoding-3-108236064
 
 // Includes
 #include <stdint.h>
+#include "DeltaDecoder.h"
 
 #if defined(AVR)
 #include <avr/pgmspace.h>
@@ -161,15 +170,34 @@ Sprint 3 - https://www.patreon.com/posts/delta-encoding-3-108236064
 // Hide the string below if you don't want to use far memory and chunks.
 #define USE_FAR_MEMORY_CHUNKS
 // For example, we can divide the data by 16K chunks.
+// The size must be a multiple of 4, because data is read by 4-byte words.
 #define CHUNK_SIZE	16384
 
 #endif
 
+// Delta option for the decompression template
+#if defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_FIXED_WINDOW_ONLY
+#elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_ONLY)
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_ONLY
+#elif defined(DECOMPRESSION_FIXED_WINDOW_FIRST)
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST
+#else
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_FIRST
+#endif
+
 
 ////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////
 
+// Pointer to the compressed data (or to the array of far chunks)
+#if defined(USE_FAR_MEMORY_CHUNKS)
+typedef uint_farptr_t * CompressedDataPointer;
+#else
+typedef const uint8_t * CompressedDataPointer;
+#endif
+
 struct DecompressionContext
 {
 	uint8_t numberOfChannels;
@@ -186,52 +214,49 @@ struct DecompressionContext
 #endif
 };
 
-
-// Delegate method declaration
+// Delegate methods declaration
 void frameDecompressed(uint64_t frame);
+void frameRunDecompressed(uint64_t frame, uint32_t count);
 
 
 ////////////////////////////////////////////////////////////////////////////////////////
 
-class Decompression {
-
-public:
-
-	uint64_t inputBitsBuffer;
-#if defined(USE_FAR_MEMORY_CHUNKS)
-	uint8_t inputChunkIndex; // Additional variable for ROM chunk index
+// Configuration of the decompression template (see DeltaDecoder.h)
+struct DecompressionConfig
+{
+	typedef DecompressionContext Context;
+	typedef CompressedDataPointer CompressedData;
+	typedef uint64_t BitsBuffer;
+	typedef uint32_t ReadBits;
+	typedef uint32_t ChannelValue;
+	typedef uint64_t Frame;
+	typedef uint32_t FramesCounter;
+	typedef uint32_t ByteIndex;
+	typedef uint32_t Position;
+
+	static const uint8_t maxNumberOfChannels = DECOMPRESSION_MAX_NUMBER_OF_CHANNELS;
+	static const uint8_t deltaOption = DECOMPRESSION_DELTA_OPTION;
+#if defined(DECOMPRESSION_USE_SQUARES)
+	static const bool useSquares = true;
+#else
+	static const bool useSquares = false;
 #endif
-	uint32_t inputByteIndex;
-	uint8_t inputBitsCount;
-
-	uint32_t currentBlockFramesCount;
-	uint8_t currentBlockMethods[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
-	uint32_t currentBaseValues[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
-
-	uint64_t outputBitsBuffer; // For larger frames we need wider variable, but uint64 is all we can afford.
-	uint8_t outputBitsCount;
-
-	// In the case of decompression images divided into squares, 
-	// set this variable to the width of your decompression buffer in pixels.
-	uint16_t bufferWidth;
-
-	void resetDecompression();
-#if defined(USE_FAR_MEMORY_CHUNKS)
-	void decompressNextFrames(DecompressionContext * dc, uint_farptr_t * compressedData, uint8_t * decompressedData, uint32_t framesCount);
+#if defined(FRAMES_LESS_THAN_BYTE_USED)
+	static const bool packedFrames = true;
 #else
-	void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, uint8_t * decompressedData, uint32_t framesCount);
+	static const bool packedFrames = false;
 #endif
-
-private:
-
 #if defined(USE_FAR_MEMORY_CHUNKS)
-	uint32_t readNextBits(uint_farptr_t * compressedData, uint8_t bitsCount);
-#else
-	uint32_t readNextBits(uint8_t * compressedData, uint8_t bitsCount);
+	static const uint16_t chunkSize = CHUNK_SIZE;
 #endif
 
+	// Delegates
+	static inline void frameDecompressed(Frame frame) { ::frameDecompressed(frame); }
+	static inline void frameRunDecompressed(Frame frame, FramesCounter count) { ::frameRunDecompressed(frame, count); }
 };
 
+typedef DeltaDecoder<DecompressionConfig> Decompression;
+
 #endif // end _DELTA_DECOMPRESSION_
 
 // END-OF-FILE
@@ -0,0 +1,359 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+Asset pack: the exported data of many images (or files) in a single blob with
+a directory, so the firmware finds any asset by its ID (index) in O(1)
+without a list of arrays and contexts of its own. The pack is written
+by the host tool (see /Tools/AssetPack) from the exported headers.
+
+All the fields are little-endian:
+
+Header (16 bytes)
+	0	"DCPK"
+	4	version (1)
+	5	number of contexts
+	6	number of assets (uint16_t)
+	8	directory offset (uint32_t)
+	12	far memory chunk size (uint16_t), 0 - the pack is not split into chunks
+	14	data alignment (log2)
+	15	flags: bit 0 - the pack has the tile tables
+
+Context (16 bytes, shared by the assets exported with the same parameters)
+	0	number of channels
+	1	bits per channels (4 bytes)
+	5	block size bits
+	6	bits per method declaration (4 bytes)
+	10	bits per frame
+	11	delta option (DECOMPRESSION_OPTION_...)
+	12	split to squares (0/1)
+	13	square side
+	14	image width (uint16_t)
+
+Tile table offsets (uint32_t per context, 0 - the context has no table) follow
+the contexts in the pack with the tile tables.
+
+Directory entry (16 bytes)
+	0	data offset (uint32_t)
+	4	data size (uint32_t)
+	8	number of frames (uint32_t)
+	12	number of seek points (uint16_t), the seek index precedes the data
+	14	context index
+	15	reserved
+
+Seek point (8 bytes): the frame (uint32_t) and the bit offset (uint32_t)
+
+Tile tables: the squares shared by the assets of the context (that are split into squares)
+are written once, the data of the asset doesn't contain them (see DecompressionTiles).
+In the pack with the tile tables the seek index of every asset is preceded
+by the number of its tile references (uint32_t) and the references before it:
+the square (24 bits) and the tile (8 bits) each, sorted by squares.
+The assets with the references have no seek index.
+
+The data of every asset starts at the aligned offset and is followed by at least
+4 zero bytes (the last word read of the decoder may fetch beyond the end of the data).
+When the pack is split into far memory chunks, the data of an asset either fits
+into the rest of the chunk or starts at the beginning of the next one,
+so the decoder reads it through the same array of chunks.
+
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include <stdint.h>
+#include "DeltaDecoder.h"
+
+#ifndef _DELTA_DECOMPRESSION_PACK_
+#define _DELTA_DECOMPRESSION_PACK_
+
+#define DECOMPRESSION_PACK_VERSION			1
+#define DECOMPRESSION_PACK_HEADER_SIZE		16
+#define DECOMPRESSION_PACK_CONTEXT_SIZE		16
+#define DECOMPRESSION_PACK_ENTRY_SIZE		16
+#define DECOMPRESSION_PACK_SEEK_POINT_SIZE	8
+#define DECOMPRESSION_PACK_MAX_CHANNELS		4
+#define DECOMPRESSION_PACK_FLAG_TILES		0x01
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Everything needed to decompress the asset (filled by DecompressionPack::getAsset())
+template <class Config>
+struct DecompressionPackAsset
+{
+	typename Config::Context dc;
+	typename Config::CompressedData data;
+	uint32_t dataSize;
+	uint32_t framesCount;
+	uint16_t seekPointsCount;
+	uint32_t seekIndexOffset; // Within the pack
+	DecompressionTiles<Config> tiles; // See DeltaDecoder::useTiles()
+
+#if defined(AVR)
+	// Far address of the data that doesn't start at a chunk (the data points here),
+	// so the asset must not be copied after getAsset()
+	uint_farptr_t dataChunk;
+#endif
+};
+
+// The square fields of the context exist only with the squares support
+template <class Config, bool squares = Config::useSquares>
+struct DecompressionPackSquares
+{
+	static bool set(typename Config::Context * dc, bool splitToSquares, uint16_t imageWidth, uint8_t squareSide)
+	{
+		dc->splitToSquares = splitToSquares;
+		dc->imageWidth = imageWidth;
+		dc->squareSide = squareSide;
+		dc->squaresPerWidth = squareSide ? (imageWidth / squareSide) : 0;
+		dc->squaresPerWidthSize = imageWidth * squareSide;
+		return (true);
+	}
+};
+
+template <class Config>
+struct DecompressionPackSquares<Config, false>
+{
+	static bool set(typename Config::Context * dc, bool splitToSquares, uint16_t imageWidth, uint8_t squareSide)
+	{
+		return (!splitToSquares);
+	}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// The pack is read where the decoder reads its data: the near (program) memory
+// on AVR, the array of far memory chunks (Config::chunkSize each) and any memory
+// on the other platforms (including a file mapped into memory on the host).
+template <class Config>
+class DecompressionPack {
+
+public:
+
+	typedef typename Config::Context Context;
+	typedef typename Config::CompressedData CompressedData;
+	typedef DecompressionPackAsset<Config> Asset;
+
+	// Check the header of the pack (false if it's not a pack or the layout doesn't fit the decoder)
+	bool open(CompressedData pack);
+
+	uint16_t getAssetsCount() { return (assetsCount); }
+
+	// Context, data and seek index of the asset by its ID (the directory entry address is computed)
+	bool getAsset(uint16_t id, Asset * asset);
+
+	// Jump to the frame of the asset by its seek index (false if the asset has no one)
+	bool seekToFrame(DeltaDecoder<Config> & decoder, const Asset * asset, uint32_t frame);
+
+private:
+
+	CompressedData packData;
+	uint32_t directoryOffset;
+	uint16_t assetsCount;
+	uint8_t contextsCount;
+	uint8_t flags;
+
+	uint8_t readByte(const uint8_t * pack, uint32_t offset);
+	bool checkLayout(const uint8_t * pack, uint16_t chunkSize);
+	void setData(const uint8_t * pack, Asset * asset, uint32_t offset);
+#if defined(AVR)
+	uint8_t readByte(uint_farptr_t * pack, uint32_t offset);
+	bool checkLayout(uint_farptr_t * pack, uint16_t chunkSize);
+	void setData(uint_farptr_t * pack, Asset * asset, uint32_t offset);
+#endif
+	uint16_t readWord(uint32_t offset);
+	uint32_t readDword(uint32_t offset);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Config>
+bool DecompressionPack<Config>::open(CompressedData pack)
+{
+	packData = pack;
+	assetsCount = 0;
+
+	if ((readByte(pack, 0) != 'D') || (readByte(pack, 1) != 'C') || (readByte(pack, 2) != 'P') || (readByte(pack, 3) != 'K')) return (false);
+	if (readByte(pack, 4) != DECOMPRESSION_PACK_VERSION) return (false);
+	if (!checkLayout(pack, readWord(12))) return (false);
+
+	contextsCount = readByte(pack, 5);
+	directoryOffset = readDword(8);
+	assetsCount = readWord(6);
+	flags = readByte(pack, 15);
+	return (true);
+}
+
+
+template <class Config>
+bool DecompressionPack<Config>::getAsset(uint16_t id, Asset * asset)
+{
+	if (id >= assetsCount) return (false);
+
+	uint32_t entry = directoryOffset + (uint32_t)id * DECOMPRESSION_PACK_ENTRY_SIZE;
+	uint8_t contextIndex = readByte(packData, entry + 14);
+	if (contextIndex >= contextsCount) return (false);
+
+	// Context of the asset (the data the decoder doesn't support is unreadable)
+	uint32_t context = DECOMPRESSION_PACK_HEADER_SIZE + (uint32_t)contextIndex * DECOMPRESSION_PACK_CONTEXT_SIZE;
+	uint8_t numberOfChannels = readByte(packData, context);
+	if ((numberOfChannels == 0) || (numberOfChannels > Config::maxNumberOfChannels)) return (false);
+
+	// The decoder of the "first" option reads the data of the "only" one of the same window too
+	uint8_t deltaOption = readByte(packData, context + 11);
+	if ((deltaOption != Config::deltaOption) && (deltaOption + 2 != Config::deltaOption)) return (false);
+
+	Context * dc = &asset->dc;
+	dc->numberOfChannels = numberOfChannels;
+	for (uint8_t i = 0; i < numberOfChannels; i++)
+	{
+		dc->bitsPerChannels[i] = readByte(packData, context + 1 + i);
+		dc->bitsPerMethodDeclaration[i] = readByte(packData, context + 6 + i);
+	}
+	dc->blockSizeBits = readByte(packData, context + 5);
+	dc->bitsPerFrame = readByte(packData, context + 10);
+	if (!DecompressionPackSquares<Config>::set(dc, readByte(packData, context + 12), readWord(context + 14), readByte(packData, context + 13))) return (false);
+
+	uint32_t dataOffset = readDword(entry);
+	asset->dataSize = readDword(entry + 4);
+	asset->framesCount = readDword(entry + 8);
+	asset->seekPointsCount = readWord(entry + 12);
+	asset->seekIndexOffset = dataOffset - (uint32_t)asset->seekPointsCount * DECOMPRESSION_PACK_SEEK_POINT_SIZE;
+	setData(packData, asset, dataOffset);
+
+	// Tile table of the context and the references of the asset
+	asset->tiles.data = packData;
+	asset->tiles.referencesCount = 0;
+	if (flags & DECOMPRESSION_PACK_FLAG_TILES)
+	{
+		uint32_t tableOffsets = DECOMPRESSION_PACK_HEADER_SIZE + (uint32_t)contextsCount * DECOMPRESSION_PACK_CONTEXT_SIZE;
+		asset->tiles.tableOffset = readDword(tableOffsets + (uint32_t)contextIndex * 4);
+		asset->tiles.referencesCount = readDword(asset->seekIndexOffset - 4);
+		asset->tiles.referencesOffset = asset->seekIndexOffset - 4 - asset->tiles.referencesCount * DECOMPRESSION_TILE_REFERENCE_SIZE;
+	}
+	return (true);
+}
+
+
+// Binary search in the seek index of the pack (see DeltaDecoder::seekToFrame())
+template <class Config>
+bool DecompressionPack<Config>::seekToFrame(DeltaDecoder<Config> & decoder, const Asset * asset, uint32_t frame)
+{
+	if (!asset->seekPointsCount) return (false);
+
+	uint16_t low = 0;
+	uint16_t high = asset->seekPointsCount - 1;
+	while (low < high)
+	{
+		uint16_t middle = (low + high + 1) >> 1;
+		if (readDword(asset->seekIndexOffset + (uint32_t)middle * DECOMPRESSION_PACK_SEEK_POINT_SIZE) <= frame) low = middle;
+		else high = middle - 1;
+	}
+
+	uint32_t point = asset->seekIndexOffset + (uint32_t)low * DECOMPRESSION_PACK_SEEK_POINT_SIZE;
+	uint32_t pointFrame = readDword(point);
+	if (pointFrame > frame) return (false);
+
+	decoder.seekToPoint(&asset->dc, asset->data, pointFrame, readDword(point + 4), frame);
+	return (true);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Read the pack (two options for near and far memory)
+template <class Config>
+inline uint8_t DecompressionPack<Config>::readByte(const uint8_t * pack, uint32_t offset)
+{
+	return (DeltaDecoderWord<uint16_t>::read(pack + offset));
+}
+
+// The near pack may be laid out for any chunk size
+template <class Config>
+inline bool DecompressionPack<Config>::checkLayout(const uint8_t * pack, uint16_t chunkSize)
+{
+	return (true);
+}
+
+template <class Config>
+inline void DecompressionPack<Config>::setData(const uint8_t * pack, Asset * asset, uint32_t offset)
+{
+	asset->data = pack + offset;
+}
+
+#if defined(AVR)
+
+template <class Config>
+inline uint8_t DecompressionPack<Config>::readByte(uint_farptr_t * pack, uint32_t offset)
+{
+	return (DeltaDecoderWord<uint16_t>::readFar(pack[offset / Config::chunkSize] + offset % Config::chunkSize));
+}
+
+// The chunks of the pack must be the ones of the decoder
+template <class Config>
+inline bool DecompressionPack<Config>::checkLayout(uint_farptr_t * pack, uint16_t chunkSize)
+{
+	return (chunkSize == Config::chunkSize);
+}
+
+// The data at the beginning of the chunk is read through the chunks of the pack,
+// the rest fits into its chunk and needs only its own address
+template <class Config>
+inline void DecompressionPack<Config>::setData(uint_farptr_t * pack, Asset * asset, uint32_t offset)
+{
+	if (offset % Config::chunkSize)
+	{
+		asset->dataChunk = pack[offset / Config::chunkSize] + offset % Config::chunkSize;
+		asset->data = &asset->dataChunk;
+	}
+	else asset->data = &pack[offset / Config::chunkSize];
+}
+
+#endif
+
+template <class Config>
+inline uint16_t DecompressionPack<Config>::readWord(uint32_t offset)
+{
+	return (readByte(packData, offset) | ((uint16_t)readByte(packData, offset + 1) << 8));
+}
+
+template <class Config>
+inline uint32_t DecompressionPack<Config>::readDword(uint32_t offset)
+{
+	return (readWord(offset) | ((uint32_t)readWord(offset + 2) << 16));
+}
+
+
+#endif // end _DELTA_DECOMPRESSION_PACK_
+
+// END-OF-FILE
@@ -88,6 +88,14 @@ Examples:
 	/AVR/Arduino_boards/Nano_ST7789_Tiny (Arduino Nano + ST7789 240x240 display),
 	/AVR/ATtiny85 (ATtiny85 chip + SPI output).
 
+All the modifications are configurations of the same decompression template (DeltaDecoder.h),
+so copy DeltaDecoder.h and DecompressionSinks.h from /Decompression along with them.
+
+The decoder reads the compressed data by words of up to 4 bytes, so the last read may go
+up to 3 bytes beyond the end of the data. The compressor appends
+DECOMPRESSION_DATA_PADDING (3) zero bytes to every exported data array,
+so if you prepare the data in some other way, then append them too.
+
 * Relevant only for the AVR platform.
 ** To do this, a pointer to an array of far pointers should be passed 
 to the decompression procedure instead of a direct pointer to a data array:
@@ -120,6 +128,7 @@ Sprint 3 - https://www.patreon.com/posts/delta-encoding-3-108236064
 
 // Includes
 #include <stdint.h>
+#include "DeltaDecoder.h"
 
 #if defined(AVR)
 #include <avr/pgmspace.h>
@@ -157,15 +166,34 @@ Sprint 3 - https://www.patreon.com/posts/delta-encoding-3-108236064
 // Hide the string below if you don't want to use far memory and chunks.
 //#define USE_FAR_MEMORY_CHUNKS
 // For example, we can divide the data by 16K chunks.
+// The size must be a multiple of 2, because data is read by 2-byte words.
 #define CHUNK_SIZE	16384
 
 #endif
 
+// Delta option for the decompression template
+#if defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_FIXED_WINDOW_ONLY
+#elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_ONLY)
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_ONLY
+#elif defined(DECOMPRESSION_FIXED_WINDOW_FIRST)
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST
+#else
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_FIRST
+#endif
+
 
 ////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////
 
+// Pointer to the compressed data (or to the array of far chunks)
+#if defined(USE_FAR_MEMORY_CHUNKS)
+typedef uint_farptr_t * CompressedDataPointer;
+#else
+typedef const uint8_t * CompressedDataPointer;
+#endif
+
 struct DecompressionContext
 {
 	uint8_t numberOfChannels;
@@ -185,54 +213,49 @@ struct DecompressionContext
 
 // Delegate methods declaration
 void frameDecompressed(uint16_t frame);
+void frameRunDecompressed(uint16_t frame, uint16_t count);
 uint16_t colorizePixel(uint16_t frame);
 
 
 ////////////////////////////////////////////////////////////////////////////////////////
 
-class Decompression {
-
-public:
-
-	uint32_t inputBitsBuffer;
-#if defined(USE_FAR_MEMORY_CHUNKS)
-	uint8_t inputChunkIndex; // Additional variable for ROM chunk index
-#endif
+// Configuration of the decompression template (see DeltaDecoder.h)
+struct DecompressionConfig
+{
+	typedef DecompressionContext Context;
+	typedef CompressedDataPointer CompressedData;
+	typedef uint32_t BitsBuffer;
+	typedef uint16_t ReadBits;
+	typedef uint8_t ChannelValue;
+	typedef uint16_t Frame;
+	typedef uint16_t FramesCounter;
 #if defined(AVR)
-	uint16_t inputByteIndex;
+	typedef uint16_t ByteIndex;
 #else
-	uint32_t inputByteIndex;
+	typedef uint32_t ByteIndex;
 #endif
-	uint8_t inputBitsCount;
-
-	uint16_t currentBlockFramesCount;
-	uint8_t currentBlockMethods[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
-	uint8_t currentBaseValues[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
+	typedef uint16_t Position;
 
-	uint16_t outputBitsBuffer;
-	uint8_t outputBitsCount;
-
-	// In the case of decompression images divided into squares, 
-	// set this variable to the width of your decompression buffer in pixels.
-	uint16_t bufferWidth;
-
-	void resetDecompression();
-#if defined(USE_FAR_MEMORY_CHUNKS)
-	void decompressNextFrames(DecompressionContext * dc, uint_farptr_t * compressedData, uint16_t * decompressedData, uint16_t framesCount, bool colorize);
+	static const uint8_t maxNumberOfChannels = DECOMPRESSION_MAX_NUMBER_OF_CHANNELS;
+	static const uint8_t deltaOption = DECOMPRESSION_DELTA_OPTION;
+#if defined(DECOMPRESSION_USE_SQUARES)
+	static const bool useSquares = true;
 #else
-	void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, uint16_t * decompressedData, uint16_t framesCount, bool colorize);
+	static const bool useSquares = false;
 #endif
-
-private:
-
+	static const bool packedFrames = false;
 #if defined(USE_FAR_MEMORY_CHUNKS)
-	uint16_t readNextBits(uint_farptr_t * compressedData, uint8_t bitsCount);
-#else
-	uint16_t readNextBits(uint8_t * compressedData, uint8_t bitsCount);
+	static const uint16_t chunkSize = CHUNK_SIZE;
 #endif
 
+	// Delegates
+	static inline void frameDecompressed(Frame frame) { ::frameDecompressed(frame); }
+	static inline void frameRunDecompressed(Frame frame, FramesCounter count) { ::frameRunDecompressed(frame, count); }
+	static inline uint16_t colorizePixel(Frame frame) { return (::colorizePixel(frame)); }
 };
 
+typedef DeltaDecoder<DecompressionConfig> Decompression;
+
 #endif // end _DELTA_DECOMPRESSION_
 
 // END-OF-FILE
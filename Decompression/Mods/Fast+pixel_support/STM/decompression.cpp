@@ -0,0 +1,146 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// The decompression itself is the C++ template shared with the other versions
+// (DeltaDecoder.h, copy it along with DecompressionSinks.h from /Decompression).
+// This file configures it and keeps the C interface of decompression.h,
+// so the rest of the project can stay in C.
+
+// Includes
+#include "decompression.h"
+#include "DeltaDecoder.h"
+
+// Delta option for the decompression template
+#if defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_FIXED_WINDOW_ONLY
+#elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_ONLY)
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_ONLY
+#elif defined(DECOMPRESSION_FIXED_WINDOW_FIRST)
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST
+#else
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_FIRST
+#endif
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Configuration of the decompression template (see DeltaDecoder.h)
+struct DecompressionConfig
+{
+	typedef DecompressionContext Context;
+	typedef const uint8_t * CompressedData;
+	typedef uint32_t BitsBuffer;
+	typedef uint16_t ReadBits;
+	typedef uint8_t ChannelValue;
+	typedef uint16_t Frame;
+	typedef uint16_t FramesCounter;
+	typedef uint32_t ByteIndex;
+	typedef uint16_t Position;
+
+	static const uint8_t maxNumberOfChannels = DECOMPRESSION_MAX_NUMBER_OF_CHANNELS;
+	static const uint8_t deltaOption = DECOMPRESSION_DELTA_OPTION;
+#if defined(DECOMPRESSION_USE_SQUARES)
+	static const bool useSquares = true;
+#else
+	static const bool useSquares = false;
+#endif
+	static const bool packedFrames = false;
+
+	// Delegates
+	static inline void frameDecompressed(Frame frame) { ::frameDecompressed(frame); }
+	static inline void frameRunDecompressed(Frame frame, FramesCounter count) { ::frameRunDecompressed(frame, count); }
+	static inline uint16_t colorizePixel(Frame frame) { return (::colorizePixel(frame)); }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Local variables
+static DeltaDecoder<DecompressionConfig> decompression;
+
+uint16_t decompressionBufferWidth;
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Weak delegate method
+void __attribute__((weak)) frameDecompressed(uint16_t frame) {
+	// Do not delete this function
+}
+
+// Weak delegate method for a run of identical frames (constant blocks).
+// Override it to output the whole run at once.
+void __attribute__((weak)) frameRunDecompressed(uint16_t frame, uint16_t count) {
+	while (count--) frameDecompressed(frame);
+}
+
+// Another one delegate method to colorize grayscale pixels
+uint16_t __attribute__((weak)) colorizePixel(uint16_t frame) {
+	// Do not delete this function
+	return (frame);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Clear runtime variables
+void resetDecompression()
+{
+	decompression.resetDecompression();
+}
+
+// Batch decompression (specified number of frames)
+void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, uint16_t * decompressedData, uint16_t framesCount, bool colorize)
+{
+	decompression.bufferWidth = decompressionBufferWidth;
+	decompression.decompressNextFrames(dc, compressedData, decompressedData, framesCount, colorize);
+}
+
+// Batch decompression (specified number of frames) colorized by the palette lookup table
+// (frames are the color indices, there is no colorizePixel() call per pixel)
+void decompressNextFramesWithPalette(DecompressionContext * dc, uint8_t * compressedData, uint16_t * decompressedData, uint16_t framesCount, const uint16_t * palette)
+{
+	decompression.bufferWidth = decompressionBufferWidth;
+	DecompressionPaletteSink<> sink(decompressedData, palette);
+	decompression.decompressNextFrames(dc, compressedData, sink, framesCount);
+}
+
+// Advance by the specified number of frames without decompressing them
+// (only the block headers are read)
+void skipNextFrames(DecompressionContext * dc, uint8_t * compressedData, uint32_t framesCount)
+{
+	decompression.skipFrames(dc, compressedData, framesCount);
+}
+
+// Decompression of the rectangle of the image (width x height pixels row by row)
+// from the beginning of the data, the frames outside it are skipped
+void decompressRegion(DecompressionContext * dc, uint8_t * compressedData, uint16_t * decompressedData, uint16_t imageWidth, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+	decompression.decompressRegion(dc, compressedData, decompressedData, imageWidth, x, y, width, height);
+}
+
+// END-OF-FILE
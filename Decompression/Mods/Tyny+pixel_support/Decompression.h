@@ -88,6 +88,14 @@ Examples:
 	/AVR/Arduino_boards/Nano_ST7789_Tiny (Arduino Nano + ST7789 240x240 display),
 	/AVR/ATtiny85 (ATtiny85 chip + SPI output).
 
+All the modifications are configurations of the same decompression template (DeltaDecoder.h),
+so copy DeltaDecoder.h and DecompressionSinks.h from /Decompression along with them.
+
+The decoder reads the compressed data by words of up to 4 bytes, so the last read may go
+up to 3 bytes beyond the end of the data. The compressor appends
+DECOMPRESSION_DATA_PADDING (3) zero bytes to every exported data array,
+so if you prepare the data in some other way, then append them too.
+
 * Relevant only for the AVR platform.
 ** To do this, a pointer to an array of far pointers should be passed 
 to the decompression procedure instead of a direct pointer to a data array:
@@ -120,6 +128,11 @@ Sprint 3 - https://www.patreon.com/posts/delta-encoding-3-108236064
 
 // Includes
 #include <stdint.h>
+#include "DeltaDecoder.h"
+
+#if defined(AVR)
+#include <avr/pgmspace.h>
+#endif
 
 #ifndef _DELTA_DECOMPRESSION_
 #define _DELTA_DECOMPRESSION_
@@ -146,6 +159,17 @@ Sprint 3 - https://www.patreon.com/posts/delta-encoding-3-108236064
 // Uncomment if you have data splitted into squares among those you will decompress
 #define DECOMPRESSION_USE_SQUARES
 
+// Delta option for the decompression template
+#if defined(DECOMPRESSION_FIXED_WINDOW_ONLY)
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_FIXED_WINDOW_ONLY
+#elif defined(DECOMPRESSION_ADAPTIVE_FLOATING_WINDOW_ONLY)
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_ONLY
+#elif defined(DECOMPRESSION_FIXED_WINDOW_FIRST)
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST
+#else
+#define DECOMPRESSION_DELTA_OPTION	DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_FIRST
+#endif
+
 
 ////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////
@@ -170,39 +194,42 @@ struct DecompressionContext
 
 // Delegate methods declaration
 void frameDecompressed(uint8_t frame);
+void frameRunDecompressed(uint8_t frame, uint16_t count);
 uint16_t colorizePixel(uint8_t frame);
 
 
 ////////////////////////////////////////////////////////////////////////////////////////
 
-class Decompression {
-
-public:
-
-	uint16_t inputBitsBuffer;
-	uint16_t inputByteIndex;
-	uint8_t inputBitsCount;
-
-	uint16_t currentBlockFramesCount;
-	uint8_t currentBlockMethods[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
-	uint8_t currentBaseValues[DECOMPRESSION_MAX_NUMBER_OF_CHANNELS];
-
-	uint8_t outputBitsBuffer;
-	uint8_t outputBitsCount;
-
-	// In the case of decompression images divided into squares, 
-	// set this variable to the width of your decompression buffer in pixels.
-	uint8_t bufferWidth;
-
-	void resetDecompression();
-	void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, uint16_t * decompressedData, uint16_t framesCount, bool colorize);
-
-private:
-
-	uint16_t readNextBits(uint8_t * compressedData, uint8_t bitsCount);
+// Configuration of the decompression template (see DeltaDecoder.h)
+struct DecompressionConfig
+{
+	typedef DecompressionContext Context;
+	typedef const uint8_t * CompressedData;
+	typedef uint16_t BitsBuffer;
+	typedef uint16_t ReadBits;
+	typedef uint8_t ChannelValue;
+	typedef uint8_t Frame;
+	typedef uint16_t FramesCounter;
+	typedef uint16_t ByteIndex;
+	typedef uint16_t Position;
+
+	static const uint8_t maxNumberOfChannels = DECOMPRESSION_MAX_NUMBER_OF_CHANNELS;
+	static const uint8_t deltaOption = DECOMPRESSION_DELTA_OPTION;
+#if defined(DECOMPRESSION_USE_SQUARES)
+	static const bool useSquares = true;
+#else
+	static const bool useSquares = false;
+#endif
+	static const bool packedFrames = false;
 
+	// Delegates
+	static inline void frameDecompressed(Frame frame) { ::frameDecompressed(frame); }
+	static inline void frameRunDecompressed(Frame frame, FramesCounter count) { ::frameRunDecompressed(frame, count); }
+	static inline uint16_t colorizePixel(Frame frame) { return (::colorizePixel(frame)); }
 };
 
+typedef DeltaDecoder<DecompressionConfig> Decompression;
+
 #endif // end _DELTA_DECOMPRESSION_
 
 // END-OF-FILE
@@ -99,6 +99,6 @@ static const uint8_t asciiData[] PROGMEM =
 	0xCB, 0x97, 0x9C, 0x9D, 0x7F, 0xC3, 0xF9, 0x80, 0xB9, 0xE0, 0x40, 0x13, 0x0D, 0x29, 0x02, 0x01, 0x29, 0x70, 0xA0, 0x50, 0x2E, 0x3C, 0x9D, 0x0F, 0xAD, 0xCA, 0xDD, 0xBB, 0x76, 0xAF, 0xC4, 0x04, 0x03, 0x12, 0x58, 0x80, 0x40, 0x26, 0x3B, 0x92, 0x58, 0x19, 0x62, 0x06, 0x04, 0x03, 0x20, 0x04, 0xC1, 0x02, 0x43, 0x82, 0xC0, 0x40, 0x91, 0x14, 0x48, 0x01, 0x50, 0x18, 0x16, 0x06, 0x0F, 0x02, 0x02, 0xB4, 0xE9, 0x5C, 0x00, 0x00, 0x02, 0x10, 0x84, 0x00, 0x59, 0x3A, 0xF4, 0xE0, 0x56, 0x71, 0x3B, 0xBE, 0x15, 0x2E, 0x12, 0xC0, 0x80, 0x26, 0x1A, 0x4E, 0x07, 0x4B, 0xC2, 0xE0, 0x00, 0xCC, 0xCD, 0xDC, 0x00, 0x03, 
 	0x49, 0xD1, 0xF6, 0x79, 0x20, 0x70, 0xE5, 0xCB, 0x54, 0x0E, 0xD0, 0x00, 0x00, 0x00, 0x1A, 0x54, 0x45, 0x12, 0x15, 0x50, 0x06, 0x75, 0x88, 0x18, 0x20, 0x20, 0x18, 0x93, 0x60, 0x4C, 0x10, 0x24, 0x08, 0x2C, 0x00, 0x1E, 0x08, 0x0B, 0x01, 0x72, 0x4B, 0x04, 0x07, 0x81, 0x01, 0x58, 0x81, 0xE0, 0x60, 0x56, 0x00, 0x78, 0x10, 0x15, 0x84, 0x0E, 0xC6, 0x05, 0x61, 0x75, 0x8C, 0x04, 0x02, 0xB0, 0x83, 0xC0, 0x00, 0xEC, 0xC2, 0x77, 0xE9, 0x40, 0xB8, 0x40, 0x40, 0x20, 0x2E, 0x5B, 0x06, 0x95, 0x5C, 0x10, 0x60, 0x84, 0x10, 0x41, 0x84, 0x02, 0x02, 0xB1, 0x03, 0xC0, 0x84, 0xED, 0x00, 0x17, 0x1A, 0x4E, 0x8F, 0x88, 
 	0x0A, 0xC9, 0x07, 0x4F, 0x05, 0x6F, 0x0B, 0x04, 0x02, 0x41, 0x42, 0xC3, 0xC1, 0x21, 0xC0, 0x98, 0xFC, 0x48, 0x00, 0x1A, 0x69, 0xA6, 0x9A, 0x01, 0x40, 0x26, 0x8F, 0x12, 0x00, 0x06, 0x9A, 0x68, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0xA0, 0x01, 0x01, 0xA1, 0xC1, 0xE0, 0x60, 0xB1, 0x2F, 0x2B, 0x9A, 0x02, 0x68, 0x00, 0x00, 0x16, 0xCD, 0x9B, 0x34, 0x04, 0xD9, 0xAB, 0x56, 0xCD, 0x5A, 0xB6, 0x68, 0x80, 0xEC, 0x60, 0x56, 0xD9, 0x3A, 0xCE, 0x00, 0xAC, 0x1A, 0x57, 0x68, 0x41, 0x81, 0x00, 0xAC, 0x40, 0xF0, 0x30, 0x58, 0x1B, 0xBC, 0x02, 0x74, 0xB8, 0xD2, 0x74, 0x7E, 0x2E, 0x56, 0xAD, 0xDB, 0xA5, 0x7E, 0x20, 
-	0x20, 0x80, 0x31, 0x22, 0x64, 0x89, 0x2C, 0x40, 0xC0, 0x81, 0x74, 0x48, 0x15, 0x55, 0x40, 0x37, 0x58, 0x18, 0x91, 0x20, 0x81, 0x61, 0x74, 0x48, 0x50, 0x55, 0x00, 0x20, 0x58, 0x6D, 0x12, 0x05, 0x55, 0x50, 0x01, 0x81, 0x60, 0x40, 0xF0, 0x77, 0x58, 0x18, 0x92, 0xC4, 0x08, 0x18, 0x20, 0x04, 0x0A, 0xCA, 0x0B, 0x03, 0x07, 0x8E, 0x78, 0x54, 0xE3, 0x46, 0xA7, 0x6E, 0x62, 0x87, 0x76, 0xED, 0xDB, 0x90, 0xB1, 0x62, 0xC5, 0x0A, 0x14, 0x28, 0x77, 0x6E, 0x42, 0xC1, 0x83, 0x04, 0x28, 0x41, 0x80};
+	0x20, 0x80, 0x31, 0x22, 0x64, 0x89, 0x2C, 0x40, 0xC0, 0x81, 0x74, 0x48, 0x15, 0x55, 0x40, 0x37, 0x58, 0x18, 0x91, 0x20, 0x81, 0x61, 0x74, 0x48, 0x50, 0x55, 0x00, 0x20, 0x58, 0x6D, 0x12, 0x05, 0x55, 0x50, 0x01, 0x81, 0x60, 0x40, 0xF0, 0x77, 0x58, 0x18, 0x92, 0xC4, 0x08, 0x18, 0x20, 0x04, 0x0A, 0xCA, 0x0B, 0x03, 0x07, 0x8E, 0x78, 0x54, 0xE3, 0x46, 0xA7, 0x6E, 0x62, 0x87, 0x76, 0xED, 0xDB, 0x90, 0xB1, 0x62, 0xC5, 0x0A, 0x14, 0x28, 0x77, 0x6E, 0x42, 0xC1, 0x83, 0x04, 0x28, 0x41, 0x80, 0x00, 0x00, 0x00};
 
 // END-OF-FILE
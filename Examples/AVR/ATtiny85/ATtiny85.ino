@@ -37,6 +37,17 @@ SOFTWARE.
 
 static Decompression decomp;
 
+// Output sink: frames go straight to the SPI bus.
+// The sink is inlined into the decompression loop, so there is no call per frame
+// (the image is not divided into squares, so the position never changes).
+struct SPIOutput {
+  void writeFrame(uint8_t frame) { SPI.transfer(frame); }
+  void writeRun(uint8_t frame, uint16_t count) { while (count--) SPI.transfer(frame); }
+  void moveTo(uint16_t position) {}
+};
+
+static SPIOutput output;
+
 void setup() {
   // put your setup code here, to run once:
   SPI.begin();
@@ -47,14 +58,9 @@ void loop() {
   // Decompress all data at once
   decomp.resetDecompression();
   SPI.beginTransaction(SPISettings());
-  decomp.decompressNextFrames(&asciiDC, asciiData, NULL, ASCII_NUMBER_OF_FRAMES, false);
+  decomp.decompressNextFrames(&asciiDC, asciiData, output, ASCII_NUMBER_OF_FRAMES);
   SPI.endTransaction();
   delay(10000);
 }
 
-// Frame decompressed delegate (can be used if the image is not divided into squares and the buffer is not used)
-void frameDecompressed(uint8_t frame) {
-  SPI.transfer(frame);
-}
-
 // END-OF-FILE
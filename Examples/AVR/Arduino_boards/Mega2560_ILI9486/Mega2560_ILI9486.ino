@@ -98,11 +98,12 @@ void loop() {
   // Draw single slide
   for (uint8_t i = 0; i < BUFFERS_PER_SLIDE; i++)
   {
-    // Decompress one buffer
-    decomp.decompressNextFrames(&photoDC, currentSlide ? slide1DataChunks : slide2DataChunks, (uint8_t *)decompressedData, FRAMES_PER_BUFFER);
+    // Decompress one buffer (the sink stores native 16-bit pixels, so they don't need swapping)
+    DecompressionRGB565Sink<> sink(decompressedData);
+    decomp.decompressNextFrames(&photoDC, currentSlide ? slide1DataChunks : slide2DataChunks, sink, FRAMES_PER_BUFFER);
     // And display it
     for (uint16_t pixel = 0; pixel < FRAMES_PER_BUFFER; pixel++) {
-      myGLCD.setPixel(__builtin_bswap16(decompressedData[pixel]));
+      myGLCD.setPixel(decompressedData[pixel]);
     }
   }
   sbi(myGLCD.P_CS, myGLCD.B_CS);
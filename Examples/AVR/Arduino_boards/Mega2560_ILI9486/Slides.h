@@ -1012,7 +1012,7 @@ static const uint8_t slide1Data6[] PROGMEM_FAR = {
 	0x5B, 0xB2, 0x9A, 0x75, 0xBB, 0x77, 0xAD, 0x4A, 0xB4, 0xAA, 0xD4, 0xAB, 0x49, 0xA7, 0x4A, 0xB2, 0xDA, 0x5C, 0xAB, 0xFB, 0xA5, 0x5A, 0xBC, 0x9A, 0x55, 0xAB, 0xA5, 0xED, 0x4A, 0xB2, 0x92, 0x23, 0x68, 0x75, 0xD6, 0x72, 0xBF, 0xED, 0x7E, 0x3A, 0xF6, 0x8C, 0xAD, 0x78, 0x2B, 0xF0, 0xD0, 0xB8, 0xC0, 0x2C, 0x3F, 0xDF, 0xFF, 0xC4, 0x83, 0x71, 0x84, 0x1A, 0x00, 0x28, 0x08, 0x78, 0x6A, 0x02, 0xA3, 0xE7, 0x80, 0x14, 0x0B, 0x8C, 0x02, 0xC0, 0xC0, 0xDD, 0x7F, 0x55, 0x50, 0x58, 0xD8, 0x9E, 0x16, 0x17, 0xE1, 0x17, 0xA1, 0x16, 0x11, 0x07, 0x0B, 0x03, 0xE0, 0xC0, 0xA1, 0x61, 0x78, 0x56, 0x68, 0x06, 0x86, 0xA2, 
 	0xE8, 0x2F, 0xAE, 0xAF, 0xEF, 0xE0, 0x08, 0x08, 0x02, 0x83, 0x42, 0x68, 0x55, 0xBF, 0xFF, 0xFB, 0x45, 0xFB, 0x85, 0xF8, 0x45, 0xB8, 0x44, 0x03, 0x46, 0x64, 0xB8, 0xA7, 0xB0, 0xBF, 0x10, 0xBF, 0x10, 0xBD, 0x10, 0x83, 0x4C, 0x95, 0x14, 0x75, 0xDC, 0x8D, 0xAA, 0x8D, 0xAA, 0xAD, 0xAA, 0xA1, 0x41, 0x12, 0x48, 0x4F, 0xFC, 0x9F, 0xC5, 0xE4, 0x08, 0x30, 0x24, 0x84, 0xE5, 0xF9, 0x44, 0x68, 0x20, 0x29, 0x09, 0xBF, 0xFF, 0xFD, 0x7D, 0x3F, 0x7D, 0x15, 0x4C, 0xEF, 0x84, 0x84, 0xCE, 0xD1, 0x94, 0xA4, 0x99, 0x4E, 0x32, 0x92, 0xF5, 0x19, 0x2F, 0x51, 0x54, 0xB4, 0xA8, 0xCE, 0x52, 0x8C, 0xE3, 0x29, 0x4E, 0x2A, 
 	0x96, 0xFD, 0xC6, 0x4C, 0x15, 0x14, 0x39, 0x4A, 0xE5, 0x46, 0x00, 0x80, 0x85, 0xA5, 0x2E, 0xB8, 0x20, 0x09, 0x10, 0xE3, 0x1E, 0xEF, 0xA0, 0x00, 0xA1, 0x96, 0x3E, 0x10, 0x8D, 0x4A, 0x91, 0xA9, 0x5E, 0xEE, 0xEE, 0xEE, 0xFE, 0xED, 0xFE, 0xED, 0xED, 0x55, 0x6D, 0x51, 0x5D, 0xD1, 0x5D, 0xD1, 0x51, 0x90, 0xA8, 0xD2, 0x15, 0x11, 0x10, 0x00, 0x07, 0x05, 0x42, 0x90, 0xA8, 0x00, 0xA8, 0x52, 0x14, 0xC6, 0x15, 0x1A, 0x02, 0xBF, 0xBF, 0x87, 0xFF, 0x3F, 0xF8, 0x88, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFE, 0x48, 0x2A, 0x34, 0x85, 0x6F, 0xFF, 0xF8, 0xF1, 0xA8, 0x54, 0x35, 0xF0, 0x70, 0x50, 0x5F, 0x18, 0x35, 0x1A, 
-	0x82, 0xDF, 0x7E, 0x2E, 0x29, 0x00, 0xB0, 0xD6, 0x16, 0x00, 0x88, 0x80};
+	0x82, 0xDF, 0x7E, 0x2E, 0x29, 0x00, 0xB0, 0xD6, 0x16, 0x00, 0x88, 0x80, 0x00, 0x00, 0x00};
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Slide 2
@@ -2054,6 +2054,6 @@ static const uint8_t slide2Data7[] PROGMEM_FAR = {
 	0x5B, 0xBD, 0x7E, 0xC1, 0x3B, 0xFB, 0xA4, 0x27, 0x97, 0xBA, 0xC0, 0x7D, 0xF6, 0xAD, 0x4F, 0xD5, 0x7E, 0xE1, 0x3B, 0x57, 0xAC, 0x97, 0xB5, 0x7E, 0xC1, 0x3B, 0xD7, 0xED, 0x5E, 0x90, 0xC1, 0xBC, 0x4A, 0x30, 0x1C, 0x19, 0x1C, 0x19, 0x7C, 0x11, 0xC7, 0x06, 0x0A, 0x61, 0x88, 0x0D, 0xD0, 0xED, 0x36, 0xD4, 0xD1, 0x0E, 0x06, 0x81, 0x90, 0x0D, 0xB6, 0x5B, 0x60, 0xB6, 0xDF, 0x6D, 0xB6, 0x49, 0x2D, 0x90, 0xD9, 0x00, 0x80, 0xDC, 0xA4, 0x27, 0xFD, 0x46, 0xFF, 0xCC, 0x1F, 0xAC, 0xC1, 0xFF, 0xCC, 0x10, 0x84, 0x60, 0xDA, 0x62, 0x26, 0xA3, 0x7F, 0x38, 0xA4, 0xBF, 0x38, 0xA3, 0x5E, 0x38, 0xD1, 0xC3, 0x42, 0x74, 
 	0x5B, 0xBF, 0x94, 0x5F, 0x94, 0x1F, 0x84, 0x19, 0x43, 0x06, 0x70, 0xF0, 0xB3, 0xAD, 0xCA, 0x4E, 0xAC, 0x4E, 0x24, 0x12, 0xF3, 0x26, 0x45, 0x73, 0xEF, 0xAD, 0x28, 0xB9, 0x43, 0x82, 0xC6, 0x22, 0xC8, 0x2F, 0xCF, 0xCF, 0x80, 0x48, 0xC0, 0x96, 0x24, 0x68, 0xC1, 0xFE, 0x8C, 0x2D, 0x18, 0xC1, 0x49, 0xC4, 0xA8, 0xA5, 0x5F, 0xAC, 0x90, 0xA1, 0xA2, 0xE1, 0x50, 0x51, 0xD9, 0xEC, 0x86, 0x48, 0x2C, 0x8E, 0x76, 0x9A, 0x90, 0x81, 0x8A, 0x89, 0x3A, 0xDD, 0x81, 0x0B, 0x4C, 0xDB, 0x81, 0x1B, 0x5F, 0x59, 0x03, 0x2A, 0x35, 0x9A, 0x0C, 0x83, 0x1F, 0xFE, 0x00, 0x1A, 0x0D, 0x03, 0x11, 0x03, 0x01, 0x90, 0x61, 0xC0, 
 	0x60, 0xB0, 0x2B, 0x15, 0xD5, 0x75, 0xD5, 0x00, 0x00, 0x00, 0x7F, 0x83, 0x01, 0x80, 0x59, 0x50, 0x60, 0x30, 0x0B, 0x22, 0x0C, 0x16, 0x05, 0x7E, 0x00, 0x61, 0x95, 0x7D, 0x14, 0x18, 0x0C, 0x83, 0x00, 0x03, 0x01, 0x90, 0x5C, 0x60, 0x60, 0x32, 0x0C, 0x2C, 0x2C, 0x16, 0x41, 0x98, 0x78, 0x18, 0x07, 0xFF, 0xFE, 0x26, 0x06, 0x83, 0x40, 0xC1, 0x60, 0xD1, 0x68, 0x59, 0xD5, 0xFE, 0x5C, 0x90, 0x1A, 0x0D, 0x83, 0x4D, 0x8B, 0x45, 0xB0, 0x6A, 0x8A, 0x80, 0x02, 0x7F, 0xBF, 0xAF, 0xAA, 0x10, 0x70, 0x38, 0x0D, 0x22, 0x0E, 0x17, 0x01, 0xBE, 0xFF, 0xF9, 0x00, 0x70, 0x3A, 0x2D, 0x94, 0xC9, 0x8C, 0x37, 0x23, 0xA6, 
-	0xED, 0x74, 0x00, 0x00, 0x00, 0x0D, 0x74, 0x00, 0x00, 0x00, 0x0D, 0x74, 0x00, 0x00, 0x00, 0x0D, 0x74};
+	0xED, 0x74, 0x00, 0x00, 0x00, 0x0D, 0x74, 0x00, 0x00, 0x00, 0x0D, 0x74, 0x00, 0x00, 0x00, 0x0D, 0x74, 0x00, 0x00, 0x00};
 
 // END-OF-FILE
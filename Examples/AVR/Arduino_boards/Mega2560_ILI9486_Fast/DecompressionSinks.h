@@ -0,0 +1,528 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+Output sinks for the template version of decompressNextFrames():
+
+static uint8_t buffer[...];
+DecompressionBufferSink<2> sink(buffer);
+decomp.decompressNextFrames(dc, compressedData, sink, framesCount);
+
+The sink is a template parameter, so its methods are inlined into the decompression
+loops instead of calling the delegate for every frame. Any class with these methods can be a sink:
+
+template <typename Frame> void writeFrame(Frame frame)
+	- the next decompressed frame;
+template <typename Frame, typename Count> void writeRun(Frame frame, Count count)
+	- the run of identical frames (the whole constant block or its part);
+void moveTo(uint32_t position)
+	- images split into squares only: the next frame goes to the specified position
+	(in frames) of the buffer which is bufferWidth frames wide.
+	Stream sinks (callback, SPI, FSMC, display) can't move, so the address window
+	of the display must be set by the caller.
+
+RGB565 frames can be converted into the pixel format of the display right at the store,
+so the buffer is ready for the transfer without a second pass:
+
+static uint8_t buffer[IMAGE_WIDTH * SQUARE_SIDE * 3];
+DecompressionPixelSink<DecompressionFormatRGB666<> > sink(buffer);
+
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include <stdint.h>
+#include <string.h>
+
+#if defined(AVR)
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#endif
+
+#ifndef _DELTA_DECOMPRESSION_SINKS_
+#define _DELTA_DECOMPRESSION_SINKS_
+
+// Shorter runs of identical frames are written frame by frame (bulk fill doesn't pay off)
+#define DECOMPRESSION_BULK_FILL_THRESHOLD	16
+
+// Shorter runs of identical pixels are stored into the buffer of the display driver
+// (a separate fill request doesn't pay off), see DecompressionDisplaySink
+#define DECOMPRESSION_DISPLAY_RUN_THRESHOLD	64
+
+// Fill the buffer with the run of identical frames (big-endian bytes of the specified size)
+static inline uint8_t * decompressionFillFrames(uint8_t * data, uint64_t frame, uint8_t frameSize, uint32_t framesCount)
+{
+	uint32_t runSize = framesCount * frameSize;
+
+	if (frameSize == 1)
+	{
+		memset(data, frame, runSize);
+	}
+	else
+	{
+		// Write the first frame and then keep doubling the filled part
+		for (uint8_t i = frameSize; i > 0; i--)
+		{
+			data[i - 1] = frame & 0xFF;
+			frame >>= 8;
+		}
+
+		for (uint32_t filled = frameSize; filled < runSize; filled <<= 1)
+		{
+			memcpy(data + filled, data, ((runSize - filled) < filled) ? (runSize - filled) : filled);
+		}
+	}
+
+	return (data + runSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Raw buffer: frames of the specified size (in bytes) are stored as big-endian bytes
+// (the same layout as the buffer version of decompressNextFrames() produces).
+template <uint8_t frameSize>
+class DecompressionBufferSink {
+
+public:
+
+	DecompressionBufferSink(uint8_t * buffer) : buffer(buffer), data(buffer) {}
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame)
+	{
+		for (uint8_t shift = frameSize << 3; shift > 0; )
+		{
+			shift -= 8;
+			*data++ = (frame >> shift) & 0xFF;
+		}
+	}
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count)
+	{
+		if (count < DECOMPRESSION_BULK_FILL_THRESHOLD)
+		{
+			while (count--) writeFrame(frame);
+		}
+		else
+		{
+			data = decompressionFillFrames(data, frame, frameSize, count);
+		}
+	}
+
+	inline void moveTo(uint32_t position) { data = buffer + position * frameSize; }
+
+private:
+
+	uint8_t * buffer;
+	uint8_t * data;
+
+};
+
+// RGB565 (or any 16-bit frames) pixel buffer. Set swapBytes to store pixels
+// with the swapped byte order, which most SPI displays expect when
+// the buffer of a little-endian MCU is sent by DMA as a byte stream.
+template <bool swapBytes = false>
+class DecompressionRGB565Sink {
+
+public:
+
+	DecompressionRGB565Sink(uint16_t * buffer) : buffer(buffer), pixels(buffer) {}
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame)
+	{
+		*pixels++ = pixel(frame);
+	}
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count)
+	{
+		uint16_t value = pixel(frame);
+		while (count--) *pixels++ = value;
+	}
+
+	inline void moveTo(uint32_t position) { pixels = buffer + position; }
+
+private:
+
+	uint16_t * buffer;
+	uint16_t * pixels;
+
+	static inline uint16_t pixel(uint16_t frame) { return (swapBytes ? ((frame << 8) | (frame >> 8)) : frame); }
+
+};
+
+// Pixel formats for DecompressionPixelSink. Each of them converts the RGB565 frame
+// into the bytes of the display pixel: the result holds "size" bytes in the transfer order
+// (the most significant one goes first). Set bgr for the panels with the BGR order of colors.
+
+// Expand 5 and 6 bits color components to 8 bits (the low bits repeat the high ones)
+static inline uint8_t decompressionRed8(uint16_t frame) { return (((frame >> 8) & 0xF8) | (frame >> 13)); }
+static inline uint8_t decompressionGreen8(uint16_t frame) { return (((frame >> 3) & 0xFC) | ((frame >> 9) & 0x03)); }
+static inline uint8_t decompressionBlue8(uint16_t frame) { return (((frame << 3) & 0xF8) | ((frame >> 2) & 0x07)); }
+
+// RGB565 (BGR565) sent as two bytes, high byte first unless swapBytes is set
+template <bool bgr = false, bool swapBytes = false>
+struct DecompressionFormatRGB565
+{
+	static const uint8_t size = 2;
+
+	static inline uint32_t convert(uint16_t frame)
+	{
+		if (bgr) frame = (uint16_t)((frame << 11) | (frame & 0x07E0) | (frame >> 11));
+		return (swapBytes ? (uint16_t)((frame << 8) | (frame >> 8)) : frame);
+	}
+};
+
+// RGB888 (BGR888): three bytes per pixel
+template <bool bgr = false>
+struct DecompressionFormatRGB888
+{
+	static const uint8_t size = 3;
+
+	static inline uint32_t convert(uint16_t frame)
+	{
+		uint32_t first = bgr ? decompressionBlue8(frame) : decompressionRed8(frame);
+		uint32_t last = bgr ? decompressionRed8(frame) : decompressionBlue8(frame);
+		return ((first << 16) | ((uint32_t)decompressionGreen8(frame) << 8) | last);
+	}
+};
+
+// RGB666 (BGR666): three bytes per pixel with 6 significant high bits in each
+// (18-bit color of ILI9486 and similar controllers over SPI)
+template <bool bgr = false>
+struct DecompressionFormatRGB666
+{
+	static const uint8_t size = 3;
+
+	static inline uint32_t convert(uint16_t frame) { return (DecompressionFormatRGB888<bgr>::convert(frame) & 0xFCFCFC); }
+};
+
+// 8-bit grayscale (luma with BT.601 weights)
+struct DecompressionFormatGray8
+{
+	static const uint8_t size = 1;
+
+	static inline uint32_t convert(uint16_t frame)
+	{
+		return (((uint16_t)decompressionRed8(frame) * 77 + (uint16_t)decompressionGreen8(frame) * 150 + (uint16_t)decompressionBlue8(frame) * 29) >> 8);
+	}
+};
+
+// Bytes buffer of the pixels converted into the specified format
+template <class Format>
+class DecompressionPixelSink {
+
+public:
+
+	DecompressionPixelSink(uint8_t * buffer) : buffer(buffer), data(buffer) {}
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame)
+	{
+		store(Format::convert(frame));
+	}
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count)
+	{
+		// The run is converted only once
+		uint32_t pixel = Format::convert(frame);
+
+		if (count < DECOMPRESSION_BULK_FILL_THRESHOLD)
+		{
+			while (count--) store(pixel);
+		}
+		else
+		{
+			data = decompressionFillFrames(data, pixel, Format::size, count);
+		}
+	}
+
+	inline void moveTo(uint32_t position) { data = buffer + position * Format::size; }
+
+private:
+
+	uint8_t * buffer;
+	uint8_t * data;
+
+	inline void store(uint32_t pixel)
+	{
+		for (uint8_t shift = Format::size << 3; shift > 0; )
+		{
+			shift -= 8;
+			*data++ = (pixel >> shift) & 0xFF;
+		}
+	}
+
+};
+
+// Colors of the palette lookup table (in the program memory on AVR if progmem is set)
+template <bool progmem>
+static inline uint16_t decompressionPaletteColor(const uint16_t * palette, uint8_t index)
+{
+#if defined(AVR)
+	if (progmem) return (pgm_read_word(palette + index));
+#endif
+	return (palette[index]);
+}
+
+// Pixel buffer colorized by the palette: frames are indices of up to 256 colors.
+// Unlike the colorizePixel() delegate the lookup is inlined, so there is no call per pixel.
+template <bool progmem = false>
+class DecompressionPaletteSink {
+
+public:
+
+	DecompressionPaletteSink(uint16_t * buffer, const uint16_t * palette) : buffer(buffer), pixels(buffer), palette(palette) {}
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame)
+	{
+		*pixels++ = decompressionPaletteColor<progmem>(palette, frame);
+	}
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count)
+	{
+		uint16_t color = decompressionPaletteColor<progmem>(palette, frame);
+		while (count--) *pixels++ = color;
+	}
+
+	inline void moveTo(uint32_t position) { pixels = buffer + position; }
+
+private:
+
+	uint16_t * buffer;
+	uint16_t * pixels;
+	const uint16_t * palette;
+
+};
+
+// Expand 1-2-4 bits frames packed into bytes (the layout of the buffer version
+// of decompressNextFrames()) into the palette colors. All the frames of a byte are
+// unpacked at once, and the bytes of identical frames (e.g. the background)
+// need only one lookup. So the packed image can be kept decompressed and redrawn
+// in any colors much faster than it is decompressed again.
+template <uint8_t bitsPerFrame, bool progmem = false>
+static inline void decompressionExpandPalette(const uint8_t * packedData, const uint16_t * palette, uint16_t * pixels, uint32_t framesCount)
+{
+	const uint8_t framesPerByte = 8 / bitsPerFrame;
+	const uint8_t frameMask = (1 << bitsPerFrame) - 1;
+	const uint8_t repeatFrame = 0xFF / frameMask; // Multiplier which repeats the frame over the byte
+
+	for (; framesCount >= framesPerByte; framesCount -= framesPerByte)
+	{
+		uint8_t data = *packedData++;
+		uint8_t first = data >> (8 - bitsPerFrame);
+
+		if (data == (uint8_t)(first * repeatFrame))
+		{
+			uint16_t color = decompressionPaletteColor<progmem>(palette, first);
+			for (uint8_t i = 0; i < framesPerByte; i++) *pixels++ = color;
+		}
+		else
+		{
+			for (uint8_t shift = 8; shift > 0; )
+			{
+				shift -= bitsPerFrame;
+				*pixels++ = decompressionPaletteColor<progmem>(palette, (data >> shift) & frameMask);
+			}
+		}
+	}
+
+	// The rest of the frames of the last byte
+	if (framesCount)
+	{
+		uint8_t data = *packedData;
+		for (uint8_t shift = 8; framesCount > 0; framesCount--)
+		{
+			shift -= bitsPerFrame;
+			*pixels++ = decompressionPaletteColor<progmem>(palette, (data >> shift) & frameMask);
+		}
+	}
+}
+
+// Direct call of the function for every frame. Unlike the weak delegate
+// the function is known at compile time, so the call can be inlined.
+template <typename FrameType, void (*callback)(FrameType)>
+class DecompressionCallbackSink {
+
+public:
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame) { callback(frame); }
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count)
+	{
+		while (count--) callback(frame);
+	}
+
+	inline void moveTo(uint32_t position) {}
+
+};
+
+#if defined(AVR) && defined(SPDR)
+
+// Direct writes to the AVR hardware SPI (frames of the specified size are sent MSB first).
+// The bus must be already configured (SPI.beginTransaction() or similar).
+template <uint8_t frameSize>
+class DecompressionSPISink {
+
+public:
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame)
+	{
+		for (uint8_t shift = frameSize << 3; shift > 0; )
+		{
+			shift -= 8;
+			transfer(frame >> shift);
+		}
+	}
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count)
+	{
+		while (count--) writeFrame(frame);
+	}
+
+	inline void moveTo(uint32_t position) {}
+
+private:
+
+	static inline void transfer(uint8_t data)
+	{
+		SPDR = data;
+		asm volatile("nop"); // The same trick as in the SPI library: the flag is checked one cycle later
+		while (!(SPSR & _BV(SPIF))) ;
+	}
+
+};
+
+#endif
+
+// 16-bit pixels streamed to the display driver: the decoded pixels are stored
+// into the buffer of the driver, and the runs of at least "threshold" identical
+// pixels (constant blocks) are sent as fill requests (e.g. the DMA transfer
+// from a fixed source), so they cost no stores and no buffer space.
+// Any class with these methods can be the display:
+//
+// uint16_t * getBuffer(uint16_t & size)
+//	- the free buffer of the driver and its size in pixels;
+// void writePixels(uint16_t * pixels, uint16_t count)
+//	- the filled part of the buffer (from its beginning);
+// void fillPixels(uint16_t pixel, uint32_t count)
+//	- the run of the pixel.
+//
+// The pixels of the last buffer are sent by flush().
+template <class Display>
+class DecompressionDisplaySink {
+
+public:
+
+	DecompressionDisplaySink(Display & display, uint16_t threshold = DECOMPRESSION_DISPLAY_RUN_THRESHOLD) :
+		display(display), buffer(NULL), pixels(NULL), left(0), threshold(threshold) {}
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame)
+	{
+		if (!left)
+		{
+			flush();
+			buffer = display.getBuffer(left);
+			pixels = buffer;
+		}
+		*pixels++ = frame;
+		left--;
+	}
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count)
+	{
+		if (count >= threshold)
+		{
+			flush();
+			display.fillPixels(frame, count);
+		}
+		else
+		{
+			while (count--) writeFrame(frame);
+		}
+	}
+
+	inline void moveTo(uint32_t position) {}
+
+	// Send the decoded pixels of the buffer
+	inline void flush()
+	{
+		if (pixels != buffer) display.writePixels(buffer, pixels - buffer);
+		buffer = NULL;
+		pixels = NULL;
+		left = 0;
+	}
+
+private:
+
+	Display & display;
+	uint16_t * buffer;
+	uint16_t * pixels;
+	uint16_t left;
+	uint16_t threshold;
+
+};
+
+// Direct writes of 16-bit frames to the memory-mapped data register
+// of the display (STM32 FSMC/FMC and similar parallel buses).
+template <uintptr_t dataAddress>
+class DecompressionFSMCSink {
+
+public:
+
+	template <typename Frame>
+	inline void writeFrame(Frame frame) { *(volatile uint16_t *)dataAddress = frame; }
+
+	template <typename Frame, typename Count>
+	inline void writeRun(Frame frame, Count count)
+	{
+		while (count--) *(volatile uint16_t *)dataAddress = frame;
+	}
+
+	inline void moveTo(uint32_t position) {}
+
+};
+
+#endif // end _DELTA_DECOMPRESSION_SINKS_
+
+// END-OF-FILE
@@ -0,0 +1,1228 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+The decompression template shared by the original class and all its modifications.
+The modifications differ only in integer widths, limits and features, so each of them
+is just a configuration of this template (see Decompression.h of the modification):
+
+struct DecompressionConfig
+{
+	typedef ... Context;		// Decompression context of the exported data
+	typedef ... CompressedData;	// Pointer to the compressed data (or to the array of far chunks)
+	typedef ... BitsBuffer;		// Input bits buffer: uint16_t, uint32_t or uint64_t (refilled by half-width words)
+	typedef ... ReadBits;		// The longest single read: channel value or block length
+	typedef ... ChannelValue;	// Decompressed channel value
+	typedef ... Frame;		// All channels of the frame together
+	typedef ... FramesCounter;	// Frames per call and per block
+	typedef ... ByteIndex;		// Read position within the compressed data (or the chunk)
+	typedef ... Position;		// Frame position within the output buffer (squares)
+
+	static const uint8_t maxNumberOfChannels = ...;
+	static const uint8_t deltaOption = ...;		// DECOMPRESSION_OPTION_...
+	static const bool useSquares = ...;		// Data may be split into squares
+	static const bool packedFrames = ...;		// Data may contain 1-2-4 bits frames
+	static const uint16_t chunkSize = ...;		// Far memory chunk size (if chunks are used)
+
+	// Delegates
+	static void frameDecompressed(Frame frame);
+	static void frameRunDecompressed(Frame frame, FramesCounter count);
+	static uint16_t colorizePixel(Frame frame);
+};
+
+typedef DeltaDecoder<DecompressionConfig> Decompression;
+
+Every configuration option is a compile-time constant, so the compiler drops
+the code of unused features just like the preprocessor did in the separate copies.
+
+The decoder never uses the heap: all its state is sized at compile time by the
+configuration, so sizeof(Decompression) is its whole RAM footprint and the object
+can be placed statically (the output buffer is always provided by the caller).
+
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include <stdint.h>
+#include <string.h>
+#include "DecompressionSinks.h"
+
+#if defined(AVR)
+#include <avr/pgmspace.h>
+#endif
+
+#ifndef _DELTA_DECODER_
+#define _DELTA_DECODER_
+
+// Delta options (the same values as the compressor exports)
+#define DECOMPRESSION_OPTION_FIXED_WINDOW_ONLY	0
+#define DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_ONLY	1
+#define DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST	2
+#define DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_FIRST	3
+
+// Zero bytes that follow the compressed data (the compressor appends them),
+// so the last word read never goes beyond the end of the array
+#define DECOMPRESSION_DATA_PADDING	3
+
+// Block decoding plans (chosen once per block header)
+#define DECOMPRESSION_PLAN_CONSTANT	0	// All channels keep their base values
+#define DECOMPRESSION_PLAN_FIXED	1	// Fixed window (or raw) channels only
+#define DECOMPRESSION_PLAN_ADAPTIVE	2	// At least one channel uses the adaptive floating window
+
+// Seek index may be placed in the program memory on AVR
+#if defined(AVR)
+#define SEEK_POINT_FIELD(p, f)  pgm_read_dword(&((p)->f))
+#else
+#define SEEK_POINT_FIELD(p, f)  ((p)->f)
+#endif
+
+// Seek point (optionally exported along with the compressed data):
+// the first frame of a block and the bit offset of its header.
+struct DecompressionSeekPoint
+{
+	uint32_t frame;
+	uint32_t bitOffset;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// The bits buffer is refilled by big-endian words of half its width
+// (see DeltaDecoder::refillBits() for details).
+template <typename BitsBuffer>
+struct DeltaDecoderWord;
+
+template <>
+struct DeltaDecoderWord<uint16_t>
+{
+	typedef uint8_t Type;
+
+	static inline uint8_t read(const uint8_t * data)
+	{
+#if defined(AVR)
+		return (pgm_read_byte(data));
+#else
+		return (*data);
+#endif
+	}
+
+#if defined(AVR)
+	static inline uint8_t readFar(uint_farptr_t address) { return (pgm_read_byte_far(address)); }
+#endif
+};
+
+template <>
+struct DeltaDecoderWord<uint32_t>
+{
+	typedef uint16_t Type;
+
+	static inline uint16_t read(const uint8_t * data)
+	{
+#if defined(AVR)
+		return (__builtin_bswap16(pgm_read_word(data)));
+#else
+		// memcpy is the portable unaligned load (a single instruction where the core allows it)
+		uint16_t word;
+		memcpy(&word, data, sizeof(word));
+# if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+		word = __builtin_bswap16(word);
+# endif
+		return (word);
+#endif
+	}
+
+#if defined(AVR)
+	static inline uint16_t readFar(uint_farptr_t address) { return (__builtin_bswap16(pgm_read_word_far(address))); }
+#endif
+};
+
+template <>
+struct DeltaDecoderWord<uint64_t>
+{
+	typedef uint32_t Type;
+
+	static inline uint32_t read(const uint8_t * data)
+	{
+#if defined(AVR)
+		return (__builtin_bswap32(pgm_read_dword(data)));
+#else
+		uint32_t word;
+		memcpy(&word, data, sizeof(word));
+# if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+		word = __builtin_bswap32(word);
+# endif
+		return (word);
+#endif
+	}
+
+#if defined(AVR)
+	static inline uint32_t readFar(uint_farptr_t address) { return (__builtin_bswap32(pgm_read_dword_far(address))); }
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Squares shared by many images of an asset pack (the tile table, see DecompressionPack.h).
+// The stream of the image doesn't contain the referenced squares, the decoder takes
+// their frames from the table instead. The offsets are within the data
+// (the pack, or the array of its far memory chunks).
+template <class Config>
+struct DecompressionTiles
+{
+	typename Config::CompressedData data;
+	uint32_t tableOffset;		// Frames of the tiles: square side * square side frames of (bits per frame + 7) / 8 bytes each
+	uint32_t referencesOffset;	// References of the image: the square (24 bits) and the tile (8 bits), sorted by squares
+	uint32_t referencesCount;
+};
+
+#define DECOMPRESSION_TILE_REFERENCE_SIZE	4
+#define DECOMPRESSION_NO_TILE				0xFFFFFFFF
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Output position for images split into squares: the runs of frames must not cross
+// the row of the square, and the output moves to the next row after each one.
+// The position within the row of squares is kept between decompressNextFrames() calls,
+// so any number of frames can be requested per call.
+template <class Config, bool squares = Config::useSquares>
+struct DeltaDecoderSquares
+{
+	typedef typename Config::Context Context;
+	typedef typename Config::CompressedData CompressedData;
+	typedef typename Config::Frame Frame;
+	typedef typename Config::FramesCounter FramesCounter;
+	typedef typename Config::Position Position;
+
+	uint8_t row;
+	uint8_t column;
+	Position squareOffset;
+	Position squareLineOffset; // Rows of squares completed within the current call
+
+	// Tile references: the square of the image, the next reference and its square
+	uint32_t square;
+	uint32_t tileReference;
+	uint32_t tileSquare;
+
+	DeltaDecoderSquares() { reset(); }
+
+	inline void reset()
+	{
+		row = 0;
+		column = 0;
+		squareOffset = 0;
+		squareLineOffset = 0;
+		square = 0;
+		tileReference = 0;
+		tileSquare = DECOMPRESSION_NO_TILE;
+	}
+
+	// Square of the next tile reference (if any)
+	inline void loadTile(const DecompressionTiles<Config> * tiles)
+	{
+		tileSquare = DECOMPRESSION_NO_TILE;
+		if (!tiles || (tileReference >= tiles->referencesCount)) return;
+
+		uint32_t reference = tiles->referencesOffset + tileReference * DECOMPRESSION_TILE_REFERENCE_SIZE;
+		tileSquare = tileByte(tiles->data, reference) | ((uint32_t)tileByte(tiles->data, reference + 1) << 8) | ((uint32_t)tileByte(tiles->data, reference + 2) << 16);
+	}
+
+	inline bool tileReferenced() { return (square == tileSquare); }
+
+	// Frames of the current row of the referenced square from the tile table
+	template <class Sink>
+	inline FramesCounter outputTile(const Context * dc, const DecompressionTiles<Config> * tiles, Sink & sink, FramesCounter framesCount, uint16_t bufferWidth)
+	{
+		FramesCounter runLength = limitRun(dc, framesCount);
+		uint8_t frameSize = (dc->bitsPerFrame + 7) >> 3;
+		uint8_t tile = tileByte(tiles->data, tiles->referencesOffset + tileReference * DECOMPRESSION_TILE_REFERENCE_SIZE + 3);
+		uint32_t offset = tiles->tableOffset + ((uint32_t)tile * dc->squareSide * dc->squareSide + (uint16_t)row * dc->squareSide + column) * frameSize;
+
+		for (FramesCounter i = 0; i < runLength; i++)
+		{
+			Frame frame = 0;
+			for (uint8_t j = frameSize; j > 0; ) frame = (frame << 8) | tileByte(tiles->data, offset + --j); // Little-endian
+			offset += frameSize;
+			sink.writeFrame(frame);
+		}
+
+		// The last row of the tile moves to the next reference
+		if ((row == dc->squareSide - 1) && (column + runLength >= dc->squareSide))
+		{
+			tileReference++;
+			loadTile(tiles);
+		}
+		advance(dc, sink, runLength, bufferWidth);
+		return (runLength);
+	}
+
+	// Read the tiles (two options for near and far memory)
+	static inline uint8_t tileByte(const uint8_t * data, uint32_t offset) { return (DeltaDecoderWord<uint16_t>::read(data + offset)); }
+#if defined(AVR)
+	static inline uint8_t tileByte(uint_farptr_t * data, uint32_t offset) { return (DeltaDecoderWord<uint16_t>::readFar(data[offset / Config::chunkSize] + offset % Config::chunkSize)); }
+#endif
+
+	// Position of the frame within the row of squares (used after a seek)
+	inline void setFrame(const Context * dc, uint32_t frame)
+	{
+		reset();
+		if (!dc->splitToSquares) return;
+
+		uint16_t squareSize = (uint16_t)dc->squareSide * dc->squareSide;
+		uint32_t lineFrame = frame % dc->squaresPerWidthSize;
+		squareOffset = (lineFrame / squareSize) * dc->squareSide;
+		lineFrame %= squareSize;
+		row = lineFrame / dc->squareSide;
+		column = lineFrame % dc->squareSide;
+	}
+
+	// Position after the skipped frames
+	inline void skip(const Context * dc, uint32_t framesCount)
+	{
+		if (!dc->splitToSquares) return;
+
+		uint32_t lineFrame = (uint32_t)(squareOffset / dc->squareSide) * dc->squareSide * dc->squareSide + (uint16_t)row * dc->squareSide + column;
+		setFrame(dc, lineFrame + framesCount % dc->squaresPerWidthSize);
+	}
+
+	// Every call decompresses into the beginning of the row of squares in the buffer,
+	// so continue from the same place where the previous call stopped
+	template <class Sink>
+	inline void resume(const Context * dc, Sink & sink, uint16_t bufferWidth)
+	{
+		squareLineOffset = 0;
+		if (dc->splitToSquares && (row || column || squareOffset)) sink.moveTo(squareOffset + (Position)row * bufferWidth + column);
+	}
+
+	// Side of the squares (1 for the data that is not split)
+	inline uint8_t side(const Context * dc) { return (dc->splitToSquares ? dc->squareSide : 1); }
+
+	inline FramesCounter limitRun(const Context * dc, FramesCounter runLength)
+	{
+		if (dc->splitToSquares && (runLength > (FramesCounter)(dc->squareSide - column))) runLength = dc->squareSide - column;
+		return (runLength);
+	}
+
+	template <class Sink>
+	inline void advance(const Context * dc, Sink & sink, FramesCounter runLength, uint16_t bufferWidth)
+	{
+		if (!dc->splitToSquares) return;
+
+		column += runLength;
+		if (column >= dc->squareSide)
+		{
+			row++;
+			if (row >= dc->squareSide)
+			{
+				square++;
+				squareOffset += dc->squareSide;
+				if (squareOffset >= dc->imageWidth)
+				{
+					squareLineOffset += dc->squaresPerWidthSize;
+					squareOffset = 0;
+				}
+				row = 0;
+			}
+			column = 0;
+
+			sink.moveTo(squareLineOffset + squareOffset + (Position)row * bufferWidth);
+		}
+	}
+};
+
+template <class Config>
+struct DeltaDecoderSquares<Config, false>
+{
+	typedef typename Config::Context Context;
+	typedef typename Config::FramesCounter FramesCounter;
+
+	inline void reset() {}
+	inline void setFrame(const Context * dc, uint32_t frame) {}
+	inline void skip(const Context * dc, uint32_t framesCount) {}
+	inline uint8_t side(const Context * dc) { return (1); }
+
+	inline void loadTile(const DecompressionTiles<Config> * tiles) {}
+	inline bool tileReferenced() { return (false); }
+
+	template <class Sink>
+	inline FramesCounter outputTile(const Context * dc, const DecompressionTiles<Config> * tiles, Sink & sink, FramesCounter framesCount, uint16_t bufferWidth) { return (framesCount); }
+
+	template <class Sink>
+	inline void resume(const Context * dc, Sink & sink, uint16_t bufferWidth) {}
+
+	inline FramesCounter limitRun(const Context * dc, FramesCounter runLength) { return (runLength); }
+
+	template <class Sink>
+	inline void advance(const Context * dc, Sink & sink, FramesCounter runLength, uint16_t bufferWidth) {}
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+template <class Config>
+class DeltaDecoder {
+
+	static_assert(Config::maxNumberOfChannels > 0, "At least one channel is required");
+	static_assert(sizeof(typename Config::Frame) >= sizeof(typename Config::ChannelValue), "The frame must hold at least one channel value");
+
+public:
+
+	typedef typename Config::Context Context;
+	typedef typename Config::CompressedData CompressedData;
+	typedef typename Config::BitsBuffer BitsBuffer;
+	typedef typename Config::ReadBits ReadBits;
+	typedef typename Config::ChannelValue ChannelValue;
+	typedef typename Config::Frame Frame;
+	typedef typename Config::FramesCounter FramesCounter;
+	typedef typename Config::ByteIndex ByteIndex;
+	typedef typename Config::Position Position;
+
+	BitsBuffer inputBitsBuffer;
+	uint8_t inputChunkIndex; // Additional variable for ROM chunk index (if far memory chunks are used)
+	ByteIndex inputByteIndex;
+	uint8_t inputBitsCount;
+
+	FramesCounter currentBlockFramesCount;
+	uint8_t currentBlockMethods[Config::maxNumberOfChannels];
+	ChannelValue currentBaseValues[Config::maxNumberOfChannels];
+	bool currentBlockAFW[Config::maxNumberOfChannels];
+	bool currentBlockFirstFrame;
+	uint8_t currentBlockPlan; // Specialized decoding loop chosen by the block header
+
+	DeltaDecoderSquares<Config> squares; // Output position within the row of squares
+
+	// In the case of decompression images divided into squares, 
+	// set this variable to the width of your decompression buffer in pixels.
+	uint16_t bufferWidth;
+
+	DeltaDecoder() : tiles(NULL) {}
+
+	void resetDecompression();
+
+	// Take the squares referenced by the image from the tile table (NULL - the data has no references,
+	// see DecompressionPack.h). The references are followed by decompressNextFrames() from the beginning
+	// of the image only: seekToFrame(), skipFrames() and decompressRegion() don't support them.
+	void useTiles(const DecompressionTiles<Config> * tiles);
+
+	// Decompression into the buffer of bytes (or to the delegate if the buffer is NULL)
+	void decompressNextFrames(const Context * dc, CompressedData compressedData, uint8_t * decompressedData, FramesCounter framesCount);
+
+	// Decompression into the pixel buffer, i.e. uint16_t (RGB565, RGB555, RGB444),
+	// optionally colorized by the colorizePixel() delegate
+	void decompressNextFrames(const Context * dc, CompressedData compressedData, uint16_t * decompressedData, FramesCounter framesCount, bool colorize);
+
+	// Decompression into the output sink (see DecompressionSinks.h).
+	// The sink methods are inlined into the decompression loops.
+	template <class Sink>
+	void decompressNextFrames(const Context * dc, CompressedData compressedData, Sink & sink, FramesCounter framesCount);
+
+	// Advance by the specified number of frames without output, as if they were
+	// decompressed: only the block headers are read, the frames just move the read position
+	// (except a part of an adaptive floating window block). For data split into squares,
+	// the next decompressNextFrames() call continues from the position of the frame
+	// within its row of squares.
+	void skipFrames(const Context * dc, CompressedData compressedData, uint32_t framesCount);
+
+	// Restore the state at the nearest seek point and skip up to the specified frame.
+	// For data split into squares, the next decompressNextFrames() call continues
+	// from the position of this frame within its row of squares.
+	bool seekToFrame(const Context * dc, CompressedData compressedData, const DecompressionSeekPoint * seekIndex, uint16_t seekPointsCount, uint32_t frame);
+
+	// The same for the seek point found by the caller (e.g. in an index stored elsewhere,
+	// see DecompressionPack.h): the frame of the point must not be after the requested one.
+	void seekToPoint(const Context * dc, CompressedData compressedData, uint32_t pointFrame, uint32_t pointBitOffset, uint32_t frame);
+
+	// Decompress only the rectangle (x, y, width, height) of the image from the beginning
+	// of the data: the output is width x height frames row by row (in any layout of the data).
+	// The frames outside the rectangle are skipped without output, whole blocks
+	// by moving the read position. The image width must be a multiple of the square side.
+	void decompressRegion(const Context * dc, CompressedData compressedData, uint16_t * decompressedData, uint16_t imageWidth, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+	template <class Sink>
+	void decompressRegion(const Context * dc, CompressedData compressedData, Sink & sink, uint16_t imageWidth, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+private:
+
+	typedef typename DeltaDecoderWord<BitsBuffer>::Type Word;
+
+	static_assert(sizeof(Word) - 1 <= DECOMPRESSION_DATA_PADDING, "The word read must not go beyond the padding of the data");
+
+	const DecompressionTiles<Config> * tiles;
+
+	void readBlockHeader(const Context * dc, CompressedData compressedData);
+	template <class Sink>
+	void decompressRun(const Context * dc, CompressedData compressedData, Sink & sink, FramesCounter framesCount);
+	template <uint8_t plan, class Sink>
+	void decompressPlannedFrames(const Context * dc, CompressedData compressedData, Sink & sink, FramesCounter framesCount);
+	template <class Sink>
+	void outputFrames(const Context * dc, CompressedData compressedData, Sink & sink, uint32_t framesCount);
+	void skipDataFrames(const Context * dc, CompressedData compressedData, uint32_t framesCount);
+
+	uint32_t getBytePosition(const uint8_t * compressedData);
+	void setBytePosition(const uint8_t * compressedData, uint32_t byteOffset);
+	void refillBits(const uint8_t * compressedData);
+#if defined(AVR)
+	uint32_t getBytePosition(uint_farptr_t * compressedData);
+	void setBytePosition(uint_farptr_t * compressedData, uint32_t byteOffset);
+	void refillBits(uint_farptr_t * compressedData);
+#endif
+	void setBitPosition(CompressedData compressedData, uint32_t bitOffset);
+	void advanceBits(CompressedData compressedData, uint32_t bitsCount);
+	ReadBits peekNextBits(CompressedData compressedData, uint8_t bitsCount);
+	ReadBits readNextBits(CompressedData compressedData, uint8_t bitsCount);
+	void skipBits(uint8_t bitsCount);
+
+	// Output sinks behind the buffer and delegate versions of decompressNextFrames()
+
+	// Whole bytes frames (any frame size known at runtime only)
+	class BytesSink {
+
+	public:
+
+		BytesSink(uint8_t * buffer, uint8_t frameSize) : buffer(buffer), data(buffer), frameSize(frameSize) {}
+
+		inline void writeFrame(Frame frame)
+		{
+			for (uint8_t shift = frameSize << 3; shift > 0; )
+			{
+				shift -= 8;
+				*data++ = (frame >> shift) & 0xFF;
+			}
+		}
+
+		inline void writeRun(Frame frame, FramesCounter count)
+		{
+			if (count < DECOMPRESSION_BULK_FILL_THRESHOLD)
+			{
+				while (count--) writeFrame(frame);
+			}
+			else
+			{
+				data = decompressionFillFrames(data, frame, frameSize, count);
+			}
+		}
+
+		inline void moveTo(Position position) { data = buffer + position * frameSize; }
+
+	private:
+
+		uint8_t * buffer;
+		uint8_t * data;
+		uint8_t frameSize;
+
+	};
+
+	// 1-2-4 bits frames packed into the buffer bytes
+	class PackedSink {
+
+	public:
+
+		PackedSink(uint8_t * buffer, uint8_t bitsPerFrame) : buffer(buffer), dataOffset(0), bitOffset(0), bitsPerFrame(bitsPerFrame) {}
+
+		inline void writeFrame(Frame frame)
+		{
+			uint8_t storedBufferData = (bitOffset == 0) ? 0 : buffer[dataOffset];
+
+			storedBufferData |= (frame << (8 - bitsPerFrame - bitOffset));
+			buffer[dataOffset] = storedBufferData;
+
+			bitOffset += bitsPerFrame;
+			if (bitOffset >= 8)
+			{
+				dataOffset++;
+				bitOffset = 0;
+			}
+		}
+
+		inline void writeRun(Frame frame, FramesCounter count)
+		{
+			if (count >= DECOMPRESSION_BULK_FILL_THRESHOLD)
+			{
+				// Complete the partially filled byte
+				while (bitOffset != 0)
+				{
+					writeFrame(frame);
+					count--;
+				}
+
+				// Then fill whole bytes with the repeated frame
+				uint8_t framesPerByte = 8 / bitsPerFrame;
+				uint8_t pattern = 0;
+				for (uint8_t i = 0; i < framesPerByte; i++) pattern = (pattern << bitsPerFrame) | frame;
+
+				FramesCounter bytesCount = count / framesPerByte;
+				memset(buffer + dataOffset, pattern, bytesCount);
+				dataOffset += bytesCount;
+				count -= bytesCount * framesPerByte;
+			}
+
+			// And the rest of the frames
+			while (count--) writeFrame(frame);
+		}
+
+		inline void moveTo(Position position)
+		{
+			uint32_t bitsDataOffset = (uint32_t)position * bitsPerFrame;
+			dataOffset = bitsDataOffset >> 3;
+			bitOffset = bitsDataOffset - ((uint32_t)dataOffset << 3);
+		}
+
+	private:
+
+		uint8_t * buffer;
+		Position dataOffset;
+		uint8_t bitOffset;
+		uint8_t bitsPerFrame;
+
+	};
+
+	// colorizePixel() results to the pixel buffer
+	class ColorizeSink {
+
+	public:
+
+		ColorizeSink(uint16_t * buffer) : buffer(buffer), pixels(buffer) {}
+
+		inline void writeFrame(Frame frame) { *pixels++ = Config::colorizePixel(frame); }
+
+		inline void writeRun(Frame frame, FramesCounter count)
+		{
+			uint16_t pixel = Config::colorizePixel(frame);
+			while (count--) *pixels++ = pixel;
+		}
+
+		inline void moveTo(Position position) { pixels = buffer + position; }
+
+	private:
+
+		uint16_t * buffer;
+		uint16_t * pixels;
+
+	};
+
+	// Delegate methods
+	class DelegateSink {
+
+	public:
+
+		inline void writeFrame(Frame frame) { Config::frameDecompressed(frame); }
+		inline void writeRun(Frame frame, FramesCounter count) { Config::frameRunDecompressed(frame, count); }
+		inline void moveTo(Position position) {}
+
+	};
+
+	// No output (used for seeking)
+	class DiscardSink {
+
+	public:
+
+		inline void writeFrame(Frame frame) {}
+		inline void writeRun(Frame frame, FramesCounter count) {}
+		inline void moveTo(Position position) {}
+
+	};
+
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Clear runtime variables
+template <class Config>
+void DeltaDecoder<Config>::resetDecompression()
+{
+	inputBitsBuffer = 0;
+	inputChunkIndex = 0;
+	inputByteIndex = 0;
+	inputBitsCount = 0;
+
+	currentBlockFramesCount = 0;
+
+	squares.reset();
+	squares.loadTile(tiles);
+}
+
+template <class Config>
+void DeltaDecoder<Config>::useTiles(const DecompressionTiles<Config> * tiles)
+{
+	this->tiles = tiles;
+	squares.loadTile(tiles);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Batch decompression (specified number of frames) into the buffer or to the delegate.
+// The output doesn't change during the call, so we choose the sink once.
+template <class Config>
+void DeltaDecoder<Config>::decompressNextFrames(const Context * dc, CompressedData compressedData, uint8_t * decompressedData, FramesCounter framesCount)
+{
+	if (decompressedData)
+	{
+		if ((dc->bitsPerFrame % 8) == 0)
+		{
+			// The most common frame sizes get the loops with the size known at compile time
+			if (dc->bitsPerFrame == 8)
+			{
+				DecompressionBufferSink<1> sink(decompressedData);
+				decompressNextFrames(dc, compressedData, sink, framesCount);
+			}
+			else if (sizeof(Frame) <= 2)
+			{
+				DecompressionBufferSink<2> sink(decompressedData);
+				decompressNextFrames(dc, compressedData, sink, framesCount);
+			}
+			else
+			{
+				BytesSink sink(decompressedData, dc->bitsPerFrame >> 3);
+				decompressNextFrames(dc, compressedData, sink, framesCount);
+			}
+			return;
+		}
+
+		if (Config::packedFrames && ((8 % dc->bitsPerFrame) == 0))
+		{
+			PackedSink sink(decompressedData, dc->bitsPerFrame);
+			decompressNextFrames(dc, compressedData, sink, framesCount);
+			return;
+		}
+
+		// Otherwise the frame width is not a multiple of 1, 2, 4 or 8 bits,
+		// so we must ask the delegate for help.
+	}
+
+	DelegateSink sink;
+	decompressNextFrames(dc, compressedData, sink, framesCount);
+}
+
+// Batch decompression (specified number of frames) into the pixel buffer or to the delegate
+template <class Config>
+void DeltaDecoder<Config>::decompressNextFrames(const Context * dc, CompressedData compressedData, uint16_t * decompressedData, FramesCounter framesCount, bool colorize)
+{
+	if (!decompressedData)
+	{
+		DelegateSink sink;
+		decompressNextFrames(dc, compressedData, sink, framesCount);
+	}
+	else if (colorize)
+	{
+		ColorizeSink sink(decompressedData);
+		decompressNextFrames(dc, compressedData, sink, framesCount);
+	}
+	else
+	{
+		DecompressionRGB565Sink<> sink(decompressedData);
+		decompressNextFrames(dc, compressedData, sink, framesCount);
+	}
+}
+
+// Batch decompression (specified number of frames) into the sink
+template <class Config>
+template <class Sink>
+void DeltaDecoder<Config>::decompressNextFrames(const Context * dc, CompressedData compressedData, Sink & sink, FramesCounter framesCount)
+{
+	squares.resume(dc, sink, bufferWidth);
+
+	while (framesCount > 0)
+	{
+		// The referenced square is not in the compressed data
+		if (squares.tileReferenced())
+		{
+			framesCount -= squares.outputTile(dc, tiles, sink, framesCount, bufferWidth);
+			continue;
+		}
+
+		if (currentBlockFramesCount == 0)
+		{
+			readBlockHeader(dc, compressedData);
+		}
+
+		// The run of frames that can be decompressed by a single specialized loop
+		FramesCounter runLength = (framesCount < currentBlockFramesCount) ? framesCount : currentBlockFramesCount;
+		runLength = squares.limitRun(dc, runLength);
+
+		decompressRun(dc, compressedData, sink, runLength);
+
+		framesCount -= runLength;
+		currentBlockFramesCount -= runLength;
+
+		squares.advance(dc, sink, runLength, bufferWidth);
+	}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Jump to the specified frame using the seek index exported along with the compressed data.
+// Seek points are block starts, so the restored state is just a bit position:
+// methods, base values and window flags will be read from the block header.
+// The frames between the seek point and the requested one are skipped.
+template <class Config>
+bool DeltaDecoder<Config>::seekToFrame(const Context * dc, CompressedData compressedData, const DecompressionSeekPoint * seekIndex, uint16_t seekPointsCount, uint32_t frame)
+{
+	if (!seekPointsCount) return (false);
+
+	// Binary search for the last seek point at or before the frame
+	uint16_t low = 0;
+	uint16_t high = seekPointsCount - 1;
+	while (low < high)
+	{
+		uint16_t middle = (low + high + 1) >> 1;
+		if (SEEK_POINT_FIELD(seekIndex + middle, frame) <= frame) low = middle;
+		else high = middle - 1;
+	}
+
+	uint32_t seekPointFrame = SEEK_POINT_FIELD(seekIndex + low, frame);
+	if (seekPointFrame > frame) return (false);
+
+	seekToPoint(dc, compressedData, seekPointFrame, SEEK_POINT_FIELD(seekIndex + low, bitOffset), frame);
+	return (true);
+}
+
+template <class Config>
+void DeltaDecoder<Config>::seekToPoint(const Context * dc, CompressedData compressedData, uint32_t pointFrame, uint32_t pointBitOffset, uint32_t frame)
+{
+	resetDecompression();
+	setBitPosition(compressedData, pointBitOffset);
+
+	skipDataFrames(dc, compressedData, frame - pointFrame);
+	squares.setFrame(dc, frame);
+}
+
+// Skip frames and move the output position within the row of squares over them
+template <class Config>
+void DeltaDecoder<Config>::skipFrames(const Context * dc, CompressedData compressedData, uint32_t framesCount)
+{
+	skipDataFrames(dc, compressedData, framesCount);
+	squares.skip(dc, framesCount);
+}
+
+// Decompress consecutive frames of the data into the sink as they are
+// (the output position is up to the caller)
+template <class Config>
+template <class Sink>
+void DeltaDecoder<Config>::outputFrames(const Context * dc, CompressedData compressedData, Sink & sink, uint32_t framesCount)
+{
+	while (framesCount > 0)
+	{
+		if (currentBlockFramesCount == 0) readBlockHeader(dc, compressedData);
+
+		FramesCounter runLength = (framesCount < currentBlockFramesCount) ? framesCount : currentBlockFramesCount;
+		decompressRun(dc, compressedData, sink, runLength);
+
+		framesCount -= runLength;
+		currentBlockFramesCount -= runLength;
+	}
+}
+
+// Skip frames without decompressing them. Every frame of the block takes the bits
+// of all its channel methods, so the read position just moves over the constant
+// and fixed window frames. The adaptive channels depend on the previous frames,
+// so only the rest of such a block is skipped at once (a part is decompressed silently).
+// The output position is not changed.
+template <class Config>
+void DeltaDecoder<Config>::skipDataFrames(const Context * dc, CompressedData compressedData, uint32_t framesCount)
+{
+	while (framesCount > 0)
+	{
+		if (currentBlockFramesCount == 0) readBlockHeader(dc, compressedData);
+
+		FramesCounter runLength = (framesCount < currentBlockFramesCount) ? framesCount : currentBlockFramesCount;
+
+		if ((currentBlockPlan == DECOMPRESSION_PLAN_ADAPTIVE) && (runLength < currentBlockFramesCount))
+		{
+			DiscardSink sink;
+			decompressRun(dc, compressedData, sink, runLength);
+		}
+		else if (currentBlockPlan != DECOMPRESSION_PLAN_CONSTANT)
+		{
+			uint32_t bitsPerFrame = 0;
+			uint32_t firstFrameSavedBits = 0; // The first frame of the block doesn't read the adaptive channels
+			for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+			{
+				bitsPerFrame += currentBlockMethods[c];
+				if ((currentBlockPlan == DECOMPRESSION_PLAN_ADAPTIVE) && currentBlockFirstFrame && currentBlockAFW[c]) firstFrameSavedBits += currentBlockMethods[c];
+			}
+
+			advanceBits(compressedData, bitsPerFrame * runLength - firstFrameSavedBits);
+			currentBlockFirstFrame = false;
+		}
+
+		framesCount -= runLength;
+		currentBlockFramesCount -= runLength;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Region of the image into the pixel buffer
+template <class Config>
+void DeltaDecoder<Config>::decompressRegion(const Context * dc, CompressedData compressedData, uint16_t * decompressedData, uint16_t imageWidth, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+	DecompressionRGB565Sink<> sink(decompressedData);
+	decompressRegion(dc, compressedData, sink, imageWidth, x, y, width, height);
+}
+
+// Region of the image into the sink. The frames are walked in the order of the data:
+// the segments outside the region are summed up and skipped at once before
+// the next segment inside it, the rows after the region are not read at all.
+template <class Config>
+template <class Sink>
+void DeltaDecoder<Config>::decompressRegion(const Context * dc, CompressedData compressedData, Sink & sink, uint16_t imageWidth, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+	resetDecompression();
+	if (!width || !height) return;
+
+	uint8_t side = squares.side(dc);
+
+	// Linear layout: the rows of the region follow each other in the output
+	if (side == 1)
+	{
+		skipDataFrames(dc, compressedData, (uint32_t)y * imageWidth + x);
+		for (uint16_t row = 0; row < height; row++)
+		{
+			if (row) skipDataFrames(dc, compressedData, imageWidth - width);
+			outputFrames(dc, compressedData, sink, width);
+		}
+		return;
+	}
+
+	// Squares: each row of a square is a separate segment of the output
+	uint16_t squareSize = (uint16_t)side * side;
+	uint16_t squaresPerWidth = imageWidth / side;
+	uint16_t firstSquare = x / side;
+	uint16_t lastSquare = (x + width - 1) / side;
+	uint16_t lastBand = (y + height - 1) / side;
+	uint32_t framesToSkip = (uint32_t)(y / side) * squaresPerWidth * squareSize;
+
+	for (uint16_t band = y / side; band <= lastBand; band++)
+	{
+		framesToSkip += (uint32_t)firstSquare * squareSize;
+		for (uint16_t square = firstSquare; square <= lastSquare; square++)
+		{
+			uint16_t left = square * side;
+			uint16_t from = (left > x) ? left : x;
+			uint16_t to = ((left + side) < (x + width)) ? (left + side) : (x + width);
+
+			for (uint8_t row = 0; row < side; row++)
+			{
+				uint16_t imageRow = band * side + row;
+				if ((imageRow < y) || (imageRow >= (y + height)))
+				{
+					framesToSkip += side;
+					continue;
+				}
+
+				skipDataFrames(dc, compressedData, framesToSkip + (from - left));
+				sink.moveTo((Position)(imageRow - y) * width + (from - x));
+				outputFrames(dc, compressedData, sink, to - from);
+				framesToSkip = left + side - to;
+			}
+		}
+		framesToSkip += (uint32_t)(squaresPerWidth - 1 - lastSquare) * squareSize;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Read the block header: length, methods and base values for every channel
+template <class Config>
+void DeltaDecoder<Config>::readBlockHeader(const Context * dc, CompressedData compressedData)
+{
+	currentBlockFramesCount = readNextBits(compressedData, dc->blockSizeBits);
+	currentBlockFramesCount++; // 0 value doesn't make any sense to us, so let's get rid of it to save bits.
+
+	uint8_t plan = DECOMPRESSION_PLAN_CONSTANT;
+
+	for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+	{
+		currentBlockMethods[c] = readNextBits(compressedData, dc->bitsPerMethodDeclaration[c]);
+		bool afw = false;
+
+		if (currentBlockMethods[c] != dc->bitsPerChannels[c])
+		{
+			currentBaseValues[c] = readNextBits(compressedData, dc->bitsPerChannels[c]);
+
+			if ((Config::deltaOption == DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST) || (Config::deltaOption == DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_FIRST))
+			{
+				// Methods above the channel width declare the second window type
+				bool secondWindow = (currentBlockMethods[c] > dc->bitsPerChannels[c]);
+				if (secondWindow) currentBlockMethods[c] -= dc->bitsPerChannels[c];
+				afw = (secondWindow == (Config::deltaOption == DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST));
+			}
+			else
+			{
+				afw = (Config::deltaOption == DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_ONLY);
+			}
+		}
+		else
+		{
+			currentBaseValues[c] = 0;
+		}
+
+		if (Config::deltaOption != DECOMPRESSION_OPTION_FIXED_WINDOW_ONLY) currentBlockAFW[c] = afw;
+
+		// Channels with zero method are constant and don't affect the plan
+		if (currentBlockMethods[c])
+		{
+			if (afw) plan = DECOMPRESSION_PLAN_ADAPTIVE;
+			else if (plan == DECOMPRESSION_PLAN_CONSTANT) plan = DECOMPRESSION_PLAN_FIXED;
+		}
+	}
+
+	currentBlockFirstFrame = true;
+	currentBlockPlan = plan;
+}
+
+// Select the specialized loop for the block plan
+template <class Config>
+template <class Sink>
+inline void DeltaDecoder<Config>::decompressRun(const Context * dc, CompressedData compressedData, Sink & sink, FramesCounter framesCount)
+{
+	switch (currentBlockPlan)
+	{
+		case DECOMPRESSION_PLAN_CONSTANT:
+			decompressPlannedFrames<DECOMPRESSION_PLAN_CONSTANT>(dc, compressedData, sink, framesCount);
+			break;
+
+		case DECOMPRESSION_PLAN_FIXED:
+			decompressPlannedFrames<DECOMPRESSION_PLAN_FIXED>(dc, compressedData, sink, framesCount);
+			break;
+
+		case DECOMPRESSION_PLAN_ADAPTIVE:
+			if (Config::deltaOption != DECOMPRESSION_OPTION_FIXED_WINDOW_ONLY) decompressPlannedFrames<DECOMPRESSION_PLAN_ADAPTIVE>(dc, compressedData, sink, framesCount);
+			break;
+	}
+}
+
+// Decompress the run of frames of the current block by the loop specialized
+// for the block plan and the sink: no per-frame decisions are left inside.
+template <class Config>
+template <uint8_t plan, class Sink>
+inline void DeltaDecoder<Config>::decompressPlannedFrames(const Context * dc, CompressedData compressedData, Sink & sink, FramesCounter framesCount)
+{
+	Frame frame = 0;
+
+	if (plan == DECOMPRESSION_PLAN_CONSTANT)
+	{
+		// The same frame for the whole block, so the run is written at once
+		for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+		{
+			frame <<= dc->bitsPerChannels[c];
+			frame |= currentBaseValues[c];
+		}
+
+		sink.writeRun(frame, framesCount);
+		return;
+	}
+
+	if ((plan == DECOMPRESSION_PLAN_ADAPTIVE) && currentBlockFirstFrame)
+	{
+		// The first frame of the block: adaptive channels return their base values
+		for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+		{
+			ChannelValue decompressedValue = currentBaseValues[c];
+			if (!currentBlockAFW[c]) decompressedValue += readNextBits(compressedData, currentBlockMethods[c]);
+			frame <<= dc->bitsPerChannels[c];
+			frame |= decompressedValue;
+		}
+
+		sink.writeFrame(frame);
+		currentBlockFirstFrame = false;
+		framesCount--;
+	}
+
+	while (framesCount > 0)
+	{
+		frame = 0;
+		for (uint8_t c = 0; c < dc->numberOfChannels; c++)
+		{
+			ChannelValue decompressedValue = currentBaseValues[c];
+
+			if ((plan == DECOMPRESSION_PLAN_ADAPTIVE) && currentBlockAFW[c])
+			{
+				ChannelValue windowWidth = (ChannelValue)1 << currentBlockMethods[c];
+				ChannelValue halfWindowWidth = windowWidth >> 1;
+				ChannelValue maxWindowStart = ((ChannelValue)~(ChannelValue)0 >> (sizeof(ChannelValue) * 8 - dc->bitsPerChannels[c])) - windowWidth + 1;
+
+				if (halfWindowWidth < decompressedValue) {
+					decompressedValue -= halfWindowWidth;
+					if (decompressedValue > maxWindowStart) decompressedValue = maxWindowStart;
+				} 
+				else
+				{
+					decompressedValue = 0;
+				}
+				decompressedValue += readNextBits(compressedData, currentBlockMethods[c]);
+				currentBaseValues[c] = decompressedValue;
+			}
+			else
+			{
+				// Constant channels read zero bits here
+				decompressedValue += readNextBits(compressedData, currentBlockMethods[c]);
+			}
+
+			frame <<= dc->bitsPerChannels[c];
+			frame |= decompressedValue;
+		}
+
+		sink.writeFrame(frame);
+		framesCount--;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Read compressed data (two options for near and far memory).
+// The stream is MSB-first, so each refill appends one big-endian word of half
+// the bits buffer width instead of looping over single bytes. The last refill may fetch
+// up to sizeof(Word) - 1 bytes beyond the end of the compressed data, so the data must be
+// followed by DECOMPRESSION_DATA_PADDING zero bytes (they are never used).
+template <class Config>
+inline uint32_t DeltaDecoder<Config>::getBytePosition(const uint8_t * compressedData)
+{
+	return (inputByteIndex);
+}
+
+template <class Config>
+inline void DeltaDecoder<Config>::setBytePosition(const uint8_t * compressedData, uint32_t byteOffset)
+{
+	inputByteIndex = byteOffset;
+}
+
+template <class Config>
+inline void DeltaDecoder<Config>::refillBits(const uint8_t * compressedData)
+{
+	inputBitsBuffer <<= (sizeof(Word) * 8);
+	inputBitsBuffer |= DeltaDecoderWord<BitsBuffer>::read(compressedData + inputByteIndex);
+	inputBitsCount += sizeof(Word) * 8;
+	inputByteIndex += sizeof(Word);
+}
+
+#if defined(AVR)
+
+template <class Config>
+inline uint32_t DeltaDecoder<Config>::getBytePosition(uint_farptr_t * compressedData)
+{
+	return ((uint32_t)inputChunkIndex * Config::chunkSize + inputByteIndex);
+}
+
+template <class Config>
+inline void DeltaDecoder<Config>::setBytePosition(uint_farptr_t * compressedData, uint32_t byteOffset)
+{
+	inputChunkIndex = byteOffset / Config::chunkSize;
+	inputByteIndex = byteOffset % Config::chunkSize;
+}
+
+template <class Config>
+inline void DeltaDecoder<Config>::refillBits(uint_farptr_t * compressedData)
+{
+	// Chunk size is a multiple of the word size,
+	// so the word never straddles two chunks.
+	inputBitsBuffer <<= (sizeof(Word) * 8);
+	inputBitsBuffer |= DeltaDecoderWord<BitsBuffer>::readFar(compressedData[inputChunkIndex] + inputByteIndex); // Read far word
+	inputBitsCount += sizeof(Word) * 8;
+	inputByteIndex += sizeof(Word);
+
+	// Check if next address is outside the chunk
+	if (inputByteIndex >= Config::chunkSize) {
+		inputChunkIndex++;
+		inputByteIndex = 0;
+	}
+}
+
+#endif
+
+// Move the read position to the bit (keeping word reads aligned)
+template <class Config>
+void DeltaDecoder<Config>::setBitPosition(CompressedData compressedData, uint32_t bitOffset)
+{
+	uint32_t byteOffset = (bitOffset >> 3) & ~(uint32_t)(sizeof(Word) - 1);
+	setBytePosition(compressedData, byteOffset);
+	inputBitsBuffer = 0;
+	inputBitsCount = 0;
+
+	uint8_t bitsToSkip = bitOffset - (byteOffset << 3);
+	peekNextBits(compressedData, bitsToSkip);
+	skipBits(bitsToSkip);
+}
+
+// Skip any number of bits: within the bits buffer or by a new read position
+template <class Config>
+inline void DeltaDecoder<Config>::advanceBits(CompressedData compressedData, uint32_t bitsCount)
+{
+	if (bitsCount <= inputBitsCount) skipBits(bitsCount);
+	else setBitPosition(compressedData, (getBytePosition(compressedData) << 3) - inputBitsCount + bitsCount);
+}
+
+template <class Config>
+inline typename DeltaDecoder<Config>::ReadBits DeltaDecoder<Config>::peekNextBits(CompressedData compressedData, uint8_t bitsCount)
+{
+	if (sizeof(Word) >= sizeof(ReadBits))
+	{
+		// The buffer holds fewer bits than requested, so one word is always enough
+		if (inputBitsCount < bitsCount) refillBits(compressedData);
+	}
+	else
+	{
+		while (inputBitsCount < bitsCount) refillBits(compressedData);
+	}
+
+	if (sizeof(ReadBits) < sizeof(BitsBuffer))
+	{
+		// The buffer-wide mask works for zero bits as well, so there's no need for a separate check
+		return ((inputBitsBuffer >> (inputBitsCount - bitsCount)) & (((BitsBuffer)1 << bitsCount) - 1));
+	}
+
+	if (!bitsCount) return (0);
+	return ((inputBitsBuffer >> (inputBitsCount - bitsCount)) & ((BitsBuffer)~(BitsBuffer)0 >> (sizeof(BitsBuffer) * 8 - bitsCount)));
+}
+
+template <class Config>
+inline typename DeltaDecoder<Config>::ReadBits DeltaDecoder<Config>::readNextBits(CompressedData compressedData, uint8_t bitsCount)
+{
+	ReadBits bits = peekNextBits(compressedData, bitsCount);
+	skipBits(bitsCount);
+	return (bits);
+}
+
+// Consume bits that were already peeked
+template <class Config>
+inline void DeltaDecoder<Config>::skipBits(uint8_t bitsCount)
+{
+	inputBitsCount -= bitsCount;
+}
+
+#endif // end _DELTA_DECODER_
+
+// END-OF-FILE
@@ -67,14 +67,15 @@ static const uint8_t * icons[25] = { accessData,
                                      warningData,
                                      wifiData };
 
-// Color gradients for smoothing edges
-static const uint16_t colors[7][3] = { { 0x5000, 0xA800, 0xF800 },    // Red
-                                       { 0x02A0, 0x0540, 0x07E0 },    // Green
-                                       { 0x000A, 0x0015, 0x001F },    // Blue
-                                       { 0x52A0, 0xAD40, 0xFFE0 },    // Yellow
-                                       { 0x02AA, 0x0555, 0x7FFF },    // Cyan
-                                       { 0x500A, 0xA815, 0xF81F },    // Magenta
-                                       { 0x52AA, 0xAD55, 0xFFFF } };  // White
+// Color gradients for smoothing edges: palettes of the icon frames
+// (the frame value is the color index, 0 - background)
+static const uint16_t colors[7][4] PROGMEM = { { 0x0000, 0x5000, 0xA800, 0xF800 },    // Red
+                                       { 0x0000, 0x02A0, 0x0540, 0x07E0 },    // Green
+                                       { 0x0000, 0x000A, 0x0015, 0x001F },    // Blue
+                                       { 0x0000, 0x52A0, 0xAD40, 0xFFE0 },    // Yellow
+                                       { 0x0000, 0x02AA, 0x0555, 0x7FFF },    // Cyan
+                                       { 0x0000, 0x500A, 0xA815, 0xF81F },    // Magenta
+                                       { 0x0000, 0x52AA, 0xAD55, 0xFFFF } };  // White
 
 
 uint8_t currentColor;
@@ -112,8 +113,9 @@ void loop() {
     // Draw single icon
     for (uint8_t j = 0; j < BUFFERS_PER_ICON; j++)
     {
-      // Decompress one buffer
-      decomp.decompressNextFrames(&iconsDC, currentIcon, decompressedData, FRAMES_PER_BUFFER, true);
+      // Decompress one buffer colorized by the current palette (it's in the program memory)
+      DecompressionPaletteSink<true> sink(decompressedData, colors[currentColor]);
+      decomp.decompressNextFrames(&iconsDC, currentIcon, sink, FRAMES_PER_BUFFER);
       // And display it
       ST7789.writePixels(decompressedData, FRAMES_PER_BUFFER, LITTLE_ENDIAN);
     }
@@ -130,10 +132,4 @@ void loop() {
   }
 }
 
-// Delegate method for coloring a pixel in the current color
-uint16_t colorizePixel(uint16_t frame) {
-  uint16_t pixelColor = (frame == 0) ? 0 : colors[currentColor][frame - 1];
-  return (pixelColor);
-}
-
 // END-OF-FILE
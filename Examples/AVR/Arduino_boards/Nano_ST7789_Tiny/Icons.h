@@ -65,103 +65,103 @@ static const DecompressionContext iconsDC = {
 
 static const uint8_t accessData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC2, 0x10, 0x1E, 0xB5, 0xFA, 0x24, 0xCB, 0xAB, 0xD7, 0xC3, 0xB9, 0x00, 0xA7, 0xA3, 0x31, 0xAB, 0xC3, 0x6C, 0x00, 0x4B, 0x03, 0x0E, 0x8E, 0x90, 0x01, 0x2E, 0x0C, 0x3A, 0x39, 0xC0, 0x05, 0x2F, 0xCC, 0x3B, 0x4D, 0x80, 0x00, 0x9E, 0x31, 0xC1, 0xC3, 0x09, 0x9A, 0x80, 0x0D, 0x10, 0x18, 0xE0, 0xF9, 0x85, 0x46, 0x80, 0x05, 0x3B, 0x01, 0x8E, 0x10, 0x18, 0x53, 0xA7, 0x80, 0x4C, 0xA0, 0x31, 0xC2, 0x03, 0x09, 0x91, 0xE1, 0x19, 0x8E, 0x01, 0x36, 0x80, 0xCF, 0x08, 0xCC, 0xE8, 0x20, 0x00, 0x83, 0xE7, 0x0C, 0xF0, 0x09, 0x94, 0x26, 0x8D, 0x78, 0x40, 0x01, 0x07, 0xCA, 0x98, 0x4C, 0x8F, 0x00, 
-	0xA7, 0x65, 0x34, 0x6B, 0xC2, 0x00, 0x08, 0x3E, 0x44, 0xC2, 0x9D, 0x40, 0x02, 0xB2, 0xA0, 0xCD, 0xAF, 0x08, 0x00, 0x25, 0x13, 0x06, 0x25, 0x00, 0x26, 0xD4, 0x98, 0xB5, 0xE3, 0x26, 0x60, 0x13, 0x00, 0x15, 0x8F, 0xE6, 0x15, 0x8B, 0x80, 0x1D, 0x65, 0xC1, 0x82, 0x52, 0x00, 0x75, 0x96, 0x06, 0x09, 0x58, 0x03, 0x4E, 0x1F, 0x46, 0x61, 0x56, 0xF2, 0x05, 0xD6, 0x1E, 0xBF, 0x44, 0x98, 0xF5, 0x7A, 0xF7, 0xE1, 0xF8, 0x7E, 0x10, 0x80};
+	0xA7, 0x65, 0x34, 0x6B, 0xC2, 0x00, 0x08, 0x3E, 0x44, 0xC2, 0x9D, 0x40, 0x02, 0xB2, 0xA0, 0xCD, 0xAF, 0x08, 0x00, 0x25, 0x13, 0x06, 0x25, 0x00, 0x26, 0xD4, 0x98, 0xB5, 0xE3, 0x26, 0x60, 0x13, 0x00, 0x15, 0x8F, 0xE6, 0x15, 0x8B, 0x80, 0x1D, 0x65, 0xC1, 0x82, 0x52, 0x00, 0x75, 0x96, 0x06, 0x09, 0x58, 0x03, 0x4E, 0x1F, 0x46, 0x61, 0x56, 0xF2, 0x05, 0xD6, 0x1E, 0xBF, 0x44, 0x98, 0xF5, 0x7A, 0xF7, 0xE1, 0xF8, 0x7E, 0x10, 0x80, 0x00, 0x00, 0x00};
 
 static const uint8_t bluetoothData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC2, 0x30, 0x0C, 0xC3, 0x93, 0x7F, 0x05, 0xC0, 0x73, 0x0E, 0x4D, 0xFC, 0x13, 0x02, 0xCC, 0x39, 0x37, 0xA0, 0x1E, 0xA7, 0xC1, 0x30, 0x0F, 0x30, 0xE4, 0xDC, 0xC2, 0xFA, 0xDF, 0xFF, 0x7C, 0x10, 0x00, 0x03, 0xFF, 0xFD, 0xC7, 0xFF, 0xFD, 0x37, 0x00, 0xC6, 0x43, 0xDF, 0xFF, 0x7C, 0x10, 0x03, 0xFF, 0xFC, 0x01, 0xC7, 0xFF, 0xFD, 0x32, 0xC0, 0x46, 0xDC, 0x00, 0xFC, 0x87, 0xBF, 0xFE, 0xF8, 0x27, 0xFF, 0xF8, 0x0A, 0x49, 0x82, 0x25, 0x01, 0x53, 0x97, 0xFC, 0x70, 0x81, 0x92, 0x1E, 0xFF, 0xFA, 0x49, 0x99, 0x3F, 0xFF, 0xFE, 0xA7, 0x81, 0x52, 0x1F, 0xFB, 0xD2, 0x00, 0xB2, 0x1E, 0xA6, 0x65, 
 	0xA6, 0x00, 0x29, 0x7B, 0xC0, 0x00, 0x1F, 0x7D, 0xF4, 0x00, 0xB2, 0x1E, 0x96, 0x65, 0xA6, 0x00, 0x10, 0x63, 0x80, 0xEC, 0xBF, 0x50, 0x02, 0x25, 0x9C, 0xD3, 0xE0, 0x80, 0x06, 0x1F, 0xFF, 0xE0, 0x00, 0x17, 0x7F, 0xF3, 0x00, 0x22, 0x99, 0xC5, 0x3E, 0x08, 0x00, 0x61, 0xDA, 0x00, 0x01, 0x7F, 0xDD, 0x10, 0x02, 0x24, 0x9A, 0xF3, 0xFF, 0xFF, 0xEF, 0xFF, 0xBE, 0x09, 0xE0, 0x3C, 0xFF, 0xEE, 0xF8, 0x02, 0x24, 0x9B, 0xF2, 0x81, 0xFF, 0xFE, 0x21, 0xEF, 0xFF, 0xBE, 0x09, 0x20, 0x0A, 0xC2, 0x98, 0x28, 0xB6, 0x00, 0x89, 0x26, 0x42, 0x60, 0x07, 0x31, 0x00, 0x11, 0x24, 0xCB, 0x44, 0x00, 0x1A, 0xC3, 0xF5, 0xB0, 
-	0x32, 0x7B, 0xFF, 0xFD, 0x4A, 0x01, 0xCC, 0x24, 0x64, 0x98, 0x25, 0x88, 0x0F, 0x41, 0xF2, 0x9C, 0x08, 0x18, 0x25, 0xF8, 0x18, 0x06, 0x18, 0x25, 0xF8, 0x20, 0x04, 0x18, 0x25, 0xF8, 0x28, 0x02, 0x18, 0x25, 0xF8, 0x7E, 0x1F, 0x86, 0x80};
+	0x32, 0x7B, 0xFF, 0xFD, 0x4A, 0x01, 0xCC, 0x24, 0x64, 0x98, 0x25, 0x88, 0x0F, 0x41, 0xF2, 0x9C, 0x08, 0x18, 0x25, 0xF8, 0x18, 0x06, 0x18, 0x25, 0xF8, 0x20, 0x04, 0x18, 0x25, 0xF8, 0x28, 0x02, 0x18, 0x25, 0xF8, 0x7E, 0x1F, 0x86, 0x80, 0x00, 0x00, 0x00};
 
 static const uint8_t bugData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xF8, 0x07, 0xA9, 0xF0, 0x53, 0x01, 0xE5, 0xBC, 0x2E, 0x00, 0xEA, 0xDF, 0xFF, 0x7C, 0x12, 0xC0, 0xC9, 0x7F, 0xFF, 0xED, 0xE0, 0x05, 0x90, 0xF5, 0xB6, 0xFD, 0xFF, 0xBF, 0xF0, 0x47, 0xD0, 0x04, 0x5B, 0x31, 0x67, 0xC1, 0xE0, 0x01, 0x9E, 0x23, 0x0A, 0x7E, 0xB0, 0xFC, 0xDF, 0x0F, 0xCE, 0x70, 0x3C, 0xCF, 0x03, 0xCE, 0xF0, 0x3C, 0xCF, 0x03, 0xCE, 0x70, 0xFC, 0xDF, 0x0F, 0xCE, 0x70, 0x3C, 0xCF, 0x03, 0xCE, 0xF0, 0x3C, 0xCF, 0x03, 0xCE, 0x70, 0xFC, 0xDF, 0x0F, 0xCE, 0xB0, 0x0A, 0xF6, 0x33, 0x00, 0x78, 0x01, 0x64, 0x3D, 0x6C, 0xC1, 0x1F, 0xC0, 0xA8, 0x0B, 0x0F, 0x62, 0x4C, 
-	0x3A, 0x7B, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0x14, 0x00};
+	0x3A, 0x7B, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0x14, 0x00, 0x00, 0x00, 0x00};
 
 static const uint8_t buildData[] PROGMEM = {
 	0xFC, 0x32, 0x05, 0xE4, 0x7E, 0xBE, 0xBE, 0xBD, 0x3C, 0x2F, 0xC0, 0x80, 0x0E, 0x72, 0x4C, 0xC3, 0x93, 0xBF, 0x01, 0xC0, 0x3A, 0xC9, 0x33, 0x0E, 0x8D, 0xC8, 0x01, 0x49, 0x20, 0x0E, 0xB2, 0x4C, 0xC2, 0x82, 0xB0, 0x07, 0x9E, 0xD3, 0x53, 0x00, 0xEB, 0x24, 0x0C, 0x28, 0xDA, 0xC0, 0x73, 0x0E, 0x4D, 0x40, 0x01, 0x14, 0x4C, 0x26, 0x75, 0x81, 0x66, 0x14, 0x99, 0x69, 0x00, 0x6C, 0x1D, 0x60, 0x13, 0x63, 0x0C, 0x69, 0x34, 0x56, 0xCC, 0x02, 0xAC, 0x02, 0xAD, 0xB4, 0xC2, 0xAD, 0xB0, 0x02, 0xA1, 0xB0, 0xC5, 0xAF, 0x0A, 0xC0, 0x0E, 0xB2, 0xB0, 0xC5, 0xAF, 0x0A, 0xC0, 0x0E, 0xB2, 0xB0, 0xC5, 0xAF, 0x0A, 0xC0, 
-	0x5E, 0x60, 0xF6, 0xFB, 0xFF, 0xFE, 0xF9, 0x60, 0xC5, 0xAF, 0x0B, 0xF0, 0x12, 0x1C, 0x58, 0x31, 0x6B, 0xC2, 0xFC, 0x04, 0x87, 0x16, 0x0C, 0x5A, 0xF0, 0xBF, 0x01, 0x21, 0xC5, 0x83, 0x16, 0xBC, 0x2F, 0xC0, 0x48, 0x71, 0x60, 0xC5, 0xAF, 0x0B, 0xF0, 0x12, 0x1C, 0x58, 0x31, 0x6B, 0xC2, 0xFC, 0x04, 0x87, 0x16, 0x0C, 0x26, 0x7F, 0x80, 0x60, 0x1C, 0xE2, 0xA1, 0x82, 0x3F, 0x81, 0x00, 0x1C, 0xE2, 0x61, 0x82, 0x5F, 0x82, 0x00, 0x54, 0xE3, 0xF7, 0xCF, 0xE1, 0x60, 0x00};
+	0x5E, 0x60, 0xF6, 0xFB, 0xFF, 0xFE, 0xF9, 0x60, 0xC5, 0xAF, 0x0B, 0xF0, 0x12, 0x1C, 0x58, 0x31, 0x6B, 0xC2, 0xFC, 0x04, 0x87, 0x16, 0x0C, 0x5A, 0xF0, 0xBF, 0x01, 0x21, 0xC5, 0x83, 0x16, 0xBC, 0x2F, 0xC0, 0x48, 0x71, 0x60, 0xC5, 0xAF, 0x0B, 0xF0, 0x12, 0x1C, 0x58, 0x31, 0x6B, 0xC2, 0xFC, 0x04, 0x87, 0x16, 0x0C, 0x26, 0x7F, 0x80, 0x60, 0x1C, 0xE2, 0xA1, 0x82, 0x3F, 0x81, 0x00, 0x1C, 0xE2, 0x61, 0x82, 0x5F, 0x82, 0x00, 0x54, 0xE3, 0xF7, 0xCF, 0xE1, 0x60, 0x00, 0x00, 0x00, 0x00};
 
 static const uint8_t cableData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xE8, 0x02, 0x5A, 0x49, 0x8D, 0x4F, 0x84, 0x80, 0x03, 0x39, 0x46, 0x14, 0xFC, 0xC0, 0xC3, 0x1F, 0xFF, 0xFE, 0xC2, 0x82, 0x30, 0x0F, 0x38, 0xC1, 0xF9, 0xEF, 0xFF, 0xF1, 0x00, 0x43, 0xCF, 0xFF, 0x78, 0x70, 0x5C, 0xDF, 0x01, 0xCC, 0xF4, 0x80, 0x04, 0x1C, 0xC7, 0x05, 0xCD, 0xF0, 0x1C, 0xCF, 0x01, 0xCC, 0x70, 0x5C, 0xDF, 0x01, 0xCC, 0xF0, 0x1C, 0xC7, 0x05, 0xCD, 0xF0, 0x1C, 0xCF, 0x01, 0xCC, 0x70, 0x0A, 0xF5, 0x33, 0x00, 0x5F, 0x01, 0xCC, 0xF0, 0x1C, 0xCF, 0x01, 0xCE, 0x70, 0x1C, 0xCF, 0x01, 0xCC, 0xF0, 0x1C, 0xE7, 0x01, 0xCC, 0xF0, 0x1C, 0xCF, 0x01, 0xCE, 0x70, 0x1C, 
-	0xCF, 0x01, 0xCC, 0xF0, 0x1C, 0xDF, 0x00, 0x67, 0x48, 0xC2, 0x9F, 0x1C, 0x07, 0x33, 0xC0, 0x73, 0x7C, 0x17, 0x31, 0xC0, 0x73, 0x3C, 0x07, 0x37, 0xC1, 0x73, 0x1C, 0x07, 0x33, 0xC0, 0x73, 0x7C, 0x17, 0x31, 0xC0, 0x73, 0x3D, 0x08, 0x00, 0x47, 0x37, 0xC1, 0x73, 0x1C, 0x1F, 0xAD, 0xFF, 0xF3, 0xC1, 0x00, 0x4F, 0xFF, 0xFB, 0x63, 0x03, 0xCC, 0xC0, 0x16, 0x83, 0xE4, 0xCC, 0x12, 0x98, 0x02, 0xBD, 0x2C, 0xC0, 0x14, 0x00, 0x6A, 0x0F, 0x62, 0x4C, 0x25, 0xBF, 0x87, 0xE1, 0xF8, 0x7E, 0x1D, 0x00};
+	0xCF, 0x01, 0xCC, 0xF0, 0x1C, 0xDF, 0x00, 0x67, 0x48, 0xC2, 0x9F, 0x1C, 0x07, 0x33, 0xC0, 0x73, 0x7C, 0x17, 0x31, 0xC0, 0x73, 0x3C, 0x07, 0x37, 0xC1, 0x73, 0x1C, 0x07, 0x33, 0xC0, 0x73, 0x7C, 0x17, 0x31, 0xC0, 0x73, 0x3D, 0x08, 0x00, 0x47, 0x37, 0xC1, 0x73, 0x1C, 0x1F, 0xAD, 0xFF, 0xF3, 0xC1, 0x00, 0x4F, 0xFF, 0xFB, 0x63, 0x03, 0xCC, 0xC0, 0x16, 0x83, 0xE4, 0xCC, 0x12, 0x98, 0x02, 0xBD, 0x2C, 0xC0, 0x14, 0x00, 0x6A, 0x0F, 0x62, 0x4C, 0x25, 0xBF, 0x87, 0xE1, 0xF8, 0x7E, 0x1D, 0x00, 0x00, 0x00, 0x00};
 
 static const uint8_t checkData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xB8, 0x01, 0x6B, 0xB3, 0x16, 0xBC, 0x36, 0x00, 0x02, 0xFC, 0xC6, 0x6F, 0x6B, 0x87, 0xE6, 0x39, 0xAE, 0x1C, 0x98, 0x24, 0x59, 0xAE, 0x1A, 0x19, 0x55, 0x00, 0x0E, 0x23, 0x9A, 0xE1, 0x81, 0x82, 0x44, 0x80, 0x22, 0x41, 0xAE, 0x16, 0x18, 0x24, 0x48, 0x02, 0x26, 0x1A, 0xE0, 0x69, 0x82, 0x4C, 0x18, 0x24, 0x48, 0x02, 0x28, 0x1A, 0xE0, 0x41, 0x95, 0x30, 0x01, 0x64, 0x81, 0x82, 0x44, 0x80, 0x22, 0xA1, 0xAE, 0x03, 0x99, 0xD2, 0x68, 0x00, 0x05, 0x85, 0xB3, 0xFE, 0x12, 0x00, 0x8B, 0x06, 0xB8, 0x16, 0x69, 0x49, 0xA0, 0x00, 0x16, 0x5D, 0x12, 0x00, 0x8B, 0x86, 0xB8, 0x1E, 0x61, 
-	0xC9, 0xA8, 0x00, 0x23, 0x01, 0xAE, 0x09, 0x98, 0x52, 0x65, 0xA4, 0x01, 0xC8, 0x6B, 0x82, 0xE6, 0x34, 0x9A, 0x2D, 0x06, 0xB8, 0x7E, 0x63, 0x9A, 0xE1, 0xF9, 0x8E, 0x6B, 0x80, 0x4D, 0xBF, 0x30, 0xCC, 0x02, 0x60, 0x05, 0xB0, 0xFB, 0xB3, 0x05, 0x9F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0B, 0x80};
+	0xC9, 0xA8, 0x00, 0x23, 0x01, 0xAE, 0x09, 0x98, 0x52, 0x65, 0xA4, 0x01, 0xC8, 0x6B, 0x82, 0xE6, 0x34, 0x9A, 0x2D, 0x06, 0xB8, 0x7E, 0x63, 0x9A, 0xE1, 0xF9, 0x8E, 0x6B, 0x80, 0x4D, 0xBF, 0x30, 0xCC, 0x02, 0x60, 0x05, 0xB0, 0xFB, 0xB3, 0x05, 0x9F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0B, 0x80, 0x00, 0x00, 0x00};
 
 static const uint8_t cloudData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x08, 0x80, 0x69, 0x1F, 0xA2, 0x4C, 0xAA, 0xBD, 0x3C, 0x2F, 0x40, 0x15, 0x60, 0x30, 0xE4, 0xED, 0x00, 0x12, 0xA0, 0xC3, 0xA3, 0xAC, 0x00, 0x52, 0xC0, 0xC2, 0x93, 0x88, 0x03, 0xAD, 0xB6, 0x30, 0xA7, 0xDA, 0x00, 0x46, 0xF3, 0x1A, 0xA1, 0xC4, 0xB3, 0x0A, 0x49, 0x40, 0x00, 0x6F, 0x33, 0x6A, 0x00, 0x00, 0x1D, 0x24, 0xD5, 0xAF, 0x9F, 0x0D, 0x00, 0x00, 0x22, 0xD3, 0x04, 0x89, 0x00, 0x45, 0x83, 0x2A, 0x8E, 0x00, 0x79, 0x93, 0x16, 0x92, 0xC2, 0xD9, 0xFF, 0x09, 0x00, 0x46, 0x03, 0x0E, 0x4C, 0x60, 0xD1, 0xAD, 0x00, 0x00, 0xB2, 0xE8, 0x90, 0x04, 0x65, 0x30, 0xA7, 
-	0x9B, 0x30, 0xE4, 0xD4, 0x00, 0x11, 0xB0, 0xC2, 0xAD, 0x70, 0xC2, 0x93, 0x2D, 0x20, 0x0F, 0x03, 0x0E, 0x32, 0x7C, 0xC6, 0x93, 0x45, 0xC4, 0xC9, 0xAD, 0x00, 0xF7, 0xF3, 0x54, 0xCA, 0x44, 0x08, 0x15, 0xEF, 0xE6, 0x69, 0x82, 0x48, 0x00, 0xF5, 0x87, 0xB7, 0xA6, 0x1D, 0x3B, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x04, 0x80};
+	0x9B, 0x30, 0xE4, 0xD4, 0x00, 0x11, 0xB0, 0xC2, 0xAD, 0x70, 0xC2, 0x93, 0x2D, 0x20, 0x0F, 0x03, 0x0E, 0x32, 0x7C, 0xC6, 0x93, 0x45, 0xC4, 0xC9, 0xAD, 0x00, 0xF7, 0xF3, 0x54, 0xCA, 0x44, 0x08, 0x15, 0xEF, 0xE6, 0x69, 0x82, 0x48, 0x00, 0xF5, 0x87, 0xB7, 0xA6, 0x1D, 0x3B, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x04, 0x80, 0x00, 0x00, 0x00};
 
 static const uint8_t editData[] PROGMEM = {
-	0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x22, 0x01, 0x5A, 0xE0, 0xA3, 0xBF, 0x04, 0x80, 0xC3, 0x0E, 0x8E, 0xFC, 0x0B, 0x00, 0xE7, 0x13, 0xCC, 0x3A, 0x3B, 0xF0, 0x3E, 0x03, 0x4D, 0x00, 0x71, 0x38, 0xC0, 0x2F, 0x80, 0x83, 0x2E, 0x4D, 0x00, 0x71, 0x20, 0xFD, 0x04, 0x0C, 0xC9, 0x34, 0x01, 0xC7, 0xF4, 0x18, 0x30, 0xE4, 0xDF, 0x81, 0xD3, 0xF4, 0x1D, 0x3F, 0x41, 0xD3, 0xF4, 0x1D, 0x3F, 0x41, 0xD3, 0xF4, 0x01, 0x65, 0xB3, 0xF4, 0x01, 0x26, 0xCF, 0xE0, 0x05, 0x96, 0x8F, 0xF0, 0x08, 0x18, 0x3F, 0xC0, 0x60, 0x50, 0xFF, 0x02, 0x81, 0x03, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x22, 0x00};
+	0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x22, 0x01, 0x5A, 0xE0, 0xA3, 0xBF, 0x04, 0x80, 0xC3, 0x0E, 0x8E, 0xFC, 0x0B, 0x00, 0xE7, 0x13, 0xCC, 0x3A, 0x3B, 0xF0, 0x3E, 0x03, 0x4D, 0x00, 0x71, 0x38, 0xC0, 0x2F, 0x80, 0x83, 0x2E, 0x4D, 0x00, 0x71, 0x20, 0xFD, 0x04, 0x0C, 0xC9, 0x34, 0x01, 0xC7, 0xF4, 0x18, 0x30, 0xE4, 0xDF, 0x81, 0xD3, 0xF4, 0x1D, 0x3F, 0x41, 0xD3, 0xF4, 0x1D, 0x3F, 0x41, 0xD3, 0xF4, 0x01, 0x65, 0xB3, 0xF4, 0x01, 0x26, 0xCF, 0xE0, 0x05, 0x96, 0x8F, 0xF0, 0x08, 0x18, 0x3F, 0xC0, 0x60, 0x50, 0xFF, 0x02, 0x81, 0x03, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x22, 0x00, 0x00, 0x00, 0x00};
 
 static const uint8_t emojiData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC2, 0x10, 0x1E, 0xB5, 0xFA, 0x24, 0xCB, 0xAB, 0xD7, 0xC3, 0xB9, 0x00, 0xA7, 0xA3, 0x31, 0xAB, 0xC3, 0x6C, 0x00, 0x4B, 0x03, 0x0E, 0x8E, 0x90, 0x01, 0x2E, 0x0C, 0x3A, 0x39, 0xC0, 0x05, 0x2F, 0xCC, 0x3B, 0x4D, 0x80, 0x00, 0xBF, 0x31, 0x9B, 0xDA, 0x80, 0x0D, 0x08, 0x98, 0xE9, 0x82, 0x15, 0x8A, 0x06, 0x3A, 0x60, 0x85, 0x62, 0x79, 0x85, 0x46, 0x80, 0x05, 0x3A, 0x81, 0x96, 0x07, 0x99, 0x60, 0x81, 0x85, 0x3A, 0x78, 0x04, 0xC9, 0x03, 0x2A, 0x4D, 0x00, 0x15, 0x03, 0x2A, 0x4D, 0x00, 0x15, 0x13, 0x09, 0x91, 0xE1, 0xF9, 0x9E, 0x67, 0x87, 0xE6, 0x79, 0x9E, 0x01, 0x32, 0xFC, 0xC9, 0x30, 
-	0x99, 0x1E, 0x01, 0x4E, 0xA0, 0x61, 0x49, 0x42, 0x01, 0x49, 0x20, 0x61, 0x4E, 0xA0, 0x01, 0x59, 0x20, 0x61, 0x47, 0x40, 0x00, 0xB4, 0x89, 0x83, 0x12, 0x80, 0xA3, 0x6F, 0xFF, 0xF8, 0x28, 0xE6, 0x01, 0x66, 0x3F, 0xFF, 0xFC, 0xC0, 0x05, 0x62, 0x99, 0x8F, 0x4F, 0x84, 0x92, 0x01, 0xAA, 0xAC, 0x60, 0xA2, 0xE0, 0x07, 0x59, 0x70, 0x60, 0x94, 0x80, 0x1D, 0x65, 0x81, 0x82, 0x56, 0x00, 0xD3, 0x87, 0xD1, 0x98, 0x55, 0xBC, 0x81, 0x75, 0x87, 0xAF, 0xD1, 0x26, 0x3D, 0x5E, 0xBD, 0xF8, 0x7E, 0x1F, 0x84, 0x20};
+	0x99, 0x1E, 0x01, 0x4E, 0xA0, 0x61, 0x49, 0x42, 0x01, 0x49, 0x20, 0x61, 0x4E, 0xA0, 0x01, 0x59, 0x20, 0x61, 0x47, 0x40, 0x00, 0xB4, 0x89, 0x83, 0x12, 0x80, 0xA3, 0x6F, 0xFF, 0xF8, 0x28, 0xE6, 0x01, 0x66, 0x3F, 0xFF, 0xFC, 0xC0, 0x05, 0x62, 0x99, 0x8F, 0x4F, 0x84, 0x92, 0x01, 0xAA, 0xAC, 0x60, 0xA2, 0xE0, 0x07, 0x59, 0x70, 0x60, 0x94, 0x80, 0x1D, 0x65, 0x81, 0x82, 0x56, 0x00, 0xD3, 0x87, 0xD1, 0x98, 0x55, 0xBC, 0x81, 0x75, 0x87, 0xAF, 0xD1, 0x26, 0x3D, 0x5E, 0xBD, 0xF8, 0x7E, 0x1F, 0x84, 0x20, 0x00, 0x00, 0x00};
 
 static const uint8_t errorData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC2, 0x10, 0x1E, 0xB5, 0xFA, 0x24, 0xCB, 0xAB, 0xD7, 0xC3, 0xB9, 0x00, 0xA7, 0xA3, 0x31, 0xAB, 0xC3, 0x6C, 0x00, 0x4B, 0x03, 0x0E, 0x8E, 0x90, 0x01, 0x2E, 0x0C, 0x3A, 0x39, 0xC0, 0x05, 0x2F, 0xCC, 0x3B, 0x4D, 0x80, 0x00, 0x9E, 0x31, 0xC1, 0xC3, 0x09, 0x9A, 0x80, 0x0D, 0x10, 0x18, 0xE0, 0xF9, 0x85, 0x46, 0x80, 0x05, 0x3B, 0x01, 0x8E, 0x10, 0x18, 0x53, 0xA7, 0x80, 0x4C, 0xA0, 0x31, 0xC2, 0x03, 0x09, 0x91, 0xE1, 0x19, 0x8E, 0x11, 0x99, 0xE1, 0x19, 0x8E, 0x11, 0x99, 0xE0, 0x13, 0x2F, 0xCC, 0x93, 0x09, 0x91, 0xE0, 0x14, 0xEF, 0xE6, 0x49, 0x85, 0x3A, 0x80, 0x05, 0x64, 0xF9, 0x8E, 
-	0x10, 0x18, 0x31, 0x28, 0x01, 0x36, 0x70, 0xC7, 0x07, 0x8C, 0x1A, 0x17, 0x00, 0xAC, 0x7F, 0x30, 0xAC, 0x5C, 0x00, 0xEB, 0x2E, 0x0C, 0x12, 0x90, 0x03, 0xAC, 0xB0, 0x30, 0x4A, 0xC0, 0x1A, 0x70, 0xFA, 0x33, 0x0A, 0xB7, 0x90, 0x2E, 0xB0, 0xF5, 0xFA, 0x24, 0xC7, 0xAB, 0xD7, 0xBF, 0x0F, 0xC3, 0xF0, 0x84, 0x00};
+	0x10, 0x18, 0x31, 0x28, 0x01, 0x36, 0x70, 0xC7, 0x07, 0x8C, 0x1A, 0x17, 0x00, 0xAC, 0x7F, 0x30, 0xAC, 0x5C, 0x00, 0xEB, 0x2E, 0x0C, 0x12, 0x90, 0x03, 0xAC, 0xB0, 0x30, 0x4A, 0xC0, 0x1A, 0x70, 0xFA, 0x33, 0x0A, 0xB7, 0x90, 0x2E, 0xB0, 0xF5, 0xFA, 0x24, 0xC7, 0xAB, 0xD7, 0xBF, 0x0F, 0xC3, 0xF0, 0x84, 0x00, 0x00, 0x00, 0x00};
 
 static const uint8_t handData[] PROGMEM = {
 	0xB8, 0x05, 0x63, 0x82, 0x8E, 0xFC, 0x14, 0x05, 0xAC, 0xFF, 0xFF, 0xC0, 0x00, 0x83, 0xBC, 0x09, 0x6A, 0xFB, 0xC2, 0x0C, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xE3, 0xE0, 0x08, 0x37, 0x63, 0x0C, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF3, 0xE0, 0x08, 0x3A, 0x63, 0x0C, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF3, 0x00, 0x02, 0xC2, 0xB0, 0x08, 0x3A, 0xA3, 0x0C, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF3, 0x08, 0xFF, 0xFB, 0xEB, 0x02, 0x0E, 0x18, 0xC3, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFC, 0xC3, 0x08, 0x3A, 0xC0, 0x83, 0x86, 0x30, 0xCF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x30, 0xC2, 0x0E, 0xB0, 0x20, 0xE1, 0x8C, 0x33, 0xFF, 0xFF, 0x00, 
 	0xFF, 0xFF, 0xCC, 0x30, 0x83, 0xAC, 0x08, 0x38, 0x63, 0x0C, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF3, 0x0C, 0x20, 0xD4, 0x0F, 0xE4, 0xFF, 0xE7, 0xC2, 0x00, 0x00, 0x3F, 0xFF, 0xF3, 0x0C, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF3, 0x00, 0x6C, 0x20, 0xD4, 0x0F, 0xEC, 0xBF, 0xFF, 0xF7, 0xC0, 0x00, 0x3F, 0xFF, 0xF3, 0x0C, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF3, 0x00, 0x6C, 0x20, 0xD7, 0x02, 0xDB, 0x7F, 0xC7, 0x92, 0x00, 0x33, 0x35, 0xC0, 0x29, 0xC2, 0x4C, 0x68, 0xD0, 0x0C, 0xCD, 0x80, 0x0A, 0x84, 0xB3, 0x0D, 0x0B, 0x33, 0x6C, 0x02, 0xAD, 0xFC, 0xC1, 0xB1, 0xB0, 0x0A, 0xCB, 0xF3, 0x70, 0x05, 0x90, 0xFB, 0x93, 0x09, 
-	0x93, 0xE0, 0x14, 0xE7, 0x26, 0x0C, 0xF0, 0x80, 0x54, 0x1B, 0x98, 0x34, 0x4A, 0x01, 0xCE, 0x58, 0x18, 0x25, 0x60, 0x05, 0x79, 0x59, 0x82, 0x96, 0x40, 0x1D, 0x65, 0x01, 0x82, 0x5E, 0x81, 0x54, 0x1E, 0x3F, 0x44, 0x98, 0xD5, 0x7A, 0x4F, 0x00};
+	0x93, 0xE0, 0x14, 0xE7, 0x26, 0x0C, 0xF0, 0x80, 0x54, 0x1B, 0x98, 0x34, 0x4A, 0x01, 0xCE, 0x58, 0x18, 0x25, 0x60, 0x05, 0x79, 0x59, 0x82, 0x96, 0x40, 0x1D, 0x65, 0x01, 0x82, 0x5E, 0x81, 0x54, 0x1E, 0x3F, 0x44, 0x98, 0xD5, 0x7A, 0x4F, 0x00, 0x00, 0x00, 0x00};
 
 static const uint8_t lightbulbData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC2, 0x20, 0x1A, 0x47, 0xE8, 0x93, 0x2A, 0xAF, 0x4F, 0x07, 0xD0, 0x0E, 0x5E, 0x6C, 0xC6, 0xAF, 0x4D, 0xD0, 0x01, 0x1A, 0x0C, 0x39, 0x36, 0xE0, 0x05, 0x5A, 0xCC, 0x5A, 0xF0, 0x69, 0x00, 0x6D, 0xC4, 0xC2, 0x8D, 0x9C, 0x02, 0x65, 0x89, 0x84, 0xCA, 0x70, 0xDC, 0xE7, 0x0D, 0xCE, 0x70, 0x09, 0x96, 0x26, 0x13, 0x29, 0xC0, 0x29, 0xCC, 0x4C, 0x15, 0x69, 0x01, 0x64, 0x3E, 0xAC, 0xC1, 0x5A, 0xF0, 0x0A, 0xC6, 0x83, 0x05, 0x1D, 0x00, 0x39, 0xC2, 0x03, 0x00, 0x7D, 0x07, 0xCF, 0xF0, 0x7C, 0xFF, 0x00, 0xAF, 0x5B, 0x30, 0x07, 0xF0, 0xFC, 0x3F, 0x0F, 0xC0, 0x30, 0x5C, 0xFF, 0x01, 0xC0, 0x2B, 
-	0xD4, 0xCC, 0x01, 0xFC, 0x3F, 0x0F, 0xC2, 0x30};
+	0xD4, 0xCC, 0x01, 0xFC, 0x3F, 0x0F, 0xC2, 0x30, 0x00, 0x00, 0x00};
 
 static const uint8_t memoryData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x03, 0x01, 0xCC, 0x70, 0x1C, 0xFF, 0x01, 0xC0, 0x73, 0x1C, 0x07, 0x3E, 0x80, 0x16, 0xAB, 0x31, 0x6B, 0xC3, 0xA0, 0x01, 0x67, 0x23, 0x09, 0x9C, 0xE0, 0x39, 0xCE, 0x03, 0x9C, 0xE0, 0x39, 0xCE, 0x03, 0x9B, 0xE0, 0x79, 0x8E, 0x0B, 0x98, 0xE0, 0x79, 0xAE, 0x07, 0x98, 0xE0, 0xB9, 0x8E, 0x07, 0x9B, 0xE0, 0x39, 0x8E, 0x03, 0x98, 0xE0, 0x39, 0x8E, 0x03, 0x9C, 0xE0, 0x39, 0x8E, 0x03, 0x98, 0xE0, 0x39, 0x8E, 0x03, 0x9B, 0xE0, 0x79, 0x8E, 0x0B, 0x98, 0xE0, 0x79, 0xAE, 0x07, 0x98, 0xE0, 0xB9, 0x8E, 0x07, 0x9B, 0xE0, 0x39, 0xCE, 0x03, 0x9C, 0xE0, 0x39, 0xCE, 0x03, 0x9C, 
-	0xE0, 0x13, 0x6C, 0xCC, 0x1A, 0x27, 0x01, 0x6C, 0x3E, 0xAC, 0xC1, 0x67, 0xA0, 0x1C, 0xC7, 0x01, 0xCF, 0xF0, 0x1C, 0x07, 0x31, 0xC0, 0x73, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x03, 0x00};
+	0xE0, 0x13, 0x6C, 0xCC, 0x1A, 0x27, 0x01, 0x6C, 0x3E, 0xAC, 0xC1, 0x67, 0xA0, 0x1C, 0xC7, 0x01, 0xCF, 0xF0, 0x1C, 0x07, 0x31, 0xC0, 0x73, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00};
 
 static const uint8_t notificationsData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC1, 0x90, 0x05, 0x24, 0x40, 0x5A, 0xC3, 0x92, 0x00, 0x06, 0xA0, 0x2E, 0x5F, 0xF7, 0xC1, 0x24, 0x0D, 0xA3, 0xFF, 0xFF, 0x8C, 0xB0, 0x22, 0x5F, 0xF7, 0xE4, 0x02, 0xDA, 0xFF, 0x0B, 0x00, 0x6D, 0x24, 0xDA, 0x8D, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xCE, 0x70, 0x17, 0xA3, 0xFF, 0xFE, 0x80, 0x00, 0x17, 0x93, 0x36, 0x6B, 0xC3, 0x40, 0x08, 0x3E, 0xFF, 0xE3, 0x60, 0x08, 0x67, 0xF8, 0xE8, 0x80, 0x0A, 0xD0, 0x1A, 0x72, 0x68, 0x01, 0x8F, 0xFF, 0x7A, 0x80, 0x95, 0x1F, 0xFF, 0x68, 0x00, 0x14, 0xE6, 0x94, 0x10, 0x01, 0x6F, 0xFF, 0x1A, 0x00, 0x94, 0xEF, 0xFF, 0x90, 0x00, 0x6D, 0x26, 0x94, 0x68, 
-	0x01, 0x97, 0xFE, 0xE9, 0xE0, 0x3B, 0x2F, 0x8E, 0x94, 0x01, 0x32, 0xA4, 0xD2, 0xAE, 0x00, 0x11, 0xFF, 0xEE, 0x3C, 0x05, 0xBC, 0x3C, 0x90, 0xBC, 0xC7, 0x01, 0x6F, 0x0F, 0x84, 0x2F, 0x3B, 0xC2, 0xF3, 0xBC, 0x2F, 0x3B, 0xC2, 0xF3, 0xBC, 0x2F, 0x3B, 0x00, 0x11, 0xC0, 0xC3, 0x93, 0x64, 0x00, 0x47, 0x83, 0x0E, 0x4D, 0x7C, 0x3F, 0x3F, 0xC3, 0xF0, 0x5C, 0x0F, 0x6D, 0xFF, 0xEF, 0xC1, 0x00, 0x2E, 0xC3, 0xEF, 0xFB, 0xFC, 0x3F, 0x0F, 0xC2, 0xA0};
+	0x01, 0x97, 0xFE, 0xE9, 0xE0, 0x3B, 0x2F, 0x8E, 0x94, 0x01, 0x32, 0xA4, 0xD2, 0xAE, 0x00, 0x11, 0xFF, 0xEE, 0x3C, 0x05, 0xBC, 0x3C, 0x90, 0xBC, 0xC7, 0x01, 0x6F, 0x0F, 0x84, 0x2F, 0x3B, 0xC2, 0xF3, 0xBC, 0x2F, 0x3B, 0xC2, 0xF3, 0xBC, 0x2F, 0x3B, 0x00, 0x11, 0xC0, 0xC3, 0x93, 0x64, 0x00, 0x47, 0x83, 0x0E, 0x4D, 0x7C, 0x3F, 0x3F, 0xC3, 0xF0, 0x5C, 0x0F, 0x6D, 0xFF, 0xEF, 0xC1, 0x00, 0x2E, 0xC3, 0xEF, 0xFB, 0xFC, 0x3F, 0x0F, 0xC2, 0xA0, 0x00, 0x00, 0x00};
 
 static const uint8_t personData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x09, 0x80, 0x25, 0xA4, 0x98, 0xD4, 0xF8, 0x5F, 0x80, 0xE0, 0xC3, 0x1F, 0xFF, 0xFE, 0xC2, 0x82, 0xFC, 0x03, 0x87, 0x99, 0x30, 0xA7, 0xBF, 0x07, 0xCF, 0xF0, 0x7C, 0xFF, 0x00, 0xAB, 0x59, 0x30, 0xAB, 0x7F, 0x01, 0xA2, 0x0F, 0x93, 0x30, 0x4B, 0xF0, 0x1C, 0x06, 0xA0, 0xF6, 0x24, 0xC2, 0x5B, 0xF8, 0x7E, 0x1F, 0x87, 0xE0, 0x28, 0x0B, 0x21, 0x6A, 0x6C, 0xCF, 0xFC, 0xC4, 0xCF, 0x87, 0x03, 0x98, 0x04, 0xB6, 0x93, 0x1A, 0x9F, 0x0A, 0x50, 0x05, 0x2E, 0x0C, 0x29, 0x38, 0x00, 0x02, 0xEC, 0xC2, 0x66, 0xF8, 0x7E, 0x6F, 0x87, 0xE7, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 
-	0x7E, 0x07, 0x80};
+	0x7E, 0x07, 0x80, 0x00, 0x00, 0x00};
 
 static const uint8_t phoneData[] PROGMEM = {
 	0xFC, 0x3F, 0x09, 0xC0, 0x39, 0x37, 0xF0, 0x6C, 0x03, 0x30, 0xE4, 0xD6, 0xC0, 0x19, 0xD1, 0x30, 0xA4, 0xE4, 0x01, 0xCC, 0x39, 0x35, 0x70, 0x50, 0xC1, 0x8D, 0x40, 0x6C, 0xC3, 0x93, 0x53, 0x00, 0x9B, 0x22, 0x61, 0x46, 0xA6, 0x0F, 0x98, 0x72, 0x69, 0xE0, 0x13, 0x24, 0x4C, 0x29, 0xE4, 0xC2, 0x03, 0x4D, 0x30, 0x00, 0x04, 0x1B, 0x14, 0x30, 0x90, 0xA0, 0x0E, 0x18, 0x24, 0xA8, 0x05, 0x64, 0x91, 0x80, 0x31, 0x81, 0x06, 0x09, 0x32, 0x01, 0x24, 0x38, 0xC1, 0x19, 0x80, 0x43, 0x04, 0xA0, 0x03, 0x2B, 0x7F, 0xFF, 0xD6, 0xA0, 0x09, 0xA4, 0xA0, 0x6D, 0x0F, 0xFF, 0x78, 0x3F, 0x82, 0x80, 0x5D, 0x67, 0xFF, 0x9D, 
-	0xF8, 0x28, 0x07, 0x50, 0x7D, 0xFF, 0xA6, 0xFE, 0x0A, 0x01, 0xD6, 0x3F, 0xFF, 0xE9, 0xAC, 0x80, 0x03, 0xC0, 0x1F, 0x39, 0x7F, 0xFF, 0xA6, 0x9C, 0x0C, 0x4B, 0xFF, 0xFC, 0xFA, 0x78, 0x78, 0x6D, 0x60, 0xC5, 0x63, 0xFF, 0xFF, 0x1E, 0x08, 0x02, 0xB4, 0x77, 0x82, 0x13, 0x87, 0xDF, 0xFF, 0x7A, 0xF1, 0xE8, 0x03, 0x50, 0x79, 0x46, 0x7D, 0x80, 0xF3, 0x07, 0xB3, 0x67, 0xF8, 0x08, 0x0D, 0x48, 0x58, 0x78, 0xFD, 0x7D, 0xFF, 0xFE, 0xFE, 0x1F, 0x87, 0xE1, 0xF8, 0x56, 0x00};
+	0xF8, 0x28, 0x07, 0x50, 0x7D, 0xFF, 0xA6, 0xFE, 0x0A, 0x01, 0xD6, 0x3F, 0xFF, 0xE9, 0xAC, 0x80, 0x03, 0xC0, 0x1F, 0x39, 0x7F, 0xFF, 0xA6, 0x9C, 0x0C, 0x4B, 0xFF, 0xFC, 0xFA, 0x78, 0x78, 0x6D, 0x60, 0xC5, 0x63, 0xFF, 0xFF, 0x1E, 0x08, 0x02, 0xB4, 0x77, 0x82, 0x13, 0x87, 0xDF, 0xFF, 0x7A, 0xF1, 0xE8, 0x03, 0x50, 0x79, 0x46, 0x7D, 0x80, 0xF3, 0x07, 0xB3, 0x67, 0xF8, 0x08, 0x0D, 0x48, 0x58, 0x78, 0xFD, 0x7D, 0xFF, 0xFE, 0xFE, 0x1F, 0x87, 0xE1, 0xF8, 0x56, 0x00, 0x00, 0x00, 0x00};
 
 static const uint8_t powerData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x07, 0x33, 0xC0, 0x73, 0xFC, 0x07, 0x33, 0xC0, 0x73, 0xFC, 0x07, 0x33, 0xC0, 0x73, 0xFC, 0x07, 0x33, 0xC0, 0x73, 0xE8, 0x01, 0x6A, 0x33, 0x16, 0xBC, 0x3C, 0x00, 0x16, 0x6A, 0x30, 0x99, 0xDE, 0x17, 0x9D, 0xE1, 0x79, 0xDE, 0x17, 0x9D, 0xE1, 0x79, 0xDE, 0x17, 0x9D, 0xE0, 0x15, 0xED, 0x66, 0x0A, 0x57, 0x80, 0xB2, 0x1E, 0xC6, 0x60, 0x8E, 0xE0, 0x2C, 0x87, 0xAD, 0x98, 0x23, 0xF8, 0x0B, 0x41, 0xF2, 0x66, 0x08, 0xFE, 0x03, 0x80, 0x36, 0x22, 0x60, 0xC7, 0xF8, 0x12, 0x00, 0xD8, 0x89, 0x83, 0x1F, 0xE0, 0x48, 0x03, 0x62, 0x26, 0x0C, 0x7F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 
-	0x80, 0x80};
+	0x80, 0x80, 0x00, 0x00, 0x00};
 
 static const uint8_t sdData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC2, 0x40, 0x04, 0x61, 0x31, 0x6B, 0xC3, 0xC4, 0x01, 0x1A, 0x4C, 0x26, 0x76, 0x04, 0x52, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE3, 0x80, 0xE7, 0x40, 0x02, 0x26, 0x18, 0xE0, 0x19, 0x8E, 0x01, 0x98, 0xE0, 0x39, 0xC8, 0x00, 0x8A, 0x06, 0x38, 0x06, 0x63, 0x80, 0x66, 0x38, 0x0E, 0x70, 0x00, 0x22, 0xA1, 0x8E, 0x01, 0x98, 0xE0, 0x19, 0x8E, 0x03, 0x9B, 0xE1, 0xF9, 0xBE, 0x1F, 0x9B, 0xE1, 0xF9, 0xBE, 0x1F, 0x9B, 0xE1, 0xF9, 0xBE, 0x1F, 0x9B, 0xE1, 0xF9, 0xBE, 0x1F, 0x9B, 0xE1, 0xF9, 0xBE, 0x1F, 0x9B, 0xE1, 0xF9, 0xBE, 0x1F, 0x9B, 0xE0, 0x13, 0x6E, 0xCC, 0x1A, 0x1F, 0x01, 
-	0x6C, 0x3E, 0xCC, 0xC1, 0x67, 0xF0, 0xFC, 0x3F, 0x04, 0x80};
+	0x6C, 0x3E, 0xCC, 0xC1, 0x67, 0xF0, 0xFC, 0x3F, 0x04, 0x80, 0x00, 0x00, 0x00};
 
 static const uint8_t smsData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC0, 0xA0, 0x05, 0xAF, 0xCC, 0x66, 0xF6, 0x14, 0x1A, 0x00, 0x01, 0x7E, 0x65, 0x98, 0x4C, 0xCF, 0x0F, 0xCC, 0xF3, 0x3C, 0x3F, 0x33, 0xCC, 0xF0, 0x8C, 0xC7, 0x08, 0xCC, 0xF0, 0x8C, 0xC7, 0x08, 0xCC, 0xF0, 0x8C, 0xC7, 0x08, 0xCC, 0xF0, 0x8C, 0xC7, 0x08, 0xCC, 0xF0, 0xFC, 0xCF, 0x33, 0xC3, 0xF3, 0x3C, 0xCF, 0x08, 0xCC, 0x70, 0x8C, 0xCF, 0x08, 0xCC, 0x70, 0x8C, 0xCF, 0x0F, 0xCC, 0xF3, 0x3C, 0x3F, 0x33, 0xCC, 0xF0, 0xFC, 0xCE, 0x30, 0x68, 0x38, 0x3F, 0x32, 0x8C, 0x16, 0x52, 0x03, 0x0C, 0x11, 0xFC, 0x10, 0x02, 0x0C, 0x12, 0xFC, 0x14, 0x01, 0x0C, 0x12, 0xFC, 0x18, 0x00, 0xAE, 0x7F, 
-	0x0F, 0xC3, 0xF0, 0xFC, 0x14, 0x00};
+	0x0F, 0xC3, 0xF0, 0xFC, 0x14, 0x00, 0x00, 0x00, 0x00};
 
 static const uint8_t starData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC2, 0xC0, 0x16, 0x49, 0x2F, 0xC1, 0x90, 0x1A, 0xDF, 0x37, 0xF0, 0x58, 0x0B, 0x9F, 0xFF, 0xF0, 0x7F, 0x04, 0x40, 0xDA, 0x3F, 0xFF, 0xF8, 0xFF, 0x04, 0x00, 0xF6, 0x7F, 0xFB, 0xFC, 0x0C, 0x00, 0xA4, 0x8F, 0x30, 0xA4, 0xBE, 0x01, 0xD3, 0x30, 0x25, 0xC9, 0x99, 0xD3, 0xE1, 0x40, 0xA0, 0xAF, 0x80, 0xB3, 0x15, 0x7E, 0x63, 0x36, 0x60, 0x55, 0x50, 0x03, 0xAC, 0xBF, 0x30, 0x9A, 0x38, 0x01, 0xCE, 0x3C, 0x18, 0x23, 0x28, 0x0B, 0x61, 0xF5, 0x66, 0x0B, 0x37, 0x80, 0xB4, 0x1F, 0x46, 0x60, 0x96, 0xC0, 0x14, 0xEC, 0x26, 0x14, 0xEE, 0xE0, 0x0B, 0x31, 0x18, 0x4C, 0xF6, 0x00, 0x67, 0x98, 0xC2, 
-	0x43, 0x88, 0x05, 0x44, 0x81, 0x8D, 0x49, 0x62, 0x79, 0x85, 0x45, 0x88, 0x03, 0x69, 0x66, 0x0A, 0xA5, 0x80, 0xB4, 0x1E, 0x92, 0x61, 0x46, 0xDE, 0x04, 0xCF, 0x7F, 0xDA, 0xC8, 0x17, 0x38, 0x7D, 0xEF, 0x5E, 0x02, 0x5E, 0x8C, 0x60, 0x34, 0x87, 0x8F, 0xE1, 0xF8, 0x7E, 0x1F, 0x86, 0xE0};
+	0x43, 0x88, 0x05, 0x44, 0x81, 0x8D, 0x49, 0x62, 0x79, 0x85, 0x45, 0x88, 0x03, 0x69, 0x66, 0x0A, 0xA5, 0x80, 0xB4, 0x1E, 0x92, 0x61, 0x46, 0xDE, 0x04, 0xCF, 0x7F, 0xDA, 0xC8, 0x17, 0x38, 0x7D, 0xEF, 0x5E, 0x02, 0x5E, 0x8C, 0x60, 0x34, 0x87, 0x8F, 0xE1, 0xF8, 0x7E, 0x1F, 0x86, 0xE0, 0x00, 0x00, 0x00};
 
 static const uint8_t syncData[] PROGMEM = {
 	0xFC, 0x3F, 0x03, 0x00, 0x29, 0x7F, 0xC1, 0x80, 0x1A, 0x5F, 0xFF, 0xF0, 0x50, 0x01, 0x12, 0x0F, 0xF0, 0x40, 0x01, 0x14, 0x0C, 0xAA, 0xBD, 0x3C, 0x2F, 0xC0, 0x48, 0x71, 0x6C, 0xC3, 0xA3, 0xBF, 0x08, 0xEB, 0x2F, 0xFF, 0xF0, 0x06, 0x0F, 0x1F, 0xFF, 0xFD, 0xFB, 0x40, 0x14, 0x8F, 0x01, 0xEB, 0x2F, 0xF3, 0x00, 0xEA, 0x0F, 0xBF, 0xF8, 0xE9, 0x80, 0x7A, 0xDF, 0x05, 0x00, 0x0E, 0xB2, 0x40, 0x0D, 0xA0, 0xFF, 0xFF, 0x0A, 0x10, 0x26, 0xDF, 0xFF, 0x7A, 0x00, 0xB9, 0xCF, 0xFF, 0x35, 0xF0, 0x21, 0x97, 0xC0, 0xA3, 0x48, 0x15, 0x43, 0xFF, 0xDC, 0xF8, 0x0E, 0x77, 0x80, 0xE6, 0xF8, 0x0E, 0x77, 0x80, 0xE6, 0xF8, 
-	0x0E, 0xCB, 0xE1, 0x49, 0x52, 0x05, 0x49, 0x7F, 0xF7, 0x3E, 0x05, 0xCE, 0x7F, 0xF9, 0xB4, 0x01, 0x36, 0xFF, 0xFB, 0xC2, 0x06, 0xD0, 0x7F, 0xFF, 0x84, 0x80, 0x07, 0x26, 0xA0, 0x03, 0xC8, 0x7D, 0xD3, 0x01, 0xD5, 0x97, 0xFF, 0x78, 0x46, 0x00, 0x66, 0x1C, 0x9A, 0x80, 0x00, 0x36, 0x84, 0x77, 0xBF, 0xFF, 0xFA, 0x78, 0x48, 0x07, 0xFF, 0xFA, 0x6F, 0xE0, 0x1D, 0x64, 0xD9, 0x87, 0x26, 0xFE, 0x05, 0xC4, 0x1E, 0x3F, 0x48, 0x18, 0x23, 0xF8, 0x20, 0x04, 0x18, 0x25, 0xF8, 0x28, 0x02, 0x18, 0x25, 0xF8, 0x30, 0x01, 0x34, 0xFC, 0x3F, 0x03, 0x00};
+	0x0E, 0xCB, 0xE1, 0x49, 0x52, 0x05, 0x49, 0x7F, 0xF7, 0x3E, 0x05, 0xCE, 0x7F, 0xF9, 0xB4, 0x01, 0x36, 0xFF, 0xFB, 0xC2, 0x06, 0xD0, 0x7F, 0xFF, 0x84, 0x80, 0x07, 0x26, 0xA0, 0x03, 0xC8, 0x7D, 0xD3, 0x01, 0xD5, 0x97, 0xFF, 0x78, 0x46, 0x00, 0x66, 0x1C, 0x9A, 0x80, 0x00, 0x36, 0x84, 0x77, 0xBF, 0xFF, 0xFA, 0x78, 0x48, 0x07, 0xFF, 0xFA, 0x6F, 0xE0, 0x1D, 0x64, 0xD9, 0x87, 0x26, 0xFE, 0x05, 0xC4, 0x1E, 0x3F, 0x48, 0x18, 0x23, 0xF8, 0x20, 0x04, 0x18, 0x25, 0xF8, 0x28, 0x02, 0x18, 0x25, 0xF8, 0x30, 0x01, 0x34, 0xFC, 0x3F, 0x03, 0x00, 0x00, 0x00, 0x00};
 
 static const uint8_t thermostatData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC2, 0x80, 0x3A, 0x6E, 0xFF, 0xBD, 0x3B, 0xF0, 0x30, 0x01, 0x59, 0x03, 0x0E, 0x8D, 0xFC, 0x07, 0x02, 0x19, 0xFC, 0x18, 0x15, 0x41, 0xFF, 0xDF, 0xF8, 0x0E, 0x03, 0x98, 0xE0, 0x39, 0xFE, 0x03, 0x80, 0xE6, 0x18, 0x16, 0x7F, 0x80, 0xE0, 0x39, 0x8E, 0x03, 0x9F, 0xE0, 0x38, 0x0E, 0x63, 0x80, 0xE7, 0xF8, 0x0E, 0x03, 0x98, 0x60, 0x59, 0xFE, 0x03, 0x80, 0xE6, 0x38, 0x0E, 0x7F, 0x80, 0xE0, 0xB9, 0xFE, 0x03, 0x82, 0xE7, 0xF8, 0x08, 0x00, 0x93, 0x06, 0x1D, 0x1D, 0xE0, 0x02, 0x94, 0x06, 0x14, 0x9F, 0x00, 0x14, 0xF4, 0x26, 0x14, 0xF6, 0xE1, 0x39, 0xEE, 0x13, 0x9E, 0xE0, 0x15, 0x6C, 0x26, 
-	0x15, 0x6F, 0x00, 0x15, 0x8C, 0x06, 0x0A, 0x3E, 0x00, 0x75, 0x93, 0x06, 0x09, 0x7E, 0x02, 0x00, 0xF3, 0x87, 0xB1, 0x26, 0x1D, 0x3B, 0xF8, 0x7E, 0x1F, 0x84, 0xA0};
+	0x15, 0x6F, 0x00, 0x15, 0x8C, 0x06, 0x0A, 0x3E, 0x00, 0x75, 0x93, 0x06, 0x09, 0x7E, 0x02, 0x00, 0xF3, 0x87, 0xB1, 0x26, 0x1D, 0x3B, 0xF8, 0x7E, 0x1F, 0x84, 0xA0, 0x00, 0x00, 0x00};
 
 static const uint8_t thumbData[] PROGMEM = {
 	0xFC, 0x3F, 0x05, 0x00, 0x69, 0x78, 0xEF, 0xC1, 0x40, 0x3A, 0x5F, 0xFF, 0xFE, 0x37, 0xF0, 0x30, 0x01, 0x13, 0x4C, 0x19, 0xFF, 0x02, 0x40, 0x11, 0x44, 0xC1, 0x8B, 0xF0, 0x14, 0x01, 0x15, 0x0C, 0x2A, 0x1F, 0xC0, 0x34, 0x36, 0x0F, 0xF0, 0x09, 0x13, 0x26, 0x13, 0x2F, 0xC0, 0x16, 0x76, 0x31, 0x6B, 0xC3, 0x20, 0x0F, 0x31, 0xC3, 0xC3, 0x09, 0x98, 0xE0, 0x79, 0x8E, 0x1F, 0x98, 0xE0, 0x79, 0x8E, 0x1F, 0x98, 0xE0, 0x79, 0x8E, 0x1F, 0x18, 0x34, 0x0C, 0x07, 0x98, 0xE1, 0xE1, 0x83, 0x39, 0x00, 0x79, 0x8E, 0x1D, 0x99, 0x69, 0x00, 0x07, 0x98, 0xE1, 0xC1, 0x82, 0xC9, 0x80, 0x79, 0x8E, 0x1B, 0x98, 0x54, 0x26, 
-	0x01, 0xE6, 0x38, 0x6C, 0x60, 0xA4, 0x70, 0x1E, 0x63, 0x86, 0x86, 0x0C, 0x48, 0x01, 0xE6, 0x38, 0x04, 0xDA, 0xF3, 0x05, 0x64, 0x80, 0xF3, 0x20, 0x05, 0xB0, 0xFA, 0x73, 0x05, 0x9F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0C, 0x80};
+	0x01, 0xE6, 0x38, 0x6C, 0x60, 0xA4, 0x70, 0x1E, 0x63, 0x86, 0x86, 0x0C, 0x48, 0x01, 0xE6, 0x38, 0x04, 0xDA, 0xF3, 0x05, 0x64, 0x80, 0xF3, 0x20, 0x05, 0xB0, 0xFA, 0x73, 0x05, 0x9F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0C, 0x80, 0x00, 0x00, 0x00};
 
 static const uint8_t warningData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC2, 0xC0, 0x16, 0x4D, 0x3F, 0xC1, 0x80, 0x1E, 0x7F, 0xDF, 0xFC, 0x14, 0x03, 0xA9, 0xFF, 0xFF, 0xE3, 0x7F, 0x03, 0x80, 0x15, 0x4B, 0x31, 0x6B, 0xC1, 0xFC, 0x09, 0x00, 0x6D, 0x44, 0xC2, 0x8D, 0xFC, 0x06, 0x00, 0x59, 0x58, 0xC2, 0x82, 0xFC, 0x03, 0x87, 0x99, 0x30, 0xA7, 0xBC, 0x00, 0x52, 0x80, 0xC2, 0x93, 0xE0, 0x01, 0x64, 0xD3, 0x1C, 0x0C, 0x30, 0x99, 0xE8, 0x00, 0xAC, 0x81, 0x8E, 0x07, 0x98, 0x74, 0x6D, 0xC0, 0x0A, 0xA9, 0x18, 0xE0, 0x81, 0x8B, 0x5E, 0x0D, 0x20, 0x0B, 0x4A, 0x18, 0xE0, 0xA1, 0x85, 0x1D, 0x30, 0x00, 0x5B, 0x98, 0x50, 0x50, 0x00, 0x53, 0xDC, 0x98, 0x53, 0xCE, 
-	0x00, 0x29, 0x38, 0x63, 0x83, 0x66, 0x14, 0x9B, 0x00, 0x01, 0x3C, 0x63, 0x83, 0x86, 0x13, 0x35, 0x00, 0x15, 0xBF, 0x32, 0x0C, 0x3A, 0x34, 0xE0, 0x00, 0x7F, 0x33, 0xCC, 0xC4, 0x20, 0x00, 0x2D, 0x7E, 0x68, 0x98, 0x51, 0xDF, 0x87, 0xE1, 0xF8, 0x7E, 0x11, 0x80};
+	0x00, 0x29, 0x38, 0x63, 0x83, 0x66, 0x14, 0x9B, 0x00, 0x01, 0x3C, 0x63, 0x83, 0x86, 0x13, 0x35, 0x00, 0x15, 0xBF, 0x32, 0x0C, 0x3A, 0x34, 0xE0, 0x00, 0x7F, 0x33, 0xCC, 0xC4, 0x20, 0x00, 0x2D, 0x7E, 0x68, 0x98, 0x51, 0xDF, 0x87, 0xE1, 0xF8, 0x7E, 0x11, 0x80, 0x00, 0x00, 0x00};
 
 static const uint8_t wifiData[] PROGMEM = {
 	0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x08, 0x81, 0xB9, 0x0A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0A, 0x07, 0x70, 0x16, 0x47, 0xE8, 0xCC, 0x9A, 0xF4, 0xF0, 0x63, 0x00, 0xA4, 0xB9, 0x31, 0xA8, 0xF0, 0x56, 0x00, 0xA7, 0x94, 0x37, 0x69, 0xF0, 0xA0, 0xA0, 0xA0, 0xA0, 0xF0, 0xF6, 0x40, 0xC6, 0xAF, 0x0D, 0x30, 0x01, 0x13, 0xCC, 0x5A, 0xE4, 0x63, 0x02, 0x64, 0x2C, 0x7E, 0x30, 0xCF, 0x93, 0x40, 0x00, 0x1C, 0x49, 0x30, 0xA8, 0x73, 0x04, 0x64, 0x3C, 0xBF, 0xFF, 0xF5, 0x30, 0x06, 0xAC, 0xBA, 0x48, 0x1D, 0x98, 0x7D, 0xBE, 0xBE, 0xBE, 0x7D, 0x3C, 0x24, 0xF0, 0x1A, 0xB2, 0xEA, 0x30, 0x05, 0x68, 0xCC, 0x59, 0xF0, 
-	0xAD, 0x00, 0x47, 0x03, 0x0E, 0x4D, 0x9C, 0x03, 0x9C, 0x4A, 0x31, 0x67, 0x81, 0x2C, 0x09, 0x90, 0xB0, 0xF4, 0x93, 0x04, 0x6C, 0x01, 0xAB, 0x2E, 0xA0, 0x01, 0xAB, 0x2E, 0xBF, 0x01, 0x80, 0x54, 0xCF, 0xF0, 0x40, 0x03, 0x97, 0x8B, 0x31, 0xAB, 0xD3, 0x7F, 0x01, 0xC0, 0x39, 0xC5, 0x03, 0x04, 0x7F, 0x03, 0x00, 0x2A, 0xC2, 0xD9, 0xFF, 0x3F, 0x05, 0x00, 0x6A, 0xCB, 0xAF, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xB0, 0x00};
+	0xAD, 0x00, 0x47, 0x03, 0x0E, 0x4D, 0x9C, 0x03, 0x9C, 0x4A, 0x31, 0x67, 0x81, 0x2C, 0x09, 0x90, 0xB0, 0xF4, 0x93, 0x04, 0x6C, 0x01, 0xAB, 0x2E, 0xA0, 0x01, 0xAB, 0x2E, 0xBF, 0x01, 0x80, 0x54, 0xCF, 0xF0, 0x40, 0x03, 0x97, 0x8B, 0x31, 0xAB, 0xD3, 0x7F, 0x01, 0xC0, 0x39, 0xC5, 0x03, 0x04, 0x7F, 0x03, 0x00, 0x2A, 0xC2, 0xD9, 0xFF, 0x3F, 0x05, 0x00, 0x6A, 0xCB, 0xAF, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xB0, 0x00, 0x00, 0x00, 0x00};
 
 // END-OF-FILE
@@ -70,14 +70,15 @@ static const uint8_t * icons[25] = { accessData,
                                      warningData,
                                      wifiData };
 
-// Color gradients for smoothing edges
-static const uint16_t colors[7][3] = { { 0x5000, 0xA800, 0xF800 },    // Red
-                                       { 0x02A0, 0x0540, 0x07E0 },    // Green
-                                       { 0x000A, 0x0015, 0x001F },    // Blue
-                                       { 0x52A0, 0xAD40, 0xFFE0 },    // Yellow
-                                       { 0x02AA, 0x0555, 0x7FFF },    // Cyan
-                                       { 0x500A, 0xA815, 0xF81F },    // Magenta
-                                       { 0x52AA, 0xAD55, 0xFFFF } };  // White
+// Color gradients for smoothing edges: palettes of the icon frames
+// (the frame value is the color index, 0 - background)
+static const uint16_t colors[7][4] = { { 0x0000, 0x5000, 0xA800, 0xF800 },    // Red
+                                       { 0x0000, 0x02A0, 0x0540, 0x07E0 },    // Green
+                                       { 0x0000, 0x000A, 0x0015, 0x001F },    // Blue
+                                       { 0x0000, 0x52A0, 0xAD40, 0xFFE0 },    // Yellow
+                                       { 0x0000, 0x02AA, 0x0555, 0x7FFF },    // Cyan
+                                       { 0x0000, 0x500A, 0xA815, 0xF81F },    // Magenta
+                                       { 0x0000, 0x52AA, 0xAD55, 0xFFFF } };  // White
 
 
 uint8_t currentColor;
@@ -139,7 +140,8 @@ void loop() {
     for (uint8_t j = 0; j < BUFFERS_PER_ICON; j++)
     {
       // Decompress one buffer
-      decomp.decompressNextFrames((DecompressionContext *)&iconsDC, currentIcon, decompressedData, FRAMES_PER_ICON_BUFFER, true);
+      DecompressionPaletteSink<> sink(decompressedData, colors[currentColor]);
+      decomp.decompressNextFrames((DecompressionContext *)&iconsDC, currentIcon, sink, FRAMES_PER_ICON_BUFFER);
       // And display it
       ST7789.writePixels(decompressedData, FRAMES_PER_ICON_BUFFER, LITTLE_ENDIAN);
     }
@@ -156,10 +158,4 @@ void loop() {
   }
 }
 
-// Delegate method for coloring a pixel in the current color
-uint16_t colorizePixel(uint16_t frame) {
-  uint16_t pixelColor = (frame == 0) ? 0 : colors[currentColor][frame - 1];
-  return (pixelColor);
-}
-
 // END-OF-FILE
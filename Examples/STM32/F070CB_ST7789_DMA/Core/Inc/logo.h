@@ -186,6 +186,6 @@ static const uint8_t logoData[] = {
 	0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x5A, 0x00, 0x34, 0x1E, 0x12, 0x00, 0x1A, 0x0F, 0x82, 0x00, 0x2C, 0xCF, 0xAF, 0x74, 0x04, 0x80, 0x6B, 0x56, 0x76, 0xFE, 0x7F, 0x6E, 0x05, 0x9E, 0xAC, 0xB2, 0xF0, 0x40, 0x00, 0x08, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1C, 0x01, 0xA8, 0x62, 0x00, 0x00, 0x00, 0xF4, 0x3E, 0xF0, 0x00, 0x00, 0x2C, 0xB6, 0xBB, 0x04, 0x25, 0x17, 0x7E, 0x6F, 0xC5, 0xD9, 0x2C, 0xC2, 0x80, 0x1E, 0x0F, 0x39, 0xE6, 0x06, 0x75, 0xD7, 0xE7, 0x95, 0xD7, 0x99, 0x88, 0x00, 0xD4, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x1A, 0x0F, 0x05, 0x80, 0x2C, 0xC7, 0xD5, 0x65, 
 	0xB5, 0xC3, 0x80, 0x35, 0xCF, 0xDA, 0xFF, 0x6F, 0xD9, 0xA8, 0x27, 0xAF, 0xF1, 0xEA, 0x6B, 0x1C, 0x93, 0xDD, 0x97, 0x80, 0x00, 0x00, 0x51, 0x81, 0x07, 0xF8, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x2C, 0x01, 0xA8, 0x82, 0x34, 0xE0, 0x00, 0x00, 0x32, 0xD9, 0x26, 0x00, 0x00, 0x05, 0xD8, 0xD3, 0x61, 0x04, 0xA2, 0xEF, 0xDD, 0xFA, 0x92, 0x5C, 0x7E, 0xFD, 0xDB, 0xB3, 0x52, 0xDC, 0x6B, 0xCD, 0x79, 0x9E, 0xC2, 0xC0, 0x16, 0x8B, 0x8A, 0x8B, 0xDC, 0xAB, 0xD4, 0xAB, 0x22, 0xA0, 0x03, 0x51, 0xD1, 0xC0, 0x01, 0xA0, 0xF0, 0x78, 0x02, 0xD0, 0xF9, 0x30, 0x1D, 0x02, 0xD0, 0x68, 0x6C, 0x48, 0x03, 0x5C, 0x39, 
 	0x56, 0x76, 0xFE, 0xDF, 0x8A, 0x8C, 0xBF, 0x5F, 0xE3, 0xD3, 0xD2, 0x39, 0x2B, 0xCC, 0x13, 0x04, 0x20, 0x01, 0x46, 0x12, 0x60, 0x00, 0x00, 0x02, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xDC, 0x00, 0x00, 0x00, 0x3C, 0x01, 0xA8, 0x21, 0x00, 0x00, 0x00, 0x72, 0x18, 0x70, 0x00, 0x00, 0x15, 0x5B, 0x4E, 0x00, 0x00, 0x02, 0x39, 0xCF, 0x50, 0x00, 0x00, 0x2C, 0xC6, 0x1A, 0x10, 0x44, 0x13, 0x1D, 0xE7, 0xC3, 0x0C, 0xAB, 0x34, 0xEE, 0xBD, 0x69, 0xEE, 0x43, 0x5E, 0xEB, 0xD8, 0xE7, 0x66, 0x06, 0x80, 0x1D, 0xEB, 0x7A, 0xD1, 0x1B, 0xAB, 0xCA, 0xD7, 0xBD, 0xAF, 0x7B, 0xDE, 0xF7, 0xBD, 0xEF, 0x7B, 0xC9, 0xB7, 0xB8, 0x06, 
-	0x40, 0x35, 0xAB, 0x1A, 0x7B, 0x4F, 0x41, 0x27, 0x21, 0x9F, 0xB2, 0xEB, 0x2F, 0x4D, 0x78, 0x72, 0xED, 0x92, 0x51, 0xC9, 0x56, 0x25, 0xA8, 0x41, 0x00, 0x10, 0x4D, 0x77, 0x00, 0x00, 0x00, 0x9A, 0xCA, 0x30, 0x00, 0x00, 0x02, 0x8F, 0x18, 0x00, 0x00, 0x00};
+	0x40, 0x35, 0xAB, 0x1A, 0x7B, 0x4F, 0x41, 0x27, 0x21, 0x9F, 0xB2, 0xEB, 0x2F, 0x4D, 0x78, 0x72, 0xED, 0x92, 0x51, 0xC9, 0x56, 0x25, 0xA8, 0x41, 0x00, 0x10, 0x4D, 0x77, 0x00, 0x00, 0x00, 0x9A, 0xCA, 0x30, 0x00, 0x00, 0x02, 0x8F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
 // END-OF-FILE
@@ -43,6 +43,12 @@
 #define FRAMES_PER_ICON_BUFFER    ICONS_IMAGE_WIDTH * ICONS_SQUARE_SIDE
 #define BUFFERS_PER_ICON          ICONS_IMAGE_HEIGHT / ICONS_SQUARE_SIDE
 
+// Every decompressed part of the image must fit into the display buffer
+#if defined (ST7789_USE_BUFFERING)
+_Static_assert(FRAMES_PER_LOGO_BUFFER <= ST7789_BUFFER_PIXELS, "The logo buffer doesn't fit into the display buffer");
+_Static_assert(FRAMES_PER_ICON_BUFFER <= ST7789_BUFFER_PIXELS, "The icon buffer doesn't fit into the display buffer");
+#endif
+
 #define PRANDOM(x)	(uint32_t)round((double)random() * (double)(x-1) / (double)RAND_MAX)
 
 /* USER CODE END PD */
@@ -85,14 +91,15 @@ static const uint8_t * icons[25] = { accessData,
                                      warningData,
                                      wifiData };
 
-// Color gradients for smoothing edges
-static const uint16_t colors[7][3] = { { 0x5000, 0xA800, 0xF800 },    // Red
-                                       { 0x02A0, 0x0540, 0x07E0 },    // Green
-                                       { 0x000A, 0x0015, 0x001F },    // Blue
-                                       { 0x52A0, 0xAD40, 0xFFE0 },    // Yellow
-                                       { 0x02AA, 0x0555, 0x7FFF },    // Cyan
-                                       { 0x500A, 0xA815, 0xF81F },    // Magenta
-                                       { 0x52AA, 0xAD55, 0xFFFF } };  // White
+// Color gradients for smoothing edges: palettes of the icon frames
+// (the frame value is the color index, 0 - background)
+static const uint16_t colors[7][4] = { { 0x0000, 0x5000, 0xA800, 0xF800 },    // Red
+                                       { 0x0000, 0x02A0, 0x0540, 0x07E0 },    // Green
+                                       { 0x0000, 0x000A, 0x0015, 0x001F },    // Blue
+                                       { 0x0000, 0x52A0, 0xAD40, 0xFFE0 },    // Yellow
+                                       { 0x0000, 0x02AA, 0x0555, 0x7FFF },    // Cyan
+                                       { 0x0000, 0x500A, 0xA815, 0xF81F },    // Magenta
+                                       { 0x0000, 0x52AA, 0xAD55, 0xFFFF } };  // White
 
 // Current icon parameters
 uint8_t currentColor;
@@ -208,7 +215,7 @@ int main(void)
           uint16_t currentScreenBuffer[FRAMES_PER_ICON_BUFFER];
 #endif
 	      // Decompress one buffer
-	      decompressNextFrames((DecompressionContext *)&iconsDC, currentIcon, currentScreenBuffer, FRAMES_PER_ICON_BUFFER, true);
+	      decompressNextFramesWithPalette((DecompressionContext *)&iconsDC, currentIcon, currentScreenBuffer, FRAMES_PER_ICON_BUFFER, colors[currentColor]);
 	      // And display it
 	      ST7789_writePixels(currentScreenBuffer, FRAMES_PER_ICON_BUFFER, LITTLE_ENDIAN);
 	    }
@@ -399,12 +406,6 @@ static void MX_GPIO_Init(void)
 
 /* USER CODE BEGIN 4 */
 
-// Delegate method for coloring a pixel in the current color
-uint16_t colorizePixel(uint16_t frame) {
-  uint16_t pixelColor = (frame == 0) ? 0 : colors[currentColor][frame - 1];
-  return (pixelColor);
-}
-
 /* USER CODE END 4 */
 
 /**
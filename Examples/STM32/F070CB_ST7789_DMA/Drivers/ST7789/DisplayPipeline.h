@@ -0,0 +1,446 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Decode/transfer pipeline of the display drivers: the pixel memory is split
+// into N buffers, the decoder fills one of them while the filled ones are
+// transferred to the display one after another. The next transfer is started
+// from the transfer-complete interrupt, so the CPU waits only when all
+// the buffers are filled (the bus is slower than the decoder)
+// and at the end of the stream (flush).
+//
+//     uint16_t * buffer = DisplayPipeline_getBuffer(&pipeline);  // waits for a free buffer
+//     ...decompress up to bufferPixels into the buffer...
+//     DisplayPipeline_submit(&pipeline, count);                   // queue it for the transfer
+//
+// The driver provides the transfer functions and calls DisplayPipeline_transferComplete()
+// (and DisplayPipeline_halfTransferComplete()) from the DMA interrupt callbacks.
+// Blocking transfers can be used too: the start function transfers the pixels
+// and calls DisplayPipeline_transferComplete() itself (no overlap then).
+//
+// With two buffers, a ring position and a seek function the pipeline can use
+// a single circular DMA transfer of both buffers for a stream of known length
+// (DisplayPipeline_begin()), the half-transfer and transfer-complete interrupts
+// free the halves. The DMA goes on into the other buffer before the interrupt
+// is handled, so the ring is kept only while the buffer it has moved to was full
+// before that and more than two buffers of the stream are left (the pixels taken
+// beyond that buffer until the next interrupt are still inside the stream).
+// Otherwise the DMA is stopped and the rest is transferred by the normal transfers.
+// If the DMA has reached a buffer not filled in time (the decoder is slower
+// than the bus), it has sent the old pixels of it: the window is set again
+// by the seek function from the first of them, and they are sent once more.
+// The interrupt latency must be shorter than the transfer of a buffer.
+//
+// A run of the pixels of one color (DisplayPipeline_submitRun()) takes a place
+// in the queue without filling the buffer: it is transferred from the fixed
+// source (the color) by the parts of maxTransfer pixels (the DMA counter limit),
+// the next part is started from the transfer-complete interrupt.
+
+// Includes
+#include <stdint.h>
+#include <stddef.h>
+
+
+#ifndef _DISPLAY_PIPELINE_
+#define _DISPLAY_PIPELINE_
+
+#define DISPLAY_PIPELINE_MAX_BUFFERS	4
+
+// Modes of the transfers
+#define DISPLAY_PIPELINE_CIRCULAR		0x01	// The ring of both buffers
+#define DISPLAY_PIPELINE_FIXED_SOURCE	0x02	// The same pixel "count" times (the run)
+
+// The queue is shared with the interrupts (can be redefined before this point).
+// The lock restores the interrupt mask of the caller (CMSIS of the HAL included before),
+// so the pipeline can also be called with the interrupts disabled.
+// Only one lock per block: it declares the saved mask.
+#ifndef DISPLAY_PIPELINE_LOCK
+#if defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+	#define DISPLAY_PIPELINE_LOCK()		uint32_t displayPipelinePrimask = __get_PRIMASK(); __disable_irq()
+	#define DISPLAY_PIPELINE_UNLOCK()	__set_PRIMASK(displayPipelinePrimask)
+#else
+	#define DISPLAY_PIPELINE_LOCK()
+	#define DISPLAY_PIPELINE_UNLOCK()
+#endif
+#endif
+
+// Body of the wait loops (e.g. __WFI(), or the event processing of a simulation)
+#ifndef DISPLAY_PIPELINE_IDLE
+#define DISPLAY_PIPELINE_IDLE()
+#endif
+
+
+// Starts the transfer of the pixels in the mode (DISPLAY_PIPELINE_... flags)
+typedef void (*DisplayPipelineStart)(uint16_t * pixels, uint16_t count, uint8_t mode);
+// Returns the number of the ring pixels taken by the DMA, stops the circular transfer if "stop" is set
+typedef uint16_t (*DisplayPipelinePosition)(uint8_t stop);
+// Sets the window of the stream again from the pixel "position" (the transfers are stopped),
+// returns the pixels it takes before it is set again (0 - the rest of the stream)
+typedef uint32_t (*DisplayPipelineSeek)(uint32_t position);
+
+typedef struct DisplayPipeline
+{
+	uint16_t * buffers;
+	uint16_t bufferPixels;
+	uint8_t buffersCount;
+	uint16_t maxTransfer;
+	DisplayPipelineStart start;
+	DisplayPipelinePosition position;
+	DisplayPipelineSeek seek;
+
+	uint16_t counts[DISPLAY_PIPELINE_MAX_BUFFERS];	// Pixels of the filled buffers (of the part of the run)
+	uint32_t runs[DISPLAY_PIPELINE_MAX_BUFFERS];	// Pixels of the runs left to start (0 - the buffer)
+	uint16_t colors[DISPLAY_PIPELINE_MAX_BUFFERS];	// Colors of the runs (the DMA source)
+	uint8_t writeIndex;								// Buffer of the decoder
+	volatile uint8_t readIndex;						// Buffer of the transfer
+	volatile uint8_t queued;						// Filled buffers (including the transferred one)
+	volatile uint8_t active;						// Transfer in progress
+	volatile uint8_t ring;							// Circular transfer in progress
+	volatile uint8_t late;							// The buffer was queued after the circular DMA had reached it
+	volatile uint8_t seekPending;					// The window is set again before the next transfer
+	volatile uint16_t skip;							// Pixels of the next buffer already sent
+	volatile uint32_t segment;						// Pixels left until the window is set again (0 - no limit)
+	volatile uint32_t streamPixels;					// Pixels left in the stream (0 - unknown)
+	volatile uint32_t streamPosition;				// Pixels of the stream transferred
+
+	// Statistics
+	uint32_t waits;									// The decoder waited for a free buffer
+	uint32_t underruns;								// The circular DMA sent the pixels not filled in time
+} DisplayPipeline;
+
+
+static inline void DisplayPipeline_transferComplete(DisplayPipeline * p);
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// The buffers are "count" consecutive parts of "bufferPixels" pixels of the memory.
+// The runs are split into the transfers of maxTransfer pixels.
+// No position or seek function - no circular transfers.
+static inline void DisplayPipeline_init(DisplayPipeline * p, uint16_t * buffers, uint16_t bufferPixels, uint8_t count, uint16_t maxTransfer,
+										DisplayPipelineStart start, DisplayPipelinePosition position, DisplayPipelineSeek seek)
+{
+	if (count > DISPLAY_PIPELINE_MAX_BUFFERS) count = DISPLAY_PIPELINE_MAX_BUFFERS;
+	p->buffers = buffers;
+	p->bufferPixels = bufferPixels;
+	p->buffersCount = count;
+	p->maxTransfer = maxTransfer;
+	p->start = start;
+	p->position = ((count == 2) && seek) ? position : NULL;
+	p->seek = seek;
+	p->writeIndex = 0;
+	p->readIndex = 0;
+	p->queued = 0;
+	p->active = 0;
+	p->ring = 0;
+	p->late = 0;
+	p->seekPending = 0;
+	p->skip = 0;
+	p->segment = 0;
+	p->streamPixels = 0;
+	p->streamPosition = 0;
+	p->waits = 0;
+	p->underruns = 0;
+}
+
+
+// The pixels of the stream are transferred
+static inline void DisplayPipeline_advance(DisplayPipeline * p, uint16_t count)
+{
+	p->streamPixels -= (p->streamPixels > count) ? count : p->streamPixels;
+	p->streamPosition += count;
+}
+
+
+// The transfer ends where the window has to be set again
+static inline uint16_t DisplayPipeline_limit(DisplayPipeline * p, uint16_t count)
+{
+	if (!p->segment) return (count);
+	if (count >= p->segment)
+	{
+		count = p->segment;
+		p->seekPending = 1;
+	}
+	p->segment -= count;
+	return (count);
+}
+
+
+// Starts the transfer of the buffer at the read index (the pipeline is marked active)
+static inline void DisplayPipeline_startNext(DisplayPipeline * p)
+{
+	uint8_t index = p->readIndex;
+	uint16_t skip = p->skip;
+	p->skip = 0;
+
+	// The beginning of the run could be sent from the buffer by the stopped circular DMA
+	if (p->runs[index] && skip)
+	{
+		if (skip > p->runs[index]) skip = p->runs[index];
+		p->runs[index] -= skip;
+		DisplayPipeline_advance(p, skip);
+		skip = 0;
+		if (!p->runs[index])
+		{
+			p->counts[index] = 0;
+			DisplayPipeline_transferComplete(p);
+			return;
+		}
+	}
+
+	// From the first pixel not sent yet
+	if (p->seekPending)
+	{
+		p->seekPending = 0;
+		p->segment = p->seek(p->streamPosition + skip);
+	}
+
+	// The next part of the run
+	if (p->runs[index])
+	{
+		uint16_t count = DisplayPipeline_limit(p, (p->runs[index] > p->maxTransfer) ? p->maxTransfer : p->runs[index]);
+		p->runs[index] -= count;
+		p->counts[index] = count;
+		p->start(&p->colors[index], count, DISPLAY_PIPELINE_FIXED_SOURCE);
+		return;
+	}
+
+	// Both buffers of the ring are full and it can be kept at its first interrupt
+	if (p->position && (index == 0) && (p->queued == 2) && !skip && !p->segment &&
+		(p->counts[0] == p->bufferPixels) && (p->counts[1] == p->bufferPixels) && (p->streamPixels > (uint32_t)p->bufferPixels * 3))
+	{
+		p->ring = 1;
+		p->start(p->buffers, p->bufferPixels << 1, DISPLAY_PIPELINE_CIRCULAR);
+		return;
+	}
+
+	// The rest of the buffer cut by the window goes after the seek
+	uint16_t count = DisplayPipeline_limit(p, p->counts[index] - skip);
+	if ((skip + count) < p->counts[index]) p->skip = skip + count;
+	p->start(&p->buffers[(uint32_t)index * p->bufferPixels + skip], count, 0);
+}
+
+
+// The circular transfer has moved to the next buffer. It goes on into the other one
+// after it, so it is stopped before a buffer not filled in time, a partial, run
+// or one of the last two buffers of the stream.
+static inline void DisplayPipeline_checkRing(DisplayPipeline * p)
+{
+	uint8_t index = p->readIndex;
+	if (p->queued && !p->late && !p->runs[index] && (p->counts[index] == p->bufferPixels) &&
+		(p->streamPixels > ((uint32_t)p->bufferPixels << 1))) return;
+
+	uint16_t taken = p->position(1);
+	uint16_t bufferStart = index ? p->bufferPixels : 0;
+	uint16_t skip = (taken > bufferStart) ? taken - bufferStart : 0;
+	p->ring = 0;
+
+	// The pixels the buffer had when the DMA reached it. If it was not filled in time,
+	// the decoder is slower than the bus, so the rest of the stream goes without the ring.
+	uint16_t valid = 0;
+	if (p->queued && !p->late)
+	{
+		if (!p->runs[index]) valid = p->counts[index];
+		else valid = (p->runs[index] > p->bufferPixels) ? p->bufferPixels : p->runs[index];
+	}
+	else p->streamPixels = 0;
+	p->late = 0;
+
+	// The rest was sent with the old content, the window is set again from it
+	if (skip > valid)
+	{
+		p->underruns++;
+		p->seekPending = 1;
+		skip = valid;
+	}
+
+	if (!p->queued)
+	{
+		p->active = 0;
+		return;
+	}
+	if (!p->runs[index] && (skip >= p->counts[index]))
+	{
+		DisplayPipeline_transferComplete(p);
+		return;
+	}
+	p->skip = skip;
+	DisplayPipeline_startNext(p);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Buffer for the decoder (the same one until it is submitted)
+static inline uint16_t * DisplayPipeline_getBuffer(DisplayPipeline * p)
+{
+	if (p->queued >= p->buffersCount)
+	{
+		p->waits++;
+		while (p->queued >= p->buffersCount) DISPLAY_PIPELINE_IDLE();
+	}
+	return (&p->buffers[(uint32_t)p->writeIndex * p->bufferPixels]);
+}
+
+
+// The buffer of the decoder without waiting (it may still be in the queue)
+static inline uint16_t * DisplayPipeline_currentBuffer(DisplayPipeline * p)
+{
+	return (&p->buffers[(uint32_t)p->writeIndex * p->bufferPixels]);
+}
+
+
+// Queue the buffer of the decoder (or the run) for the transfer
+static inline void DisplayPipeline_queue(DisplayPipeline * p, uint16_t count)
+{
+	uint8_t index = p->writeIndex;
+	uint8_t start = 0;
+	p->counts[index] = count;
+	if (++p->writeIndex == p->buffersCount) p->writeIndex = 0;
+
+	DISPLAY_PIPELINE_LOCK();
+	p->queued++;
+
+	// The circular DMA could reach the buffer before it was queued (the interrupt is late)
+	if (p->ring)
+	{
+		uint16_t taken = p->position(0);
+		uint16_t bufferStart = index ? p->bufferPixels : 0;
+		if ((taken > bufferStart) && (taken <= (bufferStart + p->bufferPixels))) p->late = 1;
+	}
+
+	if (!p->active)
+	{
+		// The circular transfer starts with both buffers filled
+		if (!(p->position && (p->queued == 1) && !p->skip && !p->seekPending && !p->segment && (index == 0) &&
+			(count == p->bufferPixels) && (p->streamPixels > (uint32_t)count * 3)))
+		{
+			p->active = 1;
+			start = 1;
+		}
+	}
+	DISPLAY_PIPELINE_UNLOCK();
+
+	if (start) DisplayPipeline_startNext(p);
+}
+
+
+// Queue the buffer of the decoder for the transfer
+static inline void DisplayPipeline_submit(DisplayPipeline * p, uint16_t count)
+{
+	p->runs[p->writeIndex] = 0;
+	DisplayPipeline_queue(p, count);
+}
+
+
+// Queue the run of "count" pixels of the color (in the byte order of the display)
+static inline void DisplayPipeline_submitRun(DisplayPipeline * p, uint16_t color, uint32_t count)
+{
+	if (!count) return;
+	uint16_t * buffer = DisplayPipeline_getBuffer(p);
+	uint8_t index = p->writeIndex;
+
+	// The circular DMA in progress could take the beginning of the buffer before it is stopped
+	if (p->ring)
+	{
+		uint16_t pixels = (count > p->bufferPixels) ? p->bufferPixels : count;
+		for (uint16_t i = 0; i < pixels; i++) buffer[i] = color;
+	}
+
+	p->colors[index] = color;
+	p->runs[index] = count;
+	DisplayPipeline_queue(p, 0);
+}
+
+
+// Transfer-complete interrupt (of the buffer, of the part of the run, or of the second half of the ring)
+static inline void DisplayPipeline_transferComplete(DisplayPipeline * p)
+{
+	uint8_t index = p->readIndex;
+
+	// The buffer is cut by the window
+	if (p->skip)
+	{
+		DisplayPipeline_startNext(p);
+		return;
+	}
+
+	DisplayPipeline_advance(p, p->counts[index]);
+	if (p->runs[index])
+	{
+		DisplayPipeline_startNext(p);
+		return;
+	}
+	if (++p->readIndex == p->buffersCount) p->readIndex = 0;
+	p->queued--;
+
+	if (p->ring) DisplayPipeline_checkRing(p);
+	else if (p->queued) DisplayPipeline_startNext(p);
+	else p->active = 0;
+}
+
+
+// Half-transfer interrupt (the first half of the ring, ignored for the normal transfers)
+static inline void DisplayPipeline_halfTransferComplete(DisplayPipeline * p)
+{
+	if (p->ring) DisplayPipeline_transferComplete(p);
+}
+
+
+// Transfer all the submitted buffers and wait for the end (the stream is finished).
+// The pixels written directly after it keep the position in the window only if
+// the circular DMA has not sent the old pixels (the seek is done by the next transfer).
+static inline void DisplayPipeline_flush(DisplayPipeline * p)
+{
+	uint8_t start = 0;
+
+	DISPLAY_PIPELINE_LOCK();
+	p->streamPixels = 0;
+	if (!p->active && p->queued)
+	{
+		p->active = 1;
+		start = 1;
+	}
+	DISPLAY_PIPELINE_UNLOCK();
+
+	if (start) DisplayPipeline_startNext(p);
+	while (p->active) DISPLAY_PIPELINE_IDLE();
+	p->skip = 0;
+}
+
+
+// Start of a stream of the known length (e.g. the address window),
+// the circular transfer is possible inside it
+static inline void DisplayPipeline_begin(DisplayPipeline * p, uint32_t pixels)
+{
+	DisplayPipeline_flush(p);
+	p->seekPending = 0;
+	p->segment = 0;
+	p->streamPixels = pixels;
+	p->streamPosition = 0;
+}
+
+
+#endif // end _DISPLAY_PIPELINE_
+
+// END-OF-FILE
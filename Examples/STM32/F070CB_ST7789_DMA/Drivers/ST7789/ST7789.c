@@ -35,15 +35,121 @@ uint8_t ST7789_xShift = 0;
 uint8_t ST7789_yShift = 0;
 
 #if defined (ST7789_USE_BUFFERING)
+	_Static_assert(ST7789_BUFFER_TOTAL_PIXELS <= 0xFFFF, "The pixel buffer size must fit into 16 bits");
+#if defined (ST7789_USE_STATIC_BUFFER)
+	static uint16_t ST7789_staticPixelBuffer[ST7789_BUFFER_TOTAL_PIXELS];
+	uint16_t * ST7789_pixelBuffer = ST7789_staticPixelBuffer;
+#else
 	uint16_t * ST7789_pixelBuffer = NULL;
-#if defined (ST7789_USE_DOUBLE_BUFFERING)
-	uint16_t ST7789_pixelBufferSize = ST7789_DISPLAY_WIDTH * ST7789_BUFFER_HEIGHT * 2;
-	uint16_t ST7789_pixelBufferHalfSize = ST7789_DISPLAY_WIDTH * ST7789_BUFFER_HEIGHT;
-	uint8_t ST7789_currentBufferIndex = 0;
+	uint8_t ST7789_isPixelBufferAllocated = 0;
+#endif
+	uint16_t ST7789_pixelBufferSize = ST7789_BUFFER_TOTAL_PIXELS;
+	DisplayPipeline ST7789_pipeline = { 0 };
+#endif
+#if defined(ST7789_USE_BUFFERING) && defined(ST7789_USE_DMA) && defined(ST7789_USE_CIRCULAR_DMA)
+	// The window of the stream (it is set again after an underrun of the circular DMA)
+	static struct { uint8_t x, y, width, height; } ST7789_window;
+	static void ST7789_writeWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+#endif
+
+// The size of the SPI transfer is in bytes, so a single DMA transfer is limited by 32767 pixels
+#define ST7789_MAX_TRANSFER_PIXELS	0x7FFF
+
+
+#if defined(ST7789_USE_DMA)
+// Circular mode and the memory increment of the SPI DMA
+// (they can be changed only with the channel disabled)
+static void ST7789_setDMAMode(uint8_t circular, uint8_t fixedSource) {
+	DMA_HandleTypeDef * hdma = ST7789_SPI_HANDLE.hdmatx;
+	uint32_t mode = circular ? DMA_CIRCULAR : DMA_NORMAL;
+	uint32_t increment = fixedSource ? DMA_MINC_DISABLE : DMA_MINC_ENABLE;
+	if ((hdma->Init.Mode != mode) || (hdma->Init.MemInc != increment)) {
+		WAIT_DMA;
+		__HAL_DMA_DISABLE(hdma);
+		hdma->Init.Mode = mode;
+		hdma->Init.MemInc = increment;
+		HAL_DMA_Init(hdma);
+	}
+}
+#endif
+
+
+#if defined (ST7789_USE_BUFFERING)
+
+// Transfer of a pipeline buffer or of a part of the run
+static void ST7789_startTransfer(uint16_t * pixels, uint16_t count, uint8_t mode) {
+#if defined(ST7789_USE_DMA)
+
+	ST7789_setDMAMode(mode & DISPLAY_PIPELINE_CIRCULAR, mode & DISPLAY_PIPELINE_FIXED_SOURCE);
+	WAIT_DMA;
+	HAL_SPI_Transmit_DMA(&ST7789_SPI_HANDLE, (uint8_t *)pixels, count << 1);
+
 #else
-	uint16_t ST7789_pixelBufferSize = ST7789_DISPLAY_WIDTH * ST7789_BUFFER_HEIGHT;
+	// Blocking transfer, the buffer is free at once
+	HAL_SPI_Transmit(&ST7789_SPI_HANDLE, (uint8_t *)pixels, count << 1, HAL_MAX_DELAY);
+	DisplayPipeline_transferComplete(&ST7789_pipeline);
+#endif
+}
+
+
+#if defined(ST7789_USE_DMA) && defined(ST7789_USE_CIRCULAR_DMA)
+// Position of the circular transfer (and its stop),
+// the pixels taken by the DMA will be sent anyway
+static uint16_t ST7789_ringPosition(uint8_t stop) {
+	if (stop) HAL_SPI_DMAStop(&ST7789_SPI_HANDLE);
+	return ((ST7789_pipeline.bufferPixels << 1) - __HAL_DMA_GET_COUNTER(ST7789_SPI_HANDLE.hdmatx));
+}
+
+
+// The window is set again from the pixel of the stream after the circular DMA
+// has sent the old pixels of a buffer. From the middle of a row only the rest of it can be set.
+static uint32_t ST7789_seekWindow(uint32_t position) {
+	uint8_t column = position % ST7789_window.width;
+	uint8_t row = (position / ST7789_window.width) % ST7789_window.height;
+
+	// The last pixels taken by the DMA are still being sent
+	while (__HAL_SPI_GET_FLAG(&ST7789_SPI_HANDLE, SPI_FLAG_BSY));
+	if (column) {
+		ST7789_writeWindow(ST7789_window.x + column, ST7789_window.y + row, ST7789_window.width - column, 1);
+		return (ST7789_window.width - column);
+	}
+	ST7789_writeWindow(ST7789_window.x, ST7789_window.y + row, ST7789_window.width, ST7789_window.height - row);
+	return (0);
+}
+#else
+	#define ST7789_ringPosition		NULL
+	#define ST7789_seekWindow		NULL
+#endif
+
+
+static void ST7789_initPipeline() {
+	DisplayPipeline_init(&ST7789_pipeline, ST7789_pixelBuffer, ST7789_pixelBufferSize / ST7789_BUFFERS_COUNT, ST7789_BUFFERS_COUNT,
+		ST7789_MAX_TRANSFER_PIXELS, ST7789_startTransfer, ST7789_ringPosition, ST7789_seekWindow);
+}
+
+
+#if defined(ST7789_USE_DMA)
+// DMA interrupts of the SPI (only the transfers of the pipeline are handled)
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef * hspi) {
+	if ((hspi == &ST7789_SPI_HANDLE) && ST7789_pipeline.active) DisplayPipeline_transferComplete(&ST7789_pipeline);
+}
+
+
+void HAL_SPI_TxHalfCpltCallback(SPI_HandleTypeDef * hspi) {
+	if ((hspi == &ST7789_SPI_HANDLE) && ST7789_pipeline.active) DisplayPipeline_halfTransferComplete(&ST7789_pipeline);
+}
+#endif
+
 #endif
+
+
+// Wait for the end of all the transfers
+static void ST7789_flush() {
+#if defined(ST7789_USE_BUFFERING)
+	DisplayPipeline_flush(&ST7789_pipeline);
 #endif
+	WAIT_DMA;
+}
 
 
 
@@ -106,7 +212,7 @@ void ST7789_initWithParams(uint8_t rotation, uint8_t littleEndian) {
 	ST7789_writeCommand(ST7789_NORON);
 	// Clear screen
 	ST7789_fillColor(0);
-	WAIT_DMA;
+	ST7789_flush();
 	// Display On
 	ST7789_writeCommand(ST7789_DISPON);
 
@@ -116,10 +222,15 @@ void ST7789_initWithParams(uint8_t rotation, uint8_t littleEndian) {
 
 // Select the display and allocate buffer
 void ST7789_begin() {
-#if defined(ST7789_USE_BUFFERING)
+#if defined(ST7789_USE_BUFFERING) && !defined(ST7789_USE_STATIC_BUFFER)
 	if (ST7789_pixelBuffer == NULL) {
 		ST7789_pixelBuffer = (uint16_t *)malloc(ST7789_pixelBufferSize << 1);
+		ST7789_isPixelBufferAllocated = 1;
+		ST7789_pipeline.buffers = NULL;
 	}
+#endif
+#if defined(ST7789_USE_BUFFERING)
+	if (ST7789_pipeline.buffers == NULL) ST7789_initPipeline();
 #endif
 	ST7789_selectDisplay(1);
 }
@@ -127,33 +238,41 @@ void ST7789_begin() {
 
 // Deselect the display and free the buffer
 void ST7789_end() {
-	WAIT_DMA;
+	ST7789_flush();
 	ST7789_selectDisplay(0);
-#if defined(ST7789_USE_BUFFERING) && defined(ST7789_RELEASE_BUFFER_AT_END)
-	if (ST7789_pixelBuffer) {
+#if defined(ST7789_USE_BUFFERING) && defined(ST7789_RELEASE_BUFFER_AT_END) && !defined(ST7789_USE_STATIC_BUFFER)
+	// Only the buffer allocated by the module (not the one provided by the caller)
+	if (ST7789_isPixelBufferAllocated) {
 		free(ST7789_pixelBuffer);
 		ST7789_pixelBuffer = NULL;
+		ST7789_isPixelBufferAllocated = 0;
+		ST7789_pipeline.buffers = NULL;
 	}
 #endif
 }
 
 
-// Get current buffer
+// Get current buffer (waits until one of the buffers is free)
 #if defined (ST7789_USE_BUFFERING)
 
 uint16_t * ST7789_getPixelBuffer() {
+	return (DisplayPipeline_getBuffer(&ST7789_pipeline));
+}
 
-#if defined(ST7789_USE_DOUBLE_BUFFERING)
-	if (ST7789_currentBufferIndex) {
-		return (&ST7789_pixelBuffer[ST7789_pixelBufferHalfSize]);
-	} else {
-		return (ST7789_pixelBuffer);
-	}
-#else
-
-	return (ST7789_pixelBuffer);
 
+// Use the caller's buffer (static or arena) instead of the heap one.
+// The size is in pixels and covers all the buffers of the pipeline.
+void ST7789_setPixelBuffer(uint16_t * buffer, uint16_t size) {
+	ST7789_flush();
+#if !defined(ST7789_USE_STATIC_BUFFER)
+	if (ST7789_isPixelBufferAllocated) {
+		free(ST7789_pixelBuffer);
+		ST7789_isPixelBufferAllocated = 0;
+	}
 #endif
+	ST7789_pixelBuffer = buffer;
+	ST7789_pixelBufferSize = size;
+	ST7789_initPipeline();
 }
 #endif
 
@@ -167,10 +286,8 @@ void ST7789_setRotation(uint8_t rotation) {
 }
 
 
-// Set target window
-void ST7789_setWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
-	WAIT_DMA;
-
+// Address window and the start of the memory write
+static void ST7789_writeWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
 	uint16_t address;
 	// Column Address set
 	ST7789_writeCommand(ST7789_CASET);
@@ -194,6 +311,24 @@ void ST7789_setWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
 }
 
 
+// Set target window
+void ST7789_setWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
+	ST7789_flush();
+	ST7789_writeWindow(x, y, width, height);
+
+#if defined(ST7789_USE_BUFFERING) && defined(ST7789_USE_DMA) && defined(ST7789_USE_CIRCULAR_DMA)
+	ST7789_window.x = x;
+	ST7789_window.y = y;
+	ST7789_window.width = width;
+	ST7789_window.height = height;
+#endif
+#if defined(ST7789_USE_BUFFERING)
+	// The pixels of the window are a stream of the known length
+	DisplayPipeline_begin(&ST7789_pipeline, (uint32_t)width * height);
+#endif
+}
+
+
 // Fill screen with solid color
 void ST7789_fillColor(uint16_t color) {
 	ST7789_setWindow(0, 0, ST7789_DISPLAY_WIDTH, ST7789_DISPLAY_HEIGHT);
@@ -201,25 +336,43 @@ void ST7789_fillColor(uint16_t color) {
 }
 
 
-// Fill configured window with pixels
+// Fill configured window with pixels (a run of one color).
+// With DMA the run is transferred from the fixed source without filling
+// the buffer, and with buffering it is only queued (the next pixels
+// of the window can be decoded meanwhile).
 void ST7789_fillPixels(uint16_t color, uint16_t count) {
 	// Prepare color in the required endianness
 	if (!isDisplayLE) color = __builtin_bswap16(color);
 
-#if defined(ST7789_USE_BUFFERING)	
-	// Prepare buffer
-	uint16_t usedBufferPixels = (count > ST7789_pixelBufferSize) ? ST7789_pixelBufferSize : count;
-	for (uint16_t i = 0; i < usedBufferPixels; i++) ST7789_pixelBuffer[i] = color;
+#if defined(ST7789_USE_BUFFERING) && defined(ST7789_USE_DMA)
+	DisplayPipeline_submitRun(&ST7789_pipeline, color, count);
 
-	while (count) {
+#elif defined(ST7789_USE_BUFFERING)
+	// Every buffer of the pipeline is prepared once
+	uint8_t preparedBuffers = 0;
 
-#if defined(ST7789_USE_DOUBLE_BUFFERING)
-		uint16_t pixelsToFill = (count > ST7789_pixelBufferHalfSize) ? ST7789_pixelBufferHalfSize : count;
-#else
-		uint16_t pixelsToFill = (count > ST7789_pixelBufferSize) ? ST7789_pixelBufferSize : count;
-#endif
+	while (count) {
+		uint16_t * buffer = DisplayPipeline_getBuffer(&ST7789_pipeline);
+		uint16_t pixelsToFill = (count > ST7789_pipeline.bufferPixels) ? ST7789_pipeline.bufferPixels : count;
+		if (preparedBuffers < ST7789_pipeline.buffersCount) {
+			for (uint16_t i = 0; i < pixelsToFill; i++) buffer[i] = color;
+			preparedBuffers++;
+		}
+
+		DisplayPipeline_submit(&ST7789_pipeline, pixelsToFill);
+		count -= pixelsToFill;
+	}
 
-		ST7789_writePixels(ST7789_getPixelBuffer(), pixelsToFill, isDisplayLE);
+#elif defined(ST7789_USE_DMA)
+	// The chain of the DMA transfers from the fixed source
+	static uint16_t fillColor;
+	WAIT_DMA;
+	fillColor = color;
+	ST7789_setDMAMode(0, 1);
+	while (count) {
+		uint16_t pixelsToFill = (count > ST7789_MAX_TRANSFER_PIXELS) ? ST7789_MAX_TRANSFER_PIXELS : count;
+		WAIT_DMA;
+		HAL_SPI_Transmit_DMA(&ST7789_SPI_HANDLE, (uint8_t *)&fillColor, pixelsToFill << 1);
 		count -= pixelsToFill;
 	}
 
@@ -234,6 +387,7 @@ void ST7789_fillPixels(uint16_t color, uint16_t count) {
 
 // Write next pixel
 void ST7789_writePixel(uint16_t color) {
+	ST7789_flush();
 	if (isDisplayLE) color = __builtin_bswap16(color);
 	ST7789_writeBigEndianWord(color);
 }
@@ -244,15 +398,21 @@ void ST7789_writePixels(uint16_t * pixels, uint16_t count, uint8_t littleEndian)
 	// If display is the same endianness as our data
 	// then we can use DMA
 	if (isDisplayLE == littleEndian) {
+#if defined(ST7789_USE_BUFFERING)
+		// The buffer of the pipeline is queued for the transfer
+		if (pixels == DisplayPipeline_currentBuffer(&ST7789_pipeline)) {
+			DisplayPipeline_submit(&ST7789_pipeline, count);
+			return;
+		}
+		ST7789_flush();
+#endif
+
 #if defined(ST7789_USE_DMA)
 
+		ST7789_setDMAMode(0, 0);
 		WAIT_DMA;
 		HAL_SPI_Transmit_DMA(&ST7789_SPI_HANDLE, (uint8_t *)pixels, count << 1);
 
-#if defined(ST7789_USE_BUFFERING) && defined(ST7789_USE_DOUBLE_BUFFERING)
-		ST7789_currentBufferIndex = !ST7789_currentBufferIndex;
-#endif
-
 #else
 		// Or just transmit the data
 		ST7789_writeData((uint8_t *)pixels, count << 1);
@@ -263,6 +423,7 @@ void ST7789_writePixels(uint16_t * pixels, uint16_t count, uint8_t littleEndian)
 	// Else we have to make sure that the endianness is correct for every pixel
 	else
 	{
+		ST7789_flush();
 		for(uint16_t i = 0; i < count; i++) ST7789_writeBigEndianWord(pixels[i]);
 	}
 }
@@ -28,7 +28,7 @@ SOFTWARE.
 // or individual pixels on a display based on the ST7789 controller.
 // It is designed only for use with 240x240 pixel displays.
 // Some extra modifications required for other displays.
-// Also it supports DMA and double buffering.
+// Also it supports DMA and the decode/transfer pipeline of several buffers.
 
 // ATTENTION! For the normal operation of DMA and buffering,
 // it is necessary that the display byte order corresponds
@@ -37,6 +37,7 @@ SOFTWARE.
 // Includes
 #include <stdint.h>
 #include "stm32f0xx_hal.h"
+#include "DisplayPipeline.h"
 
 
 #ifndef _ST7789_
@@ -58,7 +59,9 @@ SOFTWARE.
 // The name of external SPI_HandleTypeDef variable (defined in "main.c")
 #define ST7789_SPI_HANDLE			hspi1
 
-// If you plan to use DMA, declare this symbol
+// If you plan to use DMA, declare this symbol.
+// The runs of one color (fillPixels) are transferred from a fixed source address then
+// (the memory increment of the DMA channel is switched by HAL_DMA_Init()).
 #define ST7789_USE_DMA
 
 // You can shift the responsibility for the buffer to this module.
@@ -66,22 +69,39 @@ SOFTWARE.
 // the painting of rectangular areas in one color.
 #define ST7789_USE_BUFFERING
 
-// Double buffering can be used together with DMA.
-// One of the buffers is transferring to the display,
-// while the second one is rendering. Then they are swapped.
-//#define ST7789_USE_DOUBLE_BUFFERING
+// The buffer is split into this number of buffers (1-4). With DMA
+// the filled ones are transferring to the display one after another,
+// while the next one is rendering (see DisplayPipeline.h).
+// The module implements HAL_SPI_TxCpltCallback() and HAL_SPI_TxHalfCpltCallback()
+// for that (the DMA interrupt of the SPI must be enabled).
+#define ST7789_BUFFERS_COUNT		2
+
+// With two buffers the pixels of a window can be transferred by a single
+// circular DMA transfer (its mode is switched by HAL_DMA_Init()).
+// If a buffer is not filled in time, the window is set again
+// from its first pixel, and the pixels are sent once more.
+//#define ST7789_USE_CIRCULAR_DMA
 
 // You can free the buffer during the "end()" call to avoid
 // wasting RAM when no display operations are performed.
 //#define ST7789_RELEASE_BUFFER_AT_END
 
-// The buffer size in pixels will be defined as
+// Or you can avoid the heap altogether: the buffer will be allocated
+// statically, so the RAM footprint is known at compile time.
+// Also in any mode you can provide your own buffer by ST7789_SET_PIXEL_BUFFER().
+#define ST7789_USE_STATIC_BUFFER
+
+// The size of a single buffer in pixels will be defined as
 // the display width multiplied by this number.
 // Also you can change the buffer size as you want,
-// changing ST7789_pixelBufferSize / ST7789_pixelBufferHalfSize
-// variables outside of the begin() / end() calls.
+// changing ST7789_pixelBufferSize (all the buffers)
+// variable outside of the begin() / end() calls.
 #define ST7789_BUFFER_HEIGHT		2
 
+// Maximum size of a single buffer and of the whole buffering memory in pixels
+#define ST7789_BUFFER_PIXELS		(ST7789_DISPLAY_WIDTH * ST7789_BUFFER_HEIGHT)
+#define ST7789_BUFFER_TOTAL_PIXELS	(ST7789_BUFFER_PIXELS * ST7789_BUFFERS_COUNT)
+
 // Ports/pins (you can include the "main.h" file and use the symbols defined in it.
 #define ST7789_RST_PORT				GPIOA
 #define ST7789_RST_PIN				GPIO_PIN_4
@@ -143,11 +163,15 @@ extern SPI_HandleTypeDef ST7789_SPI_HANDLE;
 #endif
 
 #if defined (ST7789_USE_BUFFERING)
-	extern uint16_t * pixelBuffer;
-	extern uint16_t pixelBufferSize;
-#if defined (ST7789_USE_DOUBLE_BUFFERING)
-	extern uint16_t pixelBufferHalfSize;
-#endif
+	extern uint16_t * ST7789_pixelBuffer;
+	extern uint16_t ST7789_pixelBufferSize;
+	extern DisplayPipeline ST7789_pipeline;
+
+// Use the caller's static array as the pixel buffer (its size is checked at compile time)
+#define ST7789_SET_PIXEL_BUFFER(buffer) do { \
+	_Static_assert(sizeof(buffer) >= ST7789_BUFFER_TOTAL_PIXELS * sizeof(uint16_t), "The pixel buffer is too small"); \
+	ST7789_setPixelBuffer((buffer), sizeof(buffer) / sizeof(uint16_t)); \
+} while (0)
 #endif
 
 void ST7789_init();
@@ -158,6 +182,7 @@ void ST7789_end();
 
 #if defined (ST7789_USE_BUFFERING)
 	uint16_t * ST7789_getPixelBuffer();
+	void ST7789_setPixelBuffer(uint16_t * buffer, uint16_t size);
 #endif
 
 void ST7789_setRotation(uint8_t rotation);
@@ -89,6 +89,14 @@ Examples:
 	/AVR/Arduino_boards/Nano_ST7789_Tiny (Arduino Nano + ST7789 240x240 display),
 	/AVR/ATtiny85 (ATtiny85 chip + SPI output).
 
+All the modifications are configurations of the same decompression template (DeltaDecoder.h),
+so copy DeltaDecoder.h and DecompressionSinks.h from /Decompression along with them.
+
+The decoder reads the compressed data by words of up to 4 bytes, so the last read may go
+up to 3 bytes beyond the end of the data. The compressor appends
+DECOMPRESSION_DATA_PADDING (3) zero bytes to every exported data array,
+so if you prepare the data in some other way, then append them too.
+
 * Relevant only for the AVR platform.
 ** To do this, a pointer to an array of far pointers should be passed 
 to the decompression procedure instead of a direct pointer to a data array:
@@ -139,11 +147,8 @@ Sprint 3 - https://www.patreon.com/posts/delta-encoding-3-108236064
 
 // The maximum number of channels in the data that you will decompress
 #define DECOMPRESSION_MAX_NUMBER_OF_CHANNELS    3
-
 // Uncomment if you have data splitted into squares among those you will decompress
 #define DECOMPRESSION_USE_SQUARES
-
-
 ////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////
@@ -164,11 +169,24 @@ typedef struct
 #endif
 } DecompressionContext;
 
+// Display driver for decompressNextFramesToDisplay()
+typedef struct
+{
+	uint16_t * (*getBuffer)(uint16_t * size);				// Free buffer of the driver (its size in pixels)
+	void (*writePixels)(uint16_t * pixels, uint16_t count);	// Filled part of the buffer
+	void (*fillPixels)(uint16_t color, uint32_t count);		// Run of the color (e.g. the DMA fill)
+	uint16_t runThreshold;									// Shorter runs go to the buffer (0 - default)
+} DecompressionDisplay;
+
 
 ////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 // In the case of decompression images divided into squares, 
 // set this variable to the width of your decompression buffer in pixels.
 extern uint16_t decompressionBufferWidth;
@@ -176,6 +194,19 @@ extern uint16_t decompressionBufferWidth;
 
 void resetDecompression();
 void decompressNextFrames(DecompressionContext * dc, uint8_t * compressedData, uint16_t * decompressedData, uint16_t framesCount, bool colorize);
+void decompressNextFramesWithPalette(DecompressionContext * dc, uint8_t * compressedData, uint16_t * decompressedData, uint16_t framesCount, const uint16_t * palette);
+void skipNextFrames(DecompressionContext * dc, uint8_t * compressedData, uint32_t framesCount);
+void decompressRegion(DecompressionContext * dc, uint8_t * compressedData, uint16_t * decompressedData, uint16_t imageWidth, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+void decompressNextFramesToDisplay(DecompressionContext * dc, uint8_t * compressedData, const DecompressionDisplay * display, uint16_t framesCount);
+
+// Delegate methods declaration
+void frameDecompressed(uint16_t frame);
+void frameRunDecompressed(uint16_t frame, uint16_t count);
+uint16_t colorizePixel(uint16_t frame);
+
+#ifdef __cplusplus
+}
+#endif
 
 
 #endif // end _DELTA_DECOMPRESSION_
@@ -3174,6 +3174,6 @@ static const uint8_t slide1Data[] = {
 	0x52, 0xF5, 0x5D, 0x7A, 0xDA, 0xD6, 0xB5, 0x5D, 0x3B, 0x56, 0xCA, 0xF2, 0xA5, 0x29, 0x17, 0x34, 0x10, 0xE4, 0xAE, 0x99, 0x95, 0xFD, 0x55, 0xA6, 0xBA, 0x65, 0x56, 0xF9, 0x6A, 0x9A, 0xA9, 0x80, 0x11, 0x04, 0x43, 0xF6, 0x55, 0x79, 0x4D, 0xC2, 0x01, 0x00, 0x95, 0xAA, 0xE7, 0xA9, 0xAA, 0x18, 0x08, 0x42, 0x01, 0x6D, 0x80, 0x42, 0x20, 0x8C, 0x45, 0x01, 0x41, 0xDF, 0xFF, 0x32, 0x88, 0x5C, 0x36, 0x1B, 0x56, 0xFC, 0x84, 0x40, 0x10, 0x85, 0x54, 0x45, 0x17, 0x7F, 0xF3, 0x89, 0x04, 0x20, 0x10, 0x05, 0x99, 0xDC, 0xC4, 0x18, 0x88, 0x6D, 0x1A, 0xDF, 0xD7, 0xD4, 0x42, 0xE4, 0x71, 0x22, 0xE2, 0x4B, 0x5B, 0x2E, 
 	0xB2, 0xB9, 0xB4, 0x4F, 0x12, 0x31, 0x8D, 0x03, 0xBD, 0x79, 0x41, 0xE2, 0x65, 0x95, 0xEF, 0x59, 0x1E, 0xF5, 0x91, 0x6F, 0x56, 0x54, 0xBD, 0x65, 0x4B, 0x49, 0x92, 0xB4, 0x99, 0x2A, 0x2A, 0x0F, 0x18, 0x3D, 0x8C, 0x29, 0xA6, 0xE9, 0x58, 0xBA, 0x1A, 0x83, 0xE1, 0xA9, 0x3A, 0x96, 0x20, 0x04, 0x02, 0xAE, 0xF9, 0x82, 0x20, 0x80, 0x7F, 0xFF, 0xF9, 0xE1, 0xE7, 0xE7, 0xFE, 0x01, 0x80, 0x08, 0x82, 0x21, 0xEE, 0xFA, 0xBA, 0xF0, 0xE2, 0xA0, 0x13, 0x02, 0x80, 0x58, 0x06, 0x94, 0xEC, 0xE9, 0x4F, 0x7D, 0xAD, 0xC4, 0x4C, 0x22, 0x30, 0x4F, 0xE9, 0xFC, 0x9F, 0x81, 0x04, 0x93, 0xD7, 0x34, 0x08, 0x01, 0x6A, 0xEA, 
 	0x6A, 0xEF, 0x5E, 0xB5, 0xA6, 0x55, 0xE5, 0x65, 0x95, 0x55, 0x55, 0x51, 0x0F, 0xB0, 0x00, 0x10, 0x08, 0x00, 0x67, 0xEF, 0xFF, 0x30, 0x40, 0x10, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0x20, 0x16, 0xB0, 0x40, 0x10, 0x0F, 0xE8, 0x3E, 0x00, 0x70, 0x58, 0x2E, 0xA2, 0x01, 0x20, 0x01, 0x01, 0x15, 0xFF, 0xED, 0x80, 0x00, 0xB0, 0x05, 0x57, 0x5F, 0x5F, 0xFF, 0xFF, 0xFF, 0xFB, 0x04, 0x01, 0x00, 0xF2, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x02, 0x10, 0xD1, 0x55, 0x73, 0xFF, 0xFF, 0x55, 0x75, 0x54, 0x98, 0x00, 0x41, 0x10, 0xFF, 0xFC, 0x68, 0x00, 0x01, 0xE8, 0x00, 0x00, 0x80, 0x52, 0x00, 0x70, 0x18, 0x3E, 0x18, 
-	0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xC0, 0x60, 0x00, 0x00, 0x8B, 0x9B, 0xFA, 0xFF, 0xFF, 0xFF, 0x98, 0x00, 0x08, 0x04, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x40, 0x10, 0x0E, 0x80, 0x20, 0x08, 0x05, 0x6C, 0x00, 0x04, 0x03, 0xA0, 0x14, 0x00, 0x70, 0x58, 0x27, 0xAA, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00};
+	0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xC0, 0x60, 0x00, 0x00, 0x8B, 0x9B, 0xFA, 0xFF, 0xFF, 0xFF, 0x98, 0x00, 0x08, 0x04, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x40, 0x10, 0x0E, 0x80, 0x20, 0x08, 0x05, 0x6C, 0x00, 0x04, 0x03, 0xA0, 0x14, 0x00, 0x70, 0x58, 0x27, 0xAA, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
 // END-OF-FILE
@@ -2556,6 +2556,6 @@ static const uint8_t slide2Data[] = {
 	0xC6, 0x1B, 0x92, 0xA6, 0xA8, 0x80, 0x46, 0xA4, 0x4B, 0x75, 0xB3, 0xB9, 0x86, 0xEF, 0x22, 0x72, 0xD1, 0x00, 0x0D, 0x12, 0xBB, 0x09, 0x3A, 0x20, 0x9A, 0x14, 0x8C, 0xE8, 0x92, 0x69, 0x41, 0x00, 0x00, 0x1A, 0x0E, 0x89, 0x46, 0x00, 0x10, 0x04, 0xE4, 0x99, 0x9A, 0x5A, 0x09, 0x3A, 0x2D, 0x1F, 0xC0, 0xA1, 0x39, 0x30, 0xA0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x82, 0x09, 0x81, 0x00, 0x08, 0xED, 0xE1, 0x08, 0xD0, 0x90, 0x45, 0x56, 0xA9, 0x92, 0x14, 0x23, 0xCA, 0x82, 0xB4, 0x3C, 0x41, 0x49, 0x20, 0xC3, 0x48, 0xD1, 0x0F, 0x6A, 0x95, 0x52, 0x22, 0x41, 0x2A, 0x00, 0x2E, 0x52, 0x90, 0x2A, 0x2D, 
 	0x03, 0x00, 0x20, 0x02, 0x22, 0x33, 0x33, 0x22, 0x55, 0x2D, 0x25, 0x70, 0x51, 0x48, 0x2C, 0x10, 0x03, 0x12, 0x5A, 0x49, 0x60, 0x12, 0x29, 0x53, 0x36, 0x97, 0x75, 0x5E, 0xFF, 0xFB, 0xAF, 0x5D, 0xCD, 0xD1, 0xC7, 0x12, 0x86, 0x5C, 0x6E, 0x92, 0xA0, 0x40, 0x08, 0x00, 0x00, 0x84, 0xA4, 0x99, 0x6E, 0x9C, 0x39, 0x33, 0xF5, 0x95, 0x0A, 0xA6, 0xA9, 0x36, 0x05, 0x6B, 0x7A, 0xFC, 0x4A, 0x6E, 0x75, 0x5F, 0x60, 0x29, 0x31, 0x4D, 0x48, 0x68, 0x0A, 0x01, 0x1F, 0xE7, 0xF9, 0xCA, 0x52, 0x52, 0x79, 0xA1, 0x90, 0xCF, 0xFF, 0xED, 0xA4, 0x10, 0x28, 0x90, 0xAA, 0xA6, 0x43, 0x34, 0x05, 0x5B, 0xB6, 0x3C, 0x58, 0x64, 
 	0x89, 0x05, 0x18, 0xAC, 0x9A, 0x35, 0x3F, 0xB3, 0xFB, 0x3F, 0xB7, 0xFB, 0x3F, 0xB7, 0xEE, 0xDA, 0x8E, 0xD5, 0xD1, 0x88, 0xEE, 0x2A, 0x21, 0x3F, 0xC7, 0x51, 0x62, 0x10, 0x81, 0x99, 0x08, 0x4C, 0xB0, 0x0C, 0x24, 0x21, 0x32, 0x0C, 0x53, 0x13, 0x08, 0x99, 0xEB, 0xBC, 0x44, 0xC4, 0x27, 0x78, 0x30, 0xF6, 0xA6, 0xDA, 0x86, 0xDF, 0xFE, 0xBC, 0x93, 0x74, 0x93, 0x73, 0x4B, 0x2B, 0x4B, 0x2A, 0x2A, 0x2A, 0x2A, 0x0A, 0x02, 0x42, 0xC3, 0x62, 0x08, 0x2A, 0x4B, 0x97, 0xFF, 0xA7, 0xA2, 0x12, 0x11, 0x02, 0x4A, 0xC1, 0xD4, 0x19, 0x41, 0x54, 0xB4, 0x72, 0x7E, 0x10, 0x54, 0x0D, 0xFF, 0x1F, 0xE8, 0x00, 0x71, 0x38, 
-	0x50, 0x37, 0xFD, 0x03, 0xC1, 0xC2, 0x61, 0xA8, 0x07, 0x09, 0x96, 0x78, 0x3E, 0x0E, 0x13, 0x0C, 0xD1, 0x31, 0x48, 0x32, 0xEA, 0xA0, 0x0C, 0x30, 0x0F, 0x0C, 0x3D, 0x83, 0x04, 0x83, 0x30, 0x0C, 0x52, 0x0C, 0xFF, 0xEF, 0xFF, 0xFC, 0x18, 0x26, 0x19, 0x70, 0x62, 0x90, 0x62, 0x00, 0x00, 0x01, 0xC9, 0x92, 0x45, 0x94, 0x15, 0x7B, 0x7B, 0xA1, 0x27, 0x2A, 0x06, 0xE5, 0x02, 0x02, 0xA1, 0xA0};
+	0x50, 0x37, 0xFD, 0x03, 0xC1, 0xC2, 0x61, 0xA8, 0x07, 0x09, 0x96, 0x78, 0x3E, 0x0E, 0x13, 0x0C, 0xD1, 0x31, 0x48, 0x32, 0xEA, 0xA0, 0x0C, 0x30, 0x0F, 0x0C, 0x3D, 0x83, 0x04, 0x83, 0x30, 0x0C, 0x52, 0x0C, 0xFF, 0xEF, 0xFF, 0xFC, 0x18, 0x26, 0x19, 0x70, 0x62, 0x90, 0x62, 0x00, 0x00, 0x01, 0xC9, 0x92, 0x45, 0x94, 0x15, 0x7B, 0x7B, 0xA1, 0x27, 0x2A, 0x06, 0xE5, 0x02, 0x02, 0xA1, 0xA0, 0x00, 0x00, 0x00};
 
 // END-OF-FILE
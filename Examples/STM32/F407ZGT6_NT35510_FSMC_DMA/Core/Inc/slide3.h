@@ -2675,6 +2675,6 @@ static const uint8_t slide3Data[] = {
 	0x94, 0x17, 0x8A, 0xA2, 0x40, 0x58, 0x6D, 0xA4, 0xFA, 0x5F, 0x25, 0x24, 0x88, 0xBC, 0x5D, 0x51, 0x1E, 0xDF, 0xE6, 0xEE, 0xFE, 0xDE, 0xB6, 0xEA, 0xAE, 0xC9, 0x19, 0x0A, 0x40, 0x35, 0xE7, 0xAE, 0x09, 0xA8, 0x09, 0x00, 0xE5, 0x46, 0x82, 0x88, 0x0D, 0x05, 0x00, 0xA0, 0xA2, 0xAB, 0xD4, 0x1A, 0xC2, 0x42, 0x35, 0x13, 0x35, 0x13, 0xF5, 0x33, 0x7E, 0xF7, 0xF7, 0x37, 0x76, 0x50, 0xB0, 0xAA, 0x04, 0x00, 0x5F, 0xFF, 0xFF, 0xE9, 0x98, 0xC4, 0x2A, 0x24, 0x6A, 0xA6, 0x9B, 0x69, 0x15, 0xDA, 0xEB, 0xB6, 0x95, 0x45, 0x74, 0x49, 0x25, 0xB2, 0x4A, 0x39, 0x63, 0x92, 0x38, 0x83, 0x54, 0x52, 0x11, 0xEF, 0xFD, 0xBD, 
 	0xF6, 0xDB, 0x6D, 0x8A, 0x84, 0xE1, 0x20, 0x1D, 0x53, 0x54, 0xF3, 0x55, 0x52, 0x53, 0xD2, 0x0F, 0x01, 0xBC, 0xF5, 0x55, 0x4F, 0x3D, 0x20, 0xF5, 0x03, 0x84, 0x69, 0x26, 0xB2, 0xEB, 0x7D, 0xEE, 0xF0, 0xC3, 0x2E, 0x78, 0x11, 0xA4, 0xDA, 0x73, 0x84, 0x77, 0xFF, 0xDB, 0xBD, 0xAA, 0xDB, 0x2D, 0xAC, 0x7B, 0x09, 0x60, 0x3B, 0xB6, 0xBB, 0x6B, 0xEE, 0xBB, 0x64, 0x92, 0x29, 0x24, 0x92, 0x49, 0x2D, 0xB6, 0xF7, 0x7D, 0xB6, 0xB3, 0x34, 0x93, 0x5C, 0x6E, 0xEC, 0xF5, 0x5F, 0xBD, 0x8E, 0xFD, 0x7D, 0xFE, 0xBE, 0xEF, 0xB7, 0xCB, 0xE5, 0xF2, 0xF8, 0xF3, 0xF0, 0xDD, 0x99, 0x13, 0x28, 0x43, 0x72, 0x37, 0x44, 0xA2, 
 	0x4F, 0x29, 0x41, 0xA2, 0x40, 0x09, 0x00, 0x80, 0x00, 0x00, 0x00, 0x59, 0xA2, 0x38, 0x08, 0xD4, 0x0C, 0x01, 0xC4, 0x3F, 0xCC, 0xCC, 0xCD, 0xCC, 0xDD, 0x21, 0x58, 0x0E, 0x21, 0x0D, 0x45, 0x15, 0x14, 0x04, 0x70, 0x58, 0x8C, 0x01, 0x60, 0x00, 0x14, 0x03, 0x00, 0x63, 0x65, 0x80, 0xC0, 0x17, 0xFF, 0xFF, 0x7F, 0xFE, 0x70, 0x24, 0x45, 0x00, 0xB6, 0x80, 0x8C, 0x10, 0x02, 0x80, 0x5B, 0x64, 0x08, 0x80, 0x16, 0xDF, 0xD7, 0x57, 0x55, 0x57, 0x55, 0x4B, 0x09, 0x80, 0x40, 0x0A, 0x00, 0x00, 0x0F, 0xC0, 0xC0, 0x20, 0x07, 0x86, 0x38, 0x08, 0x01, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0x7D, 0x8C, 0x02, 0x00, 
-	0x5F, 0xFF, 0xFF, 0xFF, 0x8C, 0x05, 0x10, 0xC0, 0x2C, 0x80};
+	0x5F, 0xFF, 0xFF, 0xFF, 0x8C, 0x05, 0x10, 0xC0, 0x2C, 0x80, 0x00, 0x00, 0x00};
 
 // END-OF-FILE
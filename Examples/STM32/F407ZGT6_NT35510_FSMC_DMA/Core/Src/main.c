@@ -47,6 +47,11 @@ typedef struct Slide
 #define FRAMES_PER_BUFFER	SLIDE1_IMAGE_WIDTH * SLIDE1_SQUARE_SIDE
 #define BUFFERS_PER_SLIDE	SLIDE1_IMAGE_HEIGHT / SLIDE1_SQUARE_SIDE
 
+// Every decompressed part of the slide must fit into the display buffer
+#if defined(NT35510_USE_BUFFERING)
+_Static_assert(FRAMES_PER_BUFFER <= NT35510_BUFFER_PIXELS, "The slide buffer doesn't fit into the display buffer");
+#endif
+
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
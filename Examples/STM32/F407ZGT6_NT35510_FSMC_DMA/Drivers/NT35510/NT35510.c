@@ -32,21 +32,87 @@ SOFTWARE.
 // Local variables
 static uint16_t NT35510_width = NT35510_DISPLAY_WIDTH;
 static uint16_t NT35510_height = NT35510_DISPLAY_HEIGHT;
-static __IO uint16_t * reg_pointer = (__IO uint16_t *)NT35510_REG_ADDR;
 static __IO uint16_t * data_pointer = (__IO uint16_t *)NT35510_DATA_ADDR;
 
 #if defined (NT35510_USE_BUFFERING)
+	_Static_assert(NT35510_BUFFER_TOTAL_PIXELS <= 0xFFFF, "The pixel buffer size must fit into 16 bits");
+#if defined (NT35510_USE_STATIC_BUFFER)
+	static uint16_t NT35510_staticPixelBuffer[NT35510_BUFFER_TOTAL_PIXELS];
+	uint16_t * NT35510_pixelBuffer = NT35510_staticPixelBuffer;
+#else
 	uint16_t * NT35510_pixelBuffer = NULL;
-#if defined (NT35510_USE_DOUBLE_BUFFERING)
+	uint8_t NT35510_isPixelBufferAllocated = 0;
+#endif
 	uint16_t NT35510_pixelBufferSize = 0;
-	uint16_t NT35510_pixelBufferHalfSize = 0;
-	uint8_t NT35510_currentBufferIndex = 0;
+#if defined (NT35510_USE_STATIC_BUFFER)
+	static uint16_t NT35510_pixelBufferCapacity = NT35510_BUFFER_TOTAL_PIXELS;
 #else
-	uint16_t NT35510_pixelBufferSize = 0;
+	static uint16_t NT35510_pixelBufferCapacity = 0; // The size of the buffer memory (the heap or the caller's one)
 #endif
+	DisplayPipeline NT35510_pipeline = { 0 };
+#endif
+
+// The DMA counter is 16-bit, the full screen fill is a chain of the transfers
+#define NT35510_MAX_TRANSFER_PIXELS	0xFFFF
+
+
+#if defined(NT35510_USE_DMA)
+// The source of the memory-to-memory DMA is its "peripheral" port,
+// the increment is switched off for the runs of one color
+// (it can be changed only with the stream disabled, HAL_DMA_Init() does it)
+static void NT35510_setDMASource(uint8_t fixedSource) {
+	DMA_HandleTypeDef * hdma = NT35510_SRAM_HANDLE.hdma;
+	uint32_t increment = fixedSource ? DMA_PINC_DISABLE : DMA_PINC_ENABLE;
+	if (hdma->Init.PeriphInc != increment) {
+		WAIT_DMA;
+		hdma->Init.PeriphInc = increment;
+		HAL_DMA_Init(hdma);
+	}
+}
 #endif
 
 
+#if defined (NT35510_USE_BUFFERING)
+
+// Transfer of a pipeline buffer or of a part of the run
+static void NT35510_startTransfer(uint16_t * pixels, uint16_t count, uint8_t mode) {
+#if defined(NT35510_USE_DMA)
+	NT35510_setDMASource(mode & DISPLAY_PIPELINE_FIXED_SOURCE);
+	WAIT_DMA;
+	HAL_SRAM_Write_DMA(&NT35510_SRAM_HANDLE, (uint32_t *)data_pointer, (uint32_t *)pixels, count);
+#else
+	// Blocking transfer, the buffer is free at once
+	NT35510_writeDataWords(pixels, count);
+	DisplayPipeline_transferComplete(&NT35510_pipeline);
+#endif
+}
+
+
+static void NT35510_initPipeline() {
+	DisplayPipeline_init(&NT35510_pipeline, NT35510_pixelBuffer, NT35510_pixelBufferSize / NT35510_BUFFERS_COUNT, NT35510_BUFFERS_COUNT,
+		NT35510_MAX_TRANSFER_PIXELS, NT35510_startTransfer, NULL, NULL);
+}
+
+
+#if defined(NT35510_USE_DMA)
+// DMA interrupt of the FSMC (only the transfers of the pipeline are handled)
+void HAL_SRAM_DMA_XferCpltCallback(DMA_HandleTypeDef * hdma) {
+	if ((hdma == NT35510_SRAM_HANDLE.hdma) && NT35510_pipeline.active) DisplayPipeline_transferComplete(&NT35510_pipeline);
+}
+#endif
+
+#endif
+
+
+// Wait for the end of all the transfers
+static void NT35510_flush() {
+#if defined(NT35510_USE_BUFFERING)
+	DisplayPipeline_flush(&NT35510_pipeline);
+#endif
+	WAIT_DMA;
+}
+
+
 // Init w/o parameters
 void NT35510_init(void)
 {
@@ -149,42 +215,57 @@ void NT35510_initWithParams(uint8_t rotation) {
 
 // Select the display and allocate buffer
 void NT35510_begin() {
-#if defined(NT35510_USE_BUFFERING)
+#if defined(NT35510_USE_BUFFERING) && !defined(NT35510_USE_STATIC_BUFFER)
 	if (NT35510_pixelBuffer == NULL) {
 		NT35510_pixelBuffer = (uint16_t *)malloc(NT35510_pixelBufferSize << 1);
+		NT35510_pixelBufferCapacity = NT35510_pixelBufferSize;
+		NT35510_isPixelBufferAllocated = 1;
+		NT35510_pipeline.buffers = NULL;
 	}
 #endif
+#if defined(NT35510_USE_BUFFERING)
+	if (NT35510_pipeline.buffers == NULL) NT35510_initPipeline();
+#endif
 }
 
 
 // Deselect the display and free the buffer
 void NT35510_end() {
-	WAIT_DMA;
-#if defined(NT35510_USE_BUFFERING) && defined(NT35510_RELEASE_BUFFER_AT_END)
-	if (NT35510_pixelBuffer) {
+	NT35510_flush();
+#if defined(NT35510_USE_BUFFERING) && defined(NT35510_RELEASE_BUFFER_AT_END) && !defined(NT35510_USE_STATIC_BUFFER)
+	// Only the buffer allocated by the module (not the one provided by the caller)
+	if (NT35510_isPixelBufferAllocated) {
 		free(NT35510_pixelBuffer);
 		NT35510_pixelBuffer = NULL;
+		NT35510_isPixelBufferAllocated = 0;
+		NT35510_pipeline.buffers = NULL;
 	}
 #endif
 }
 
 
-// Get current buffer
+// Get current buffer (waits until one of the buffers is free)
 #if defined (NT35510_USE_BUFFERING)
 
 uint16_t * NT35510_getPixelBuffer() {
+	return (DisplayPipeline_getBuffer(&NT35510_pipeline));
+}
 
-#if defined(NT35510_USE_DOUBLE_BUFFERING)
-	if (NT35510_currentBufferIndex) {
-		return (&NT35510_pixelBuffer[NT35510_pixelBufferHalfSize]);
-	} else {
-		return (NT35510_pixelBuffer);
-	}
-#else
-
-	return (NT35510_pixelBuffer);
 
+// Use the caller's buffer (static or arena) instead of the heap one.
+// The size is in pixels and covers all the buffers of the pipeline.
+void NT35510_setPixelBuffer(uint16_t * buffer, uint16_t size) {
+	NT35510_flush();
+#if !defined(NT35510_USE_STATIC_BUFFER)
+	if (NT35510_isPixelBufferAllocated) {
+		free(NT35510_pixelBuffer);
+		NT35510_isPixelBufferAllocated = 0;
+	}
 #endif
+	NT35510_pixelBuffer = buffer;
+	NT35510_pixelBufferSize = size;
+	NT35510_pixelBufferCapacity = size;
+	NT35510_initPipeline();
 }
 #endif
 
@@ -198,20 +279,19 @@ void NT35510_setRotation(uint8_t rotation) {
 
 #if defined(NT35510_USE_BUFFERING)
 	NT35510_end();
-#if defined(NT35510_USE_DOUBLE_BUFFERING)
-	NT35510_pixelBufferHalfSize = NT35510_width * NT35510_BUFFER_HEIGHT;
-	NT35510_pixelBufferSize = NT35510_pixelBufferHalfSize << 1;
-	NT35510_currentBufferIndex = 0;
-#else
-	NT35510_pixelBufferSize = NT35510_width * NT35510_BUFFER_HEIGHT;
-#endif
+	NT35510_pixelBufferSize = NT35510_width * NT35510_BUFFER_HEIGHT * NT35510_BUFFERS_COUNT;
+	if (NT35510_pixelBuffer) {
+		// The buffer in use (static, the caller's or the heap one kept by end()) can't grow
+		if (NT35510_pixelBufferSize > NT35510_pixelBufferCapacity) NT35510_pixelBufferSize = NT35510_pixelBufferCapacity;
+		NT35510_initPipeline();
+	}
 #endif
 }
 
 
 // Set target window
 void NT35510_setWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
-	WAIT_DMA;
+	NT35510_flush();
 
 	// Column Address set
 	NT35510_writeCommand(NT35510_CASET);
@@ -238,29 +318,48 @@ void NT35510_fillColor(uint16_t color) {
 }
 
 
-// Fill configured window with pixels
+// Fill configured window with pixels (a run of one color).
+// With DMA the run is transferred from the fixed source without filling
+// the buffer, and with buffering it is only queued (the next pixels
+// of the window can be decoded meanwhile).
 void NT35510_fillPixels(uint16_t color, uint32_t count) {
-#if defined(NT35510_USE_BUFFERING)
-	// Prepare buffer
+#if defined(NT35510_USE_BUFFERING) && defined(NT35510_USE_DMA)
+	DisplayPipeline_submitRun(&NT35510_pipeline, color, count);
+
+#elif defined(NT35510_USE_BUFFERING)
+	// Every buffer of the pipeline is prepared once
 	//color = __builtin_bswap16(color);
-	uint16_t usedBufferPixels = (count > NT35510_pixelBufferSize) ? NT35510_pixelBufferSize : count;
-	for (uint16_t i = 0; i < usedBufferPixels; i++) NT35510_pixelBuffer[i] = color;
+	uint8_t preparedBuffers = 0;
 
 	while (count) {
+		uint16_t * buffer = DisplayPipeline_getBuffer(&NT35510_pipeline);
+		uint16_t pixelsToFill = (count > NT35510_pipeline.bufferPixels) ? NT35510_pipeline.bufferPixels : count;
+		if (preparedBuffers < NT35510_pipeline.buffersCount) {
+			for (uint16_t i = 0; i < pixelsToFill; i++) buffer[i] = color;
+			preparedBuffers++;
+		}
+
+		DisplayPipeline_submit(&NT35510_pipeline, pixelsToFill);
+		count -= pixelsToFill;
+	}
 
-#if defined(NT35510_USE_DOUBLE_BUFFERING)
-		uint16_t pixelsToFill = (count > NT35510_pixelBufferHalfSize) ? NT35510_pixelBufferHalfSize : count;
-#else
-		uint16_t pixelsToFill = (count > NT35510_pixelBufferSize) ? NT35510_pixelBufferSize : count;
-#endif
-
-		NT35510_writePixels(NT35510_getPixelBuffer(), pixelsToFill);
+#elif defined(NT35510_USE_DMA)
+	// The chain of the DMA transfers from the fixed source
+	static uint16_t fillColor;
+	WAIT_DMA;
+	fillColor = color;
+	NT35510_setDMASource(1);
+	while (count) {
+		uint16_t pixelsToFill = (count > NT35510_MAX_TRANSFER_PIXELS) ? NT35510_MAX_TRANSFER_PIXELS : count;
+		WAIT_DMA;
+		HAL_SRAM_Write_DMA(&NT35510_SRAM_HANDLE, (uint32_t *)data_pointer, (uint32_t *)&fillColor, pixelsToFill);
 		count -= pixelsToFill;
 	}
 
 #else
-	for (uint32_t pixel = 0; pixel < NT35510_DISPLAY_WIDTH * NT35510_DISPLAY_HEIGHT; pixel++) {
+	while (count) {
 		NT35510_writeDataWord(color);
+		count--;
 	}
 #endif
 }
@@ -268,21 +367,28 @@ void NT35510_fillPixels(uint16_t color, uint32_t count) {
 
 // Write next pixel
 void NT35510_writePixel(uint16_t color) {
+	NT35510_flush();
 	NT35510_writeDataWord(color);
 }
 
 
 // Write next chunk of pixels
 void NT35510_writePixels(uint16_t * pixels, uint16_t count) {
+#if defined(NT35510_USE_BUFFERING)
+	// The buffer of the pipeline is queued for the transfer
+	if (pixels == DisplayPipeline_currentBuffer(&NT35510_pipeline)) {
+		DisplayPipeline_submit(&NT35510_pipeline, count);
+		return;
+	}
+	NT35510_flush();
+#endif
+
 #if defined(NT35510_USE_DMA)
 
+	NT35510_setDMASource(0);
 	WAIT_DMA;
 	HAL_SRAM_Write_DMA(&NT35510_SRAM_HANDLE, (uint32_t *)data_pointer, (uint32_t *)pixels, count);
 
-#if defined(NT35510_USE_BUFFERING) && defined(NT35510_USE_DOUBLE_BUFFERING)
-	NT35510_currentBufferIndex = !NT35510_currentBufferIndex;
-#endif
-
 #else
 	// Or just transmit the data
 	NT35510_writeDataWords(pixels, count);
@@ -293,20 +399,20 @@ void NT35510_writePixels(uint16_t * pixels, uint16_t count) {
 
 // Write command
 void NT35510_writeCommand(uint16_t command) {
-	*reg_pointer = command;
+	NT35510_WRITE_REGISTER(command);
 }
 
 
 // Write one byte of data
 void NT35510_writeDataByte(uint8_t data) {
-	*data_pointer = data;
+	NT35510_WRITE_DATA(data);
 }
 
 
 // Write one word of data with endianness control
 // (for pixel use NT35510_writePixel).
 void NT35510_writeDataWord(uint16_t data) {
-	*data_pointer = data;
+	NT35510_WRITE_DATA(data);
 }
 
 
@@ -28,7 +28,7 @@ SOFTWARE.
 // or individual pixels on a display based on the NT35510 controller.
 // It is designed only for use with 800x480 pixel displays
 // and microcontrollers with 16 bit FSMC support.
-// Also it supports DMA and double buffering.
+// Also it supports DMA and the decode/transfer pipeline of several buffers.
 
 // ATTENTION!!! Here we assume that the display always works
 // in Big Endian mode. And since FSMC converts the internal data
@@ -73,6 +73,7 @@ SOFTWARE.
 // Includes
 #include <stdint.h>
 #include "stm32f4xx_hal.h"
+#include "DisplayPipeline.h"
 
 
 #ifndef _NT35510_
@@ -92,7 +93,17 @@ SOFTWARE.
 #define NT35510_REG_ADDR			0x6C000000u
 #define NT35510_DATA_ADDR			0x6C000080u
 
-// If you plan to use DMA, declare this symbol
+// Bus access (can be redefined before this point, e.g. by a host simulation of the display)
+#ifndef NT35510_WRITE_REGISTER
+#define NT35510_WRITE_REGISTER(value)	(*(__IO uint16_t *)NT35510_REG_ADDR = (value))
+#endif
+#ifndef NT35510_WRITE_DATA
+#define NT35510_WRITE_DATA(value)		(*(__IO uint16_t *)NT35510_DATA_ADDR = (value))
+#endif
+
+// If you plan to use DMA, declare this symbol.
+// The runs of one color (fillPixels) are transferred from a fixed source address then
+// (the source increment of the DMA stream is switched by HAL_DMA_Init()).
 #define NT35510_USE_DMA
 
 // You can shift the responsibility for the buffer to this module.
@@ -100,22 +111,33 @@ SOFTWARE.
 // the painting of rectangular areas in one color.
 #define NT35510_USE_BUFFERING
 
-// Double buffering can be used together with DMA.
-// One of the buffers is transferring to the display,
-// while the second one is rendering. Then they are swapped.
-#define NT35510_USE_DOUBLE_BUFFERING
+// The buffer is split into this number of buffers (1-4). With DMA
+// the filled ones are transferring to the display one after another,
+// while the next one is rendering (see DisplayPipeline.h).
+// The module implements HAL_SRAM_DMA_XferCpltCallback() for that
+// (the memory-to-memory DMA can't be circular, so the normal transfers are chained).
+#define NT35510_BUFFERS_COUNT		2
 
 // You can free the buffer during the "end()" call to avoid
 // wasting RAM when no display operations are performed.
 //#define NT35510_RELEASE_BUFFER_AT_END
 
-// The buffer size in pixels will be defined as
+// Or you can avoid the heap altogether: the buffer will be allocated
+// statically, so the RAM footprint is known at compile time.
+// Also in any mode you can provide your own buffer by NT35510_SET_PIXEL_BUFFER().
+#define NT35510_USE_STATIC_BUFFER
+
+// The size of a single buffer in pixels will be defined as
 // the display width multiplied by this number.
 // Also you can change the buffer size as you want,
-// changing NT35510_pixelBufferSize / NT35510_pixelBufferHalfSize
-// variables outside of the begin() / end() calls.
+// changing NT35510_pixelBufferSize (all the buffers)
+// variable outside of the begin() / end() calls.
 #define NT35510_BUFFER_HEIGHT		2
 
+// Maximum size of a single buffer and of the whole buffering memory in pixels
+#define NT35510_BUFFER_PIXELS		(((NT35510_DISPLAY_WIDTH > NT35510_DISPLAY_HEIGHT) ? NT35510_DISPLAY_WIDTH : NT35510_DISPLAY_HEIGHT) * NT35510_BUFFER_HEIGHT)
+#define NT35510_BUFFER_TOTAL_PIXELS	(NT35510_BUFFER_PIXELS * NT35510_BUFFERS_COUNT)
+
 // Ports/pins (you can include the "main.h" file and use the symbols defined in it.
 // Uncomment and configure port/pin if Reset pin used
 //#define NT35510_RST_USED
@@ -169,11 +191,15 @@ extern SRAM_HandleTypeDef NT35510_SRAM_HANDLE;
 #endif
 
 #if defined (NT35510_USE_BUFFERING)
-	extern uint16_t * pixelBuffer;
-	extern uint16_t pixelBufferSize;
-#if defined (NT35510_USE_DOUBLE_BUFFERING)
-	extern uint16_t pixelBufferHalfSize;
-#endif
+	extern uint16_t * NT35510_pixelBuffer;
+	extern uint16_t NT35510_pixelBufferSize;
+	extern DisplayPipeline NT35510_pipeline;
+
+// Use the caller's static array as the pixel buffer (its size is checked at compile time)
+#define NT35510_SET_PIXEL_BUFFER(buffer) do { \
+	_Static_assert(sizeof(buffer) >= NT35510_BUFFER_TOTAL_PIXELS * sizeof(uint16_t), "The pixel buffer is too small"); \
+	NT35510_setPixelBuffer((buffer), sizeof(buffer) / sizeof(uint16_t)); \
+} while (0)
 #endif
 
 void NT35510_init();
@@ -184,6 +210,7 @@ void NT35510_end();
 
 #if defined (NT35510_USE_BUFFERING)
 	uint16_t * NT35510_getPixelBuffer();
+	void NT35510_setPixelBuffer(uint16_t * buffer, uint16_t size);
 #endif
 
 void NT35510_setRotation(uint8_t rotation);
@@ -86,6 +86,8 @@ namespace DeltaComp
             public const string DefaultXmlFilename = "Header_Source.xml";
             public const string DefaultXsltFilename = "Header_Transformation.xslt";
             public const string DefaultTargetPlatform = "All";
+            // Seek index steps (in frames) corresponding to the SeekIndexComboBox items
+            public static readonly UInt32[] SeekIndexSteps = { 0, 1024, 4096, 16384, 65536 };
 
             // Supported pixel formats list
             public static readonly Dictionary<PixelFormat, PixelFormatParameters> SupportedFormats = 
@@ -243,6 +245,7 @@ namespace DeltaComp
             public int SelectedDeltaOption;
             public int SelectedSearchOption;
             public int SelectedPlatform;
+            public int SelectedSeekIndex;
             public volatile CompressionStage Stage;
             public volatile float Progress;
             public List<Channel> Channels;
@@ -339,6 +342,7 @@ namespace DeltaComp
                     SelectedDeltaOption = DeltaOptionComboBox.SelectedIndex,
                     SelectedSearchOption = BlockSearchOptionComboBox.SelectedIndex,
                     SelectedPlatform = TargetPlatformComboBox.SelectedIndex,
+                    SelectedSeekIndex = SeekIndexComboBox.SelectedIndex,
                     Stage = CompressionStage.None,
                     Progress = 0.0f,
                     Channels = new List<Channel>(),
@@ -1177,6 +1181,8 @@ namespace DeltaComp
             _compressor.BlockSizeBits = (byte)(Int32)BlockSizeBitsComboBox.SelectedValue;
             _compressor.DeltaCalculationOption = (DeltaOption)DeltaOptionComboBox.SelectedIndex;
             _compressor.UseBruteForceBestBlockSearch = BlockSearchOptionComboBox.SelectedIndex == 1 ? true : false;
+            _compressor.UseOptimalBlockPartition = BlockSearchOptionComboBox.SelectedIndex == 2 ? true : false;
+            _compressor.SeekIndexStep = Constants.SeekIndexSteps[SeekIndexComboBox.SelectedIndex];
 
             // Create and configure export class instance
             _export = new CodeExport(Constants.DefaultXmlFilename, Constants.DefaultXsltFilename);
@@ -1240,7 +1246,7 @@ namespace DeltaComp
             }
             
 
-            if (!_export.FinalizeExport(out errorMessage))
+            if (!_export.FinalizeExport(_compressor.SeekIndex, out errorMessage))
             {
                 DisplayMessage(MessageBoxImage.Error, errorMessage, Constants.ErrorWindowCaption);
             }
@@ -1334,6 +1340,7 @@ namespace DeltaComp
                 lastContext.SelectedDeltaOption = DeltaOptionComboBox.SelectedIndex;
                 lastContext.SelectedSearchOption = BlockSearchOptionComboBox.SelectedIndex;
                 lastContext.SelectedPlatform = TargetPlatformComboBox.SelectedIndex;
+                lastContext.SelectedSeekIndex = SeekIndexComboBox.SelectedIndex;
             }
 
             int newContextIndex = DataSourceTabControl.SelectedIndex;
@@ -1346,6 +1353,7 @@ namespace DeltaComp
             DeltaOptionComboBox.SelectedIndex = currentContext.SelectedDeltaOption;
             BlockSearchOptionComboBox.SelectedIndex = currentContext.SelectedSearchOption;
             TargetPlatformComboBox.SelectedIndex = currentContext.SelectedPlatform;
+            SeekIndexComboBox.SelectedIndex = currentContext.SelectedSeekIndex;
 
             // Update other UI elements
             if (!currentContext.PreviewIsUpToDate && (currentContext.UpdatePreview != null)) currentContext.UpdatePreview();
@@ -1397,6 +1405,7 @@ namespace DeltaComp
             DeltaOptionComboBox.IsEnabled = false;
             BlockSearchOptionComboBox.IsEnabled = false;
             TargetPlatformComboBox.IsEnabled = false;
+            SeekIndexComboBox.IsEnabled = false;
             CompressButton.IsEnabled = false;
 
         }
@@ -1411,6 +1420,7 @@ namespace DeltaComp
             DeltaOptionComboBox.IsEnabled = true;
             BlockSearchOptionComboBox.IsEnabled = true;
             TargetPlatformComboBox.IsEnabled = true;
+            SeekIndexComboBox.IsEnabled = true;
             CompressButton.Content = Constants.CompressButtonCaption;
             CompressButton.IsEnabled = sourceDataAvailable;
         }
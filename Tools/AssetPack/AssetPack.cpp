@@ -0,0 +1,1017 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+
+// Asset pack writer: reads the headers exported by the compressor (any number of data
+// arrays, the far memory chunks of an array are joined) and writes them as a single
+// pack with a directory (see DecompressionPack.h) into a binary file and/or a header.
+// The pack is read back and every asset is decompressed from it and compared
+// with the source data on request.
+// The squares repeated in the assets of the same context may be written once
+// into the tile table of the context, the assets that get smaller without them
+// keep the rest of their blocks as they are.
+
+// Includes
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <map>
+#include <algorithm>
+#include "DeltaDecoder.h"
+#include "DecompressionPack.h"
+
+#define ASSET_PACK_ELEMENTS_PER_ROW		100
+#define ASSET_PACK_DATA_PADDING			4
+// Seek points checked per asset and the frames decompressed after each one
+#define ASSET_PACK_VERIFY_SEEKS			16
+#define ASSET_PACK_VERIFY_SEEK_FRAMES	64
+// Tiles per table (the reference holds the 8-bit tile index) and the squares per asset (24 bits)
+#define ASSET_PACK_MAX_TILES			256
+#define ASSET_PACK_MAX_SQUARES			0x1000000
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Decompression context of the host decoder (the pack supports up to 4 channels)
+struct AssetPackContext
+{
+	uint8_t numberOfChannels;
+	uint8_t bitsPerChannels[DECOMPRESSION_PACK_MAX_CHANNELS];
+	uint8_t blockSizeBits;
+	uint8_t bitsPerMethodDeclaration[DECOMPRESSION_PACK_MAX_CHANNELS];
+	uint8_t bitsPerFrame;
+	bool splitToSquares;
+	uint16_t imageWidth;
+	uint8_t squareSide;
+	uint16_t squaresPerWidth;
+	uint16_t squaresPerWidthSize;
+};
+
+// The widest configuration of the original class for every delta option
+template <uint8_t option>
+struct AssetPackConfig
+{
+	typedef AssetPackContext Context;
+	typedef const uint8_t * CompressedData;
+	typedef uint64_t BitsBuffer;
+	typedef uint32_t ReadBits;
+	typedef uint32_t ChannelValue;
+	typedef uint64_t Frame;
+	typedef uint32_t FramesCounter;
+	typedef uint32_t ByteIndex;
+	typedef uint32_t Position;
+
+	static const uint8_t maxNumberOfChannels = DECOMPRESSION_PACK_MAX_CHANNELS;
+	static const uint8_t deltaOption = option;
+	static const bool useSquares = true;
+	static const bool packedFrames = true;
+	static const uint16_t chunkSize = 0;
+
+	static void frameDecompressed(Frame frame) {}
+	static void frameRunDecompressed(Frame frame, FramesCounter count) {}
+	static uint16_t colorizePixel(Frame frame) { return (0); }
+};
+
+// Frames in the order of the stream (the squares layout doesn't matter for the comparison)
+struct AssetPackFramesSink
+{
+	uint64_t * frames;
+	uint32_t count;
+
+	template <typename Frame> inline void writeFrame(Frame frame) { frames[count++] = frame; }
+	template <typename Frame, typename Count> inline void writeRun(Frame frame, Count count)
+	{
+		while (count--) writeFrame(frame);
+	}
+	inline void moveTo(uint32_t position) {}
+};
+
+// Context as it was exported (#define PREFIX_...)
+struct AssetPackSourceContext
+{
+	std::string prefix;
+	uint8_t record[DECOMPRESSION_PACK_CONTEXT_SIZE];
+	uint32_t framesCount;
+};
+
+struct AssetPackSeekPoint
+{
+	uint32_t frame;
+	uint32_t bitOffset;
+};
+
+struct AssetPackAsset
+{
+	std::string name;		// Base name of the data array(s)
+	std::string source;		// Header file
+	size_t context;			// Index of the source context
+	std::vector<uint8_t> data;
+	std::vector<uint8_t> sourceData; // The exported data of the asset with the tile references
+	std::vector<AssetPackSeekPoint> seekIndex;
+	std::vector<uint32_t> tileReferences; // Square | tile << 24
+	uint8_t packContext;	// Index of the context in the pack
+	uint32_t offset;		// Data offset in the pack
+};
+
+// Frames of the tiles for the context record
+struct AssetPackTileTable
+{
+	uint8_t record[DECOMPRESSION_PACK_CONTEXT_SIZE];
+	std::vector<uint8_t> frames;
+};
+
+static std::vector<AssetPackSourceContext> contexts;
+static std::vector<AssetPackAsset> assets;
+static std::vector<AssetPackTileTable> tileTables;
+
+
+static void fail(const char * format, const char * argument)
+{
+	fprintf(stderr, "assetpack: ");
+	fprintf(stderr, format, argument);
+	fprintf(stderr, "\n");
+	exit(1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Value of the option "--name value" or NULL
+static const char * option(int argc, char ** argv, const char * name)
+{
+	for (int i = 1; i < argc - 1; i++)
+	{
+		if ((argv[i][0] == '-') && (argv[i][1] == '-') && !strcmp(argv[i] + 2, name)) return (argv[i + 1]);
+	}
+	return (NULL);
+}
+
+
+static bool flag(int argc, char ** argv, const char * name)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		if ((argv[i][0] == '-') && (argv[i][1] == '-') && !strcmp(argv[i] + 2, name)) return (true);
+	}
+	return (false);
+}
+
+
+static std::string upper(const std::string & text)
+{
+	std::string result = text;
+	for (size_t i = 0; i < result.size(); i++) result[i] = toupper(result[i]);
+	return (result);
+}
+
+
+// Numbers of the text ("{ 5, 6, 5 }", "0x1F, 0x00", "true")
+static std::vector<uint32_t> numbers(const char * text)
+{
+	std::vector<uint32_t> result;
+	while (*text)
+	{
+		if (isdigit(*text))
+		{
+			char * end;
+			result.push_back(strtoul(text, &end, 0));
+			text = end;
+		}
+		else if (!strncmp(text, "true", 4))
+		{
+			result.push_back(1);
+			text += 4;
+		}
+		else if (!strncmp(text, "false", 5))
+		{
+			result.push_back(0);
+			text += 5;
+		}
+		else if (isalpha(*text) || (*text == '_'))
+		{
+			// Identifiers (the other macros) are skipped as a whole
+			while (isalnum(*text) || (*text == '_')) text++;
+		}
+		else text++;
+	}
+	return (result);
+}
+
+
+// "#define PREFIX_NAME value" of the last context
+static bool contextDefine(const char * line, const char * name, std::vector<uint32_t> & values)
+{
+	const AssetPackSourceContext & context = contexts.back();
+	std::string define = context.prefix + "_" + name;
+	if (strncmp(line, define.c_str(), define.size()) || !isspace(line[define.size()])) return (false);
+
+	// The comment after the value is not a part of it
+	std::string value = line + define.size();
+	size_t comment = value.find("//");
+	if (comment != std::string::npos) value.erase(comment);
+	values = numbers(value.c_str());
+	return (!values.empty());
+}
+
+
+static void parseDefine(const char * line, const char * path)
+{
+	const char * name = line + strspn(line, " \t");
+	const char * suffix = strstr(name, "_NUMBER_OF_");
+	std::string prefix = suffix ? std::string(name, suffix - name) : "";
+	if (suffix && (contexts.empty() || (contexts.back().prefix != prefix)) &&
+		((!strncmp(suffix, "_NUMBER_OF_FRAMES", 17) && isspace(suffix[17])) || (!strncmp(suffix, "_NUMBER_OF_CHANNELS", 19) && isspace(suffix[19]))))
+	{
+		// The first define of the context ("PREFIX definitions" of the exported header)
+		AssetPackSourceContext context;
+		context.prefix = prefix;
+		memset(context.record, 0, sizeof(context.record));
+		context.framesCount = 0;
+		contexts.push_back(context);
+	}
+	if (contexts.empty()) return;
+
+	AssetPackSourceContext & context = contexts.back();
+	std::vector<uint32_t> values;
+	if (contextDefine(name, "NUMBER_OF_CHANNELS", values))
+	{
+		if (values[0] > DECOMPRESSION_PACK_MAX_CHANNELS) fail("%s: more than 4 channels", path);
+		context.record[0] = values[0];
+	}
+	else if (contextDefine(name, "BITS_PER_CHANNELS", values))
+	{
+		for (size_t i = 0; (i < values.size()) && (i < DECOMPRESSION_PACK_MAX_CHANNELS); i++) context.record[1 + i] = values[i];
+	}
+	else if (contextDefine(name, "BLOCK_SIZE_BITS", values)) context.record[5] = values[0];
+	else if (contextDefine(name, "BITS_PER_METHOD_DECLARATION", values))
+	{
+		for (size_t i = 0; (i < values.size()) && (i < DECOMPRESSION_PACK_MAX_CHANNELS); i++) context.record[6 + i] = values[i];
+	}
+	else if (contextDefine(name, "BITS_PER_FRAME", values)) context.record[10] = values[0];
+	else if (contextDefine(name, "DELTA_OPTION", values)) context.record[11] = values[0];
+	else if (contextDefine(name, "SPLIT_TO_SQUARES", values)) context.record[12] = values[0] ? 1 : 0;
+	else if (contextDefine(name, "SQUARE_SIDE", values)) context.record[13] = values[0];
+	else if (contextDefine(name, "IMAGE_WIDTH", values))
+	{
+		context.record[14] = values[0] & 0xFF;
+		context.record[15] = values[0] >> 8;
+	}
+	else if (contextDefine(name, "NUMBER_OF_FRAMES", values)) context.framesCount = values[0];
+}
+
+
+// Asset of the data array: "nameData" or the next far memory chunk "nameData<n>"
+static AssetPackAsset & arrayAsset(const std::string & array, const char * path)
+{
+	std::string name = array;
+	bool chunk = false;
+	size_t digits = name.find_last_not_of("0123456789");
+	if ((digits != std::string::npos) && (digits + 1 < name.size()) && (digits >= 3) && !name.compare(digits - 3, 4, "Data"))
+	{
+		name.erase(digits - 3);
+		chunk = (strtoul(array.c_str() + digits + 1, NULL, 10) > 1);
+	}
+	else if ((name.size() > 4) && !name.compare(name.size() - 4, 4, "Data")) name.erase(name.size() - 4);
+
+	if (chunk && !assets.empty() && (assets.back().name == name)) return (assets.back());
+
+	for (size_t i = 0; i < assets.size(); i++)
+	{
+		if (upper(assets[i].name) == upper(name)) fail("the asset name \"%s\" is used twice", name.c_str());
+	}
+	if (contexts.empty()) fail("%s: the data array before the definitions", path);
+
+	AssetPackAsset asset;
+	asset.name = name;
+	asset.source = path;
+	asset.context = contexts.size() - 1;
+	asset.packContext = 0;
+	asset.offset = 0;
+	assets.push_back(asset);
+	return (assets.back());
+}
+
+
+static void parseHeader(const char * path)
+{
+	FILE * file = fopen(path, "r");
+	if (file == NULL) fail("can't open %s", path);
+
+	char line[4096];
+	AssetPackAsset * array = NULL;
+	bool seekIndex = false;
+	std::vector<uint32_t> seekValues;
+
+	while (fgets(line, sizeof(line), file))
+	{
+		// Comments ("Limit of ... bytes reached" within the array too)
+		char * comment = strstr(line, "//");
+		if (comment) *comment = 0;
+
+		const char * text = line + strspn(line, " \t");
+		if (!strncmp(text, "#define", 7)) parseDefine(text + 7, path);
+		else if (!strncmp(text, "static const uint8_t", 20) && strchr(text, '['))
+		{
+			const char * name = text + 20 + strspn(text + 20, " \t");
+			array = &arrayAsset(std::string(name, strcspn(name, "[ \t")), path);
+			const char * brace = strchr(text, '{');
+			if (brace) text = brace + 1;
+			else text = "";
+		}
+		else if (!strncmp(text, "static const DecompressionSeekPoint", 35))
+		{
+			const char * name = text + 35 + strspn(text + 35, " \t");
+			std::string seekName(name, strcspn(name, "[ \t"));
+			size_t suffix = seekName.rfind("SeekIndex");
+			if (suffix != std::string::npos) seekName.erase(suffix);
+
+			// The exporter writes the seek index right after the data array of the same name
+			array = NULL;
+			for (size_t i = 0; i < assets.size(); i++)
+			{
+				if (upper(assets[i].name) == upper(seekName)) array = &assets[i];
+			}
+			if (array == NULL) fail("no data for the seek index \"%s\"", seekName.c_str());
+			seekIndex = true;
+			seekValues.clear();
+			text = strchr(text, '=') ? strchr(text, '=') + 1 : "";
+		}
+
+		if (array == NULL) continue;
+
+		const char * end = strstr(text, "};");
+		std::string values = end ? std::string(text, end - text) : std::string(text);
+		std::vector<uint32_t> parsed = numbers(values.c_str());
+		if (seekIndex) seekValues.insert(seekValues.end(), parsed.begin(), parsed.end());
+		else for (size_t i = 0; i < parsed.size(); i++) array->data.push_back(parsed[i]);
+
+		if (end)
+		{
+			if (seekIndex)
+			{
+				for (size_t i = 0; i + 1 < seekValues.size(); i += 2)
+				{
+					AssetPackSeekPoint point = { seekValues[i], seekValues[i + 1] };
+					array->seekIndex.push_back(point);
+				}
+			}
+			array = NULL;
+			seekIndex = false;
+		}
+	}
+	fclose(file);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Context of the decoder as the exported header defines it
+static void sourceContext(const AssetPackSourceContext & context, AssetPackContext * dc)
+{
+	dc->numberOfChannels = context.record[0];
+	memcpy(dc->bitsPerChannels, &context.record[1], DECOMPRESSION_PACK_MAX_CHANNELS);
+	dc->blockSizeBits = context.record[5];
+	memcpy(dc->bitsPerMethodDeclaration, &context.record[6], DECOMPRESSION_PACK_MAX_CHANNELS);
+	dc->bitsPerFrame = context.record[10];
+	dc->splitToSquares = context.record[12];
+	dc->imageWidth = context.record[14] | (context.record[15] << 8);
+	dc->squareSide = context.record[13];
+	dc->squaresPerWidth = dc->squareSide ? (dc->imageWidth / dc->squareSide) : 0;
+	dc->squaresPerWidthSize = dc->imageWidth * dc->squareSide;
+}
+
+
+template <uint8_t option>
+static void decompressFrames(const uint8_t * data, AssetPackContext * dc, uint64_t * frames, uint32_t count, const DecompressionTiles<AssetPackConfig<option> > * tiles = NULL)
+{
+	DeltaDecoder<AssetPackConfig<option> > decoder;
+	AssetPackFramesSink sink = { frames, 0 };
+	decoder.resetDecompression();
+	decoder.useTiles(tiles);
+	decoder.bufferWidth = dc->imageWidth;
+	decoder.decompressNextFrames(dc, data, sink, count);
+}
+
+
+// Frames of the exported data in the order of the stream
+static std::vector<uint64_t> sourceFrames(const AssetPackAsset & asset)
+{
+	const AssetPackSourceContext & context = contexts[asset.context];
+	std::vector<uint64_t> frames(context.framesCount);
+	std::vector<uint8_t> data(asset.sourceData.empty() ? asset.data : asset.sourceData);
+	data.resize(data.size() + ASSET_PACK_DATA_PADDING);
+
+	AssetPackContext dc;
+	sourceContext(context, &dc);
+	switch (context.record[11])
+	{
+	case DECOMPRESSION_OPTION_FIXED_WINDOW_ONLY: decompressFrames<DECOMPRESSION_OPTION_FIXED_WINDOW_ONLY>(&data[0], &dc, &frames[0], frames.size()); break;
+	case DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_ONLY: decompressFrames<DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_ONLY>(&data[0], &dc, &frames[0], frames.size()); break;
+	case DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST: decompressFrames<DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST>(&data[0], &dc, &frames[0], frames.size()); break;
+	default: decompressFrames<DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_FIRST>(&data[0], &dc, &frames[0], frames.size()); break;
+	}
+	return (frames);
+}
+
+
+// Decoder state at the block headers: the seek point every "interval" frames or more
+template <uint8_t option>
+static void buildSeekIndex(AssetPackAsset & asset, AssetPackContext * dc, uint32_t framesCount, uint32_t interval)
+{
+	DeltaDecoder<AssetPackConfig<option> > decoder;
+	std::vector<uint64_t> frames(framesCount);
+	std::vector<uint8_t> data(asset.data);
+	data.resize(data.size() + ASSET_PACK_DATA_PADDING);
+
+	decoder.resetDecompression();
+	decoder.bufferWidth = dc->imageWidth;
+	for (uint32_t frame = 0; frame < framesCount; )
+	{
+		// The header of the next block is read by the next call
+		AssetPackSeekPoint point = { frame, decoder.inputByteIndex * 8 - decoder.inputBitsCount };
+		if (asset.seekIndex.empty() || (frame - asset.seekIndex.back().frame >= interval)) asset.seekIndex.push_back(point);
+
+		AssetPackFramesSink sink = { &frames[frame], 0 };
+		decoder.decompressNextFrames(dc, &data[0], sink, 1);
+		uint32_t rest = decoder.currentBlockFramesCount;
+		if (rest > framesCount - frame - 1) rest = framesCount - frame - 1;
+		decoder.decompressNextFrames(dc, &data[0], sink, rest);
+		frame += 1 + rest;
+	}
+}
+
+
+// The asset read from the pack must give the same frames as the source data
+template <uint8_t option>
+static bool verifyAsset(const uint8_t * pack, uint16_t id)
+{
+	typedef AssetPackConfig<option> Config;
+	const AssetPackAsset & asset = assets[id];
+	DecompressionPack<Config> reader;
+	typename DecompressionPack<Config>::Asset packAsset;
+	if (!reader.open(pack) || !reader.getAsset(id, &packAsset)) return (false);
+	if ((packAsset.dataSize != asset.data.size()) || memcmp(packAsset.data, asset.data.data(), asset.data.size())) return (false);
+
+	uint32_t framesCount = packAsset.framesCount;
+	if (packAsset.tiles.referencesCount != asset.tileReferences.size()) return (false);
+
+	std::vector<uint64_t> expected = sourceFrames(asset), frames(framesCount);
+	if (expected.size() != framesCount) return (false);
+	decompressFrames<option>(packAsset.data, &packAsset.dc, &frames[0], framesCount, &packAsset.tiles);
+	if (frames != expected) return (false);
+
+	// Random access by the seek index of the pack
+	for (uint32_t i = 0; (i < ASSET_PACK_VERIFY_SEEKS) && packAsset.seekPointsCount; i++)
+	{
+		uint32_t frame = (uint32_t)(((uint64_t)framesCount * (i * 2 + 1)) / (ASSET_PACK_VERIFY_SEEKS * 2));
+		uint32_t count = framesCount - frame;
+		if (count > ASSET_PACK_VERIFY_SEEK_FRAMES) count = ASSET_PACK_VERIFY_SEEK_FRAMES;
+
+		DeltaDecoder<Config> decoder;
+		decoder.bufferWidth = packAsset.dc.imageWidth;
+		if (!reader.seekToFrame(decoder, &packAsset, frame)) return (false);
+		AssetPackFramesSink sink = { &frames[0], 0 };
+		decoder.decompressNextFrames(&packAsset.dc, packAsset.data, sink, count);
+		if (memcmp(&frames[0], &expected[frame], count * sizeof(uint64_t))) return (false);
+	}
+	return (true);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Bits of the data, the most significant bit of the byte first (as the decoder reads them)
+struct AssetPackBitReader
+{
+	const std::vector<uint8_t> & data;
+	uint64_t position;
+
+	uint32_t read(uint8_t bitsCount)
+	{
+		uint32_t bits = 0;
+		for (uint8_t i = 0; i < bitsCount; i++, position++)
+		{
+			uint8_t byte = ((position >> 3) < data.size()) ? data[position >> 3] : 0;
+			bits = (bits << 1) | ((byte >> (7 - (position & 7))) & 1);
+		}
+		return (bits);
+	}
+};
+
+struct AssetPackBitWriter
+{
+	std::vector<uint8_t> data;
+	uint64_t position;
+
+	void write(uint32_t bits, uint8_t bitsCount)
+	{
+		for (uint8_t i = bitsCount; i > 0; i--, position++)
+		{
+			if (!(position & 7)) data.push_back(0);
+			data.back() |= ((bits >> (i - 1)) & 1) << (7 - (position & 7));
+		}
+	}
+};
+
+
+// The blocks of the asset without the frames of the referenced squares. The blocks are independent,
+// so the blocks (or the parts of them) outside these squares are copied bit by bit, and every part
+// of a block gets the header of the block. Only the adaptive channels of the part that starts inside
+// the block take its first value as the base value, because the first frame of the block gives
+// the base value and doesn't read their bits.
+static std::vector<uint8_t> spliceWithoutSquares(const uint8_t * record, const std::vector<uint8_t> & data, const std::vector<uint64_t> & frames, const std::vector<bool> & referenced)
+{
+	uint8_t channels = record[0];
+	uint32_t squareSize = (uint32_t)record[13] * record[13];
+	AssetPackBitReader reader = { data, 0 };
+	AssetPackBitWriter writer = { std::vector<uint8_t>(), 0 };
+
+	for (uint32_t frame = 0; frame < frames.size(); )
+	{
+		uint32_t framesCount = reader.read(record[5]) + 1;
+		if (framesCount > frames.size() - frame) framesCount = frames.size() - frame;
+
+		uint32_t methods[DECOMPRESSION_PACK_MAX_CHANNELS], baseValues[DECOMPRESSION_PACK_MAX_CHANNELS];
+		uint8_t bits[DECOMPRESSION_PACK_MAX_CHANNELS];
+		bool afw[DECOMPRESSION_PACK_MAX_CHANNELS];
+		for (uint8_t c = 0; c < channels; c++)
+		{
+			methods[c] = reader.read(record[6 + c]);
+			bits[c] = methods[c];
+			baseValues[c] = 0;
+			afw[c] = false;
+			if (methods[c] == record[1 + c]) continue;
+
+			// Methods above the channel width declare the second window type (see DeltaDecoder::readBlockHeader())
+			baseValues[c] = reader.read(record[1 + c]);
+			if ((record[11] == DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST) || (record[11] == DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_FIRST))
+			{
+				bool secondWindow = (bits[c] > record[1 + c]);
+				if (secondWindow) bits[c] -= record[1 + c];
+				afw[c] = (secondWindow == (record[11] == DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST));
+			}
+			else
+			{
+				afw[c] = (record[11] == DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_ONLY);
+			}
+		}
+
+		uint32_t partEnd = 0;
+		for (uint32_t i = 0; i < framesCount; i++)
+		{
+			bool kept = !referenced[(frame + i) / squareSize];
+			bool partStart = kept && (i >= partEnd);
+			if (partStart)
+			{
+				partEnd = i + 1;
+				while ((partEnd < framesCount) && !referenced[(frame + partEnd) / squareSize]) partEnd++;
+
+				writer.write(partEnd - i - 1, record[5]);
+				uint8_t shift = record[10];
+				for (uint8_t c = 0; c < channels; c++)
+				{
+					// The first channel is the most significant one
+					shift -= record[1 + c];
+					writer.write(methods[c], record[6 + c]);
+					if (methods[c] == record[1 + c]) continue;
+					writer.write((afw[c] && i) ? (uint32_t)((frames[frame + i] >> shift) & (((uint64_t)1 << record[1 + c]) - 1)) : baseValues[c], record[1 + c]);
+				}
+			}
+
+			for (uint8_t c = 0; c < channels; c++)
+			{
+				uint32_t value = reader.read((afw[c] && !i) ? 0 : bits[c]);
+				if (kept && !(afw[c] && partStart)) writer.write(value, bits[c]);
+			}
+		}
+		frame += framesCount;
+	}
+	return (writer.data);
+}
+
+
+struct AssetPackTileCandidate
+{
+	int64_t gain; // Estimated bits
+	const std::vector<uint64_t> * frames;
+	const std::vector<std::pair<size_t, uint32_t> > * squares; // Asset of the group and the square
+};
+
+static bool betterTile(const AssetPackTileCandidate & a, const AssetPackTileCandidate & b)
+{
+	return (a.gain > b.gain);
+}
+
+
+// The same squares in the assets of the context (split into squares) go to the tile table of the context.
+// A tile pays off when its squares take more bits in the data of the assets than the references,
+// uniform squares are left to the constant blocks. Then the frames of the referenced squares
+// are cut out of the blocks of every asset, the asset keeps the references only if it gets smaller,
+// and the whole table is kept only if it saves more than its own size. The assets with the seek index
+// (exported or requested) keep their data as it is.
+static void buildTiles(const uint8_t * record, uint32_t seekInterval)
+{
+	uint8_t side = record[13];
+	uint32_t squareSize = (uint32_t)side * side;
+	uint8_t frameSize = (record[10] + 7) >> 3;
+
+	std::vector<size_t> group;
+	std::vector<std::vector<uint64_t> > frames;
+	std::map<std::vector<uint64_t>, std::vector<std::pair<size_t, uint32_t> > > squares;
+	for (size_t i = 0; i < assets.size(); i++)
+	{
+		if (memcmp(contexts[assets[i].context].record, record, DECOMPRESSION_PACK_CONTEXT_SIZE)) continue;
+		if (seekInterval || !assets[i].seekIndex.empty()) continue;
+
+		std::vector<uint64_t> assetFrames = sourceFrames(assets[i]);
+		if ((assetFrames.size() % squareSize) || (assetFrames.size() / squareSize >= ASSET_PACK_MAX_SQUARES)) continue;
+
+		group.push_back(i);
+		frames.push_back(assetFrames);
+		for (uint32_t s = 0; s < assetFrames.size() / squareSize; s++)
+		{
+			std::vector<uint64_t> square(assetFrames.begin() + s * squareSize, assetFrames.begin() + (s + 1) * squareSize);
+			uint32_t j = 1;
+			while ((j < squareSize) && (square[j] == square[0])) j++;
+			if (j < squareSize) squares[square].push_back(std::make_pair(group.size() - 1, s));
+		}
+	}
+
+	// Estimated by the average bits of the square in the data of the asset
+	std::vector<AssetPackTileCandidate> candidates;
+	for (std::map<std::vector<uint64_t>, std::vector<std::pair<size_t, uint32_t> > >::const_iterator i = squares.begin(); i != squares.end(); i++)
+	{
+		if (i->second.size() < 2) continue;
+
+		AssetPackTileCandidate candidate = { -(int64_t)squareSize * frameSize * 8, &i->first, &i->second };
+		for (size_t j = 0; j < i->second.size(); j++)
+		{
+			size_t g = i->second[j].first;
+			candidate.gain += (int64_t)(assets[group[g]].data.size() * 8 * squareSize / frames[g].size()) - DECOMPRESSION_TILE_REFERENCE_SIZE * 8;
+		}
+		if (candidate.gain > 0) candidates.push_back(candidate);
+	}
+	std::stable_sort(candidates.begin(), candidates.end(), betterTile);
+	if (candidates.size() > ASSET_PACK_MAX_TILES) candidates.resize(ASSET_PACK_MAX_TILES);
+
+	std::vector<std::vector<std::pair<uint32_t, uint16_t> > > references(group.size());
+	for (size_t k = 0; k < candidates.size(); k++)
+	{
+		for (size_t j = 0; j < candidates[k].squares->size(); j++) references[(*candidates[k].squares)[j].first].push_back(std::make_pair((*candidates[k].squares)[j].second, k));
+	}
+
+	// The assets that get smaller with the references
+	std::vector<std::vector<uint8_t> > data(group.size());
+	std::vector<bool> accepted(group.size(), false), used(candidates.size(), false);
+	int64_t saved = 0;
+	for (size_t g = 0; g < group.size(); g++)
+	{
+		if (references[g].empty()) continue;
+		std::sort(references[g].begin(), references[g].end());
+
+		std::vector<bool> referenced(frames[g].size() / squareSize, false);
+		for (size_t j = 0; j < references[g].size(); j++) referenced[references[g][j].first] = true;
+		data[g] = spliceWithoutSquares(record, assets[group[g]].data, frames[g], referenced);
+
+		size_t size = data[g].size() + references[g].size() * DECOMPRESSION_TILE_REFERENCE_SIZE;
+		if (size >= assets[group[g]].data.size()) continue;
+
+		accepted[g] = true;
+		saved += assets[group[g]].data.size() - size;
+		for (size_t j = 0; j < references[g].size(); j++) used[references[g][j].second] = true;
+	}
+
+	// The table and its offset, the number of references of every asset
+	AssetPackTileTable table;
+	memcpy(table.record, record, DECOMPRESSION_PACK_CONTEXT_SIZE);
+	std::vector<uint8_t> tileIndex(candidates.size(), 0);
+	for (size_t k = 0; k < candidates.size(); k++)
+	{
+		if (!used[k]) continue;
+		tileIndex[k] = table.frames.size() / (squareSize * frameSize);
+		for (uint32_t j = 0; j < squareSize; j++)
+		{
+			for (uint8_t b = 0; b < frameSize; b++) table.frames.push_back(((*candidates[k].frames)[j] >> (b * 8)) & 0xFF);
+		}
+	}
+	if (saved <= (int64_t)(table.frames.size() + 4 + group.size() * 4)) return;
+
+	uint32_t referencesCount = 0;
+	for (size_t g = 0; g < group.size(); g++)
+	{
+		if (!accepted[g]) continue;
+
+		AssetPackAsset & asset = assets[group[g]];
+		asset.sourceData = asset.data;
+		asset.data = data[g];
+		asset.seekIndex.clear();
+		for (size_t j = 0; j < references[g].size(); j++) asset.tileReferences.push_back(references[g][j].first | ((uint32_t)tileIndex[references[g][j].second] << 24));
+		referencesCount += references[g].size();
+	}
+	tileTables.push_back(table);
+
+	printf("%s: %u tiles, %u references, %u bytes saved\n", contexts[assets[group[0]].context].prefix.c_str(), (unsigned)(table.frames.size() / (squareSize * frameSize)),
+		referencesCount, (unsigned)(saved - table.frames.size()));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+static void write16(std::vector<uint8_t> & pack, uint32_t offset, uint16_t value)
+{
+	pack[offset] = value & 0xFF;
+	pack[offset + 1] = value >> 8;
+}
+
+
+static void write32(std::vector<uint8_t> & pack, uint32_t offset, uint32_t value)
+{
+	write16(pack, offset, value & 0xFFFF);
+	write16(pack, offset + 2, value >> 16);
+}
+
+
+// Layout of the pack: header, contexts (the same ones are shared), tile table offsets,
+// directory, tile tables, then the tile references, the seek index and the aligned data
+// of every asset
+static std::vector<uint8_t> buildPack(uint32_t alignment, uint32_t chunkSize)
+{
+	std::vector<const uint8_t *> records;
+	for (size_t i = 0; i < assets.size(); i++)
+	{
+		const uint8_t * record = contexts[assets[i].context].record;
+		size_t index = 0;
+		while ((index < records.size()) && memcmp(records[index], record, DECOMPRESSION_PACK_CONTEXT_SIZE)) index++;
+		if (index == records.size()) records.push_back(record);
+		assets[i].packContext = index;
+	}
+	if (records.size() > 255) fail("more than 255 %s", "contexts");
+
+	bool tiles = !tileTables.empty();
+	uint32_t tableOffsets = DECOMPRESSION_PACK_HEADER_SIZE + records.size() * DECOMPRESSION_PACK_CONTEXT_SIZE;
+	uint32_t directoryOffset = tableOffsets + (tiles ? records.size() * 4 : 0);
+	uint32_t offset = directoryOffset + assets.size() * DECOMPRESSION_PACK_ENTRY_SIZE;
+
+	std::vector<uint32_t> tablesOffsets(tileTables.size());
+	for (size_t i = 0; i < tileTables.size(); i++)
+	{
+		tablesOffsets[i] = offset;
+		offset += tileTables[i].frames.size();
+	}
+
+	for (size_t i = 0; i < assets.size(); i++)
+	{
+		AssetPackAsset & asset = assets[i];
+		uint32_t seekIndexSize = asset.seekIndex.size() * DECOMPRESSION_PACK_SEEK_POINT_SIZE;
+		if (tiles) seekIndexSize += 4 + asset.tileReferences.size() * DECOMPRESSION_TILE_REFERENCE_SIZE;
+		uint32_t size = asset.data.size() + ASSET_PACK_DATA_PADDING;
+		offset = (offset + seekIndexSize + alignment - 1) / alignment * alignment;
+
+		// The far data must fit into the rest of its chunk or start the next one
+		if (chunkSize && (offset % chunkSize) && ((offset % chunkSize) + size > chunkSize)) offset = (offset / chunkSize + 1) * chunkSize;
+
+		asset.offset = offset;
+		offset += size;
+	}
+
+	std::vector<uint8_t> pack(offset, 0);
+	memcpy(&pack[0], "DCPK", 4);
+	pack[4] = DECOMPRESSION_PACK_VERSION;
+	pack[5] = records.size();
+	write16(pack, 6, assets.size());
+	write32(pack, 8, directoryOffset);
+	write16(pack, 12, chunkSize);
+	for (pack[14] = 0; (1u << pack[14]) < alignment; pack[14]++);
+	pack[15] = tiles ? DECOMPRESSION_PACK_FLAG_TILES : 0;
+
+	for (size_t i = 0; i < records.size(); i++) memcpy(&pack[DECOMPRESSION_PACK_HEADER_SIZE + i * DECOMPRESSION_PACK_CONTEXT_SIZE], records[i], DECOMPRESSION_PACK_CONTEXT_SIZE);
+
+	for (size_t i = 0; i < tileTables.size(); i++)
+	{
+		size_t record = 0;
+		while (memcmp(records[record], tileTables[i].record, DECOMPRESSION_PACK_CONTEXT_SIZE)) record++;
+		write32(pack, tableOffsets + record * 4, tablesOffsets[i]);
+		memcpy(&pack[tablesOffsets[i]], &tileTables[i].frames[0], tileTables[i].frames.size());
+	}
+
+	for (size_t i = 0; i < assets.size(); i++)
+	{
+		const AssetPackAsset & asset = assets[i];
+		uint32_t entry = directoryOffset + i * DECOMPRESSION_PACK_ENTRY_SIZE;
+		write32(pack, entry, asset.offset);
+		write32(pack, entry + 4, asset.data.size());
+		write32(pack, entry + 8, contexts[asset.context].framesCount);
+		write16(pack, entry + 12, asset.seekIndex.size());
+		pack[entry + 14] = asset.packContext;
+
+		uint32_t seekIndex = asset.offset - asset.seekIndex.size() * DECOMPRESSION_PACK_SEEK_POINT_SIZE;
+		for (size_t j = 0; j < asset.seekIndex.size(); j++)
+		{
+			write32(pack, seekIndex + j * DECOMPRESSION_PACK_SEEK_POINT_SIZE, asset.seekIndex[j].frame);
+			write32(pack, seekIndex + j * DECOMPRESSION_PACK_SEEK_POINT_SIZE + 4, asset.seekIndex[j].bitOffset);
+		}
+		if (tiles)
+		{
+			uint32_t references = seekIndex - 4 - asset.tileReferences.size() * DECOMPRESSION_TILE_REFERENCE_SIZE;
+			for (size_t j = 0; j < asset.tileReferences.size(); j++) write32(pack, references + j * DECOMPRESSION_TILE_REFERENCE_SIZE, asset.tileReferences[j]);
+			write32(pack, seekIndex - 4, asset.tileReferences.size());
+		}
+		if (!asset.data.empty()) memcpy(&pack[asset.offset], &asset.data[0], asset.data.size());
+	}
+	return (pack);
+}
+
+
+static void writeArray(FILE * file, const char * name, const char * attribute, const uint8_t * data, size_t size)
+{
+	fprintf(file, "static const uint8_t %s[]%s = {\n\t", name, attribute);
+	for (size_t i = 0; i < size; i++)
+	{
+		if (i && !(i % ASSET_PACK_ELEMENTS_PER_ROW)) fprintf(file, "\n\t");
+		fprintf(file, (i < size - 1) ? "0x%02X, " : "0x%02X", data[i]);
+	}
+	fprintf(file, "};\n");
+}
+
+
+// The header in the exporter style: the IDs of the assets and the pack data
+// (split into the far memory chunks on AVR, see the Mega2560 examples)
+static void writeHeader(const char * path, const std::string & name, const std::string & platform, const std::vector<uint8_t> & pack, uint32_t chunkSize)
+{
+	FILE * file = fopen(path, "w");
+	if (file == NULL) fail("can't create %s", path);
+
+	std::string prefix = upper(name);
+	fprintf(file, "// Asset pack of %u assets:", (unsigned)assets.size());
+	for (size_t i = 0; i < assets.size(); i++)
+	{
+		const char * source = strrchr(assets[i].source.c_str(), '/');
+		if (!i || (assets[i].source != assets[i - 1].source)) fprintf(file, " %s", source ? source + 1 : assets[i].source.c_str());
+	}
+	fprintf(file, "\n\n// Includes\n#include \"Decompression.h\"\n#include \"DecompressionPack.h\"\n\n");
+
+	if (platform == "avr-far") fprintf(file, "// We will place data chunks in the far area of Flash memory\n#define PROGMEM_FAR  __attribute__((section(\".fini7\")))\n\n");
+
+	fprintf(file, "// %s definitions\n", prefix.c_str());
+	fprintf(file, "#define %s_COUNT\t\t%u\n", prefix.c_str(), (unsigned)assets.size());
+	fprintf(file, "#define %s_SIZE\t\t%u\n", prefix.c_str(), (unsigned)pack.size());
+	if (platform == "avr-far") fprintf(file, "#define %s_CHUNKS\t\t%u\n", prefix.c_str(), (unsigned)((pack.size() + chunkSize - 1) / chunkSize));
+	fprintf(file, "\n// Asset IDs (DecompressionPack::getAsset())\n");
+	for (size_t i = 0; i < assets.size(); i++) fprintf(file, "#define %s_%s_ID\t\t%u\n", prefix.c_str(), upper(assets[i].name).c_str(), (unsigned)i);
+	fprintf(file, "\n// End of %s definitions\n\n", prefix.c_str());
+
+	if (platform == "avr-far")
+	{
+		for (size_t offset = 0, chunk = 1; offset < pack.size(); offset += chunkSize, chunk++)
+		{
+			char array[256];
+			snprintf(array, sizeof(array), "%sPack%u", name.c_str(), (unsigned)chunk);
+			size_t size = pack.size() - offset;
+			writeArray(file, array, " PROGMEM_FAR", &pack[offset], (size > chunkSize) ? chunkSize : size);
+			if (offset + chunkSize < pack.size()) fprintf(file, "\n");
+		}
+	}
+	else writeArray(file, (name + "Pack").c_str(), (platform == "avr") ? " PROGMEM" : "", &pack[0], pack.size());
+
+	fprintf(file, "\n// END-OF-FILE\n");
+	fclose(file);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Usage: assetpack [--output pack.bin] [--header pack.h] [--name pack] [--platform avr|avr-far|esp32|stm32|all]
+//		[--chunk-size bytes] [--align bytes] [--seek-interval frames] [--tiles] [--verify] header.h ...
+int main(int argc, char ** argv)
+{
+	const char * output = option(argc, argv, "output");
+	const char * header = option(argc, argv, "header");
+	std::string name = option(argc, argv, "name") ? option(argc, argv, "name") : "pack";
+	std::string platform = option(argc, argv, "platform") ? option(argc, argv, "platform") : "all";
+	uint32_t chunkSize = option(argc, argv, "chunk-size") ? strtoul(option(argc, argv, "chunk-size"), NULL, 0) : ((platform == "avr-far") ? 16384 : 0);
+	uint32_t alignment = option(argc, argv, "align") ? strtoul(option(argc, argv, "align"), NULL, 0) : 4;
+	uint32_t seekInterval = option(argc, argv, "seek-interval") ? strtoul(option(argc, argv, "seek-interval"), NULL, 0) : 0;
+
+	if ((alignment < 4) || (alignment & (alignment - 1))) fail("the alignment must be a power of 2 (4 or more)%s", "");
+	if ((chunkSize > 32768) || (chunkSize % alignment)) fail("the chunk size must be a multiple of the alignment up to 32768%s", "");
+	if ((platform == "avr-far") && !chunkSize) fail("the far memory pack needs the chunk size%s", "");
+
+	for (int i = 1; i < argc; i++)
+	{
+		if ((argv[i][0] == '-') && (argv[i][1] == '-'))
+		{
+			if (strcmp(argv[i], "--verify") && strcmp(argv[i], "--tiles")) i++;
+			continue;
+		}
+		parseHeader(argv[i]);
+	}
+	if (assets.empty()) fail("no data arrays found%s", "");
+	if (assets.size() > 65535) fail("more than 65535 %s", "assets");
+
+	for (size_t i = 0; i < assets.size(); i++)
+	{
+		AssetPackSourceContext & context = contexts[assets[i].context];
+		if (!context.framesCount) fail("%s: no number of frames", context.prefix.c_str());
+	}
+
+	// Every context of the squares once (the first asset of the context)
+	for (size_t i = 0; flag(argc, argv, "tiles") && (i < assets.size()); i++)
+	{
+		const uint8_t * record = contexts[assets[i].context].record;
+		size_t first = 0;
+		while (memcmp(contexts[assets[first].context].record, record, DECOMPRESSION_PACK_CONTEXT_SIZE)) first++;
+		if ((first == i) && record[12] && (record[13] > 1)) buildTiles(record, seekInterval);
+	}
+
+	for (size_t i = 0; i < assets.size(); i++)
+	{
+		AssetPackAsset & asset = assets[i];
+		AssetPackSourceContext & context = contexts[asset.context];
+		if (!seekInterval || !asset.seekIndex.empty() || !asset.tileReferences.empty()) continue;
+
+		AssetPackContext dc;
+		sourceContext(context, &dc);
+		switch (context.record[11])
+		{
+		case DECOMPRESSION_OPTION_FIXED_WINDOW_ONLY: buildSeekIndex<DECOMPRESSION_OPTION_FIXED_WINDOW_ONLY>(asset, &dc, context.framesCount, seekInterval); break;
+		case DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_ONLY: buildSeekIndex<DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_ONLY>(asset, &dc, context.framesCount, seekInterval); break;
+		case DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST: buildSeekIndex<DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST>(asset, &dc, context.framesCount, seekInterval); break;
+		default: buildSeekIndex<DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_FIRST>(asset, &dc, context.framesCount, seekInterval); break;
+		}
+	}
+
+	std::vector<uint8_t> pack = buildPack(alignment, chunkSize);
+
+	if (output)
+	{
+		FILE * file = fopen(output, "wb");
+		if ((file == NULL) || (fwrite(&pack[0], 1, pack.size(), file) != pack.size())) fail("can't write %s", output);
+		fclose(file);
+	}
+	if (header) writeHeader(header, name, platform, pack, chunkSize);
+
+	for (size_t i = 0; i < assets.size(); i++)
+	{
+		printf("%u\t%s\t%u bytes at %u, %u frames, %u seek points, %u tile references, context %u\n", (unsigned)i, assets[i].name.c_str(), (unsigned)assets[i].data.size(),
+			assets[i].offset, contexts[assets[i].context].framesCount, (unsigned)assets[i].seekIndex.size(), (unsigned)assets[i].tileReferences.size(), assets[i].packContext);
+	}
+	printf("%u assets, %u contexts, %u bytes\n", (unsigned)assets.size(), pack[5], (unsigned)pack.size());
+
+	if (!flag(argc, argv, "verify")) return (0);
+
+	// The pack as the firmware sees it: the written file mapped into memory (or the blob)
+	const uint8_t * packData = &pack[0];
+	int file = output ? open(output, O_RDONLY) : -1;
+	if (file >= 0)
+	{
+		void * mapped = mmap(NULL, pack.size(), PROT_READ, MAP_PRIVATE, file, 0);
+		if (mapped == MAP_FAILED) fail("can't map %s", output);
+		packData = (const uint8_t *)mapped;
+	}
+
+	uint32_t failures = 0;
+	for (size_t i = 0; i < assets.size(); i++)
+	{
+		bool verified;
+		switch (contexts[assets[i].context].record[11])
+		{
+		case DECOMPRESSION_OPTION_FIXED_WINDOW_ONLY: verified = verifyAsset<DECOMPRESSION_OPTION_FIXED_WINDOW_ONLY>(packData, i); break;
+		case DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_ONLY: verified = verifyAsset<DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_ONLY>(packData, i); break;
+		case DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST: verified = verifyAsset<DECOMPRESSION_OPTION_FIXED_WINDOW_FIRST>(packData, i); break;
+		default: verified = verifyAsset<DECOMPRESSION_OPTION_ADAPTIVE_FLOATING_WINDOW_FIRST>(packData, i); break;
+		}
+		if (!verified) fprintf(stderr, "assetpack: %s doesn't match the source data\n", assets[i].name.c_str());
+		failures += !verified;
+	}
+	printf("verified: %u of %u assets match\n", (unsigned)(assets.size() - failures), (unsigned)assets.size());
+
+	if (file >= 0) close(file);
+	return (failures ? 1 : 0);
+}
+
+// END-OF-FILE
@@ -0,0 +1,529 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Command line compressor: an image (PPM/PGM, PNG if built with libpng) or a raw
+// data file is compressed by the host port of the compressor (DeltaEncoder) and
+// exported the way the application does it: the header (the same text, line endings
+// included, as the XML/XSLT export of Header_Source.xml) and/or the binary data.
+// The channels are taken from the decoded pixels as the application takes them
+// (ColorComponentChannel/GrayscaleMixerChannel/FileDataChannel), so the data
+// is byte-identical to the one the application exports with the same parameters.
+
+// Includes
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <vector>
+#include "DeltaEncoder.h"
+#if defined(DELTA_COMP_PNG)
+#include <png.h>
+#endif
+
+// CodeExport.cs constants
+#define DELTA_COMP_ELEMENTS_PER_ROW		100
+#define DELTA_COMP_AVR_CHUNK_SIZE		16384
+#define DELTA_COMP_DATA_PADDING		3	// Zero bytes after the data (DECOMPRESSION_DATA_PADDING)
+
+#define DELTA_COMP_MAX_SQUARE_SIDE		16
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Decoded source: the samples of every pixel (frame) one after another
+struct DeltaCompSource
+{
+	uint32_t width;
+	uint32_t height;
+	uint32_t framesCount;
+	uint8_t samplesCount;
+	uint8_t bitsPerSample;
+	bool color;			// R, G, B (and alpha) samples, otherwise grayscale or raw data
+	bool alpha;
+	std::vector<uint32_t> samples;
+};
+
+static const char * deltaOptionNames[4] = { "FixedWindowOnly", "AdaptiveFloatingWindowOnly", "FixedWindowFirst", "AdaptiveFloatingWindowFirst" };
+
+// Grayscale conversion coefficients of GrayscaleMixerChannel (declared as float there)
+static const double grayscaleCoefficients[3] = { 0.2126f, 0.7152f, 0.0722f };
+
+
+static void fail(const char * format, const char * argument)
+{
+	fprintf(stderr, "deltacomp: ");
+	fprintf(stderr, format, argument);
+	fprintf(stderr, "\n");
+	exit(1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Value of the option "--name value" or NULL
+static const char * option(int argc, char ** argv, const char * name)
+{
+	for (int i = 1; i < argc - 1; i++)
+	{
+		if ((argv[i][0] == '-') && (argv[i][1] == '-') && !strcmp(argv[i] + 2, name)) return (argv[i + 1]);
+	}
+	return (NULL);
+}
+
+
+static bool flag(int argc, char ** argv, const char * name)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		if ((argv[i][0] == '-') && (argv[i][1] == '-') && !strcmp(argv[i] + 2, name)) return (true);
+	}
+	return (false);
+}
+
+
+static std::string translate(const std::string & text, bool toUpper)
+{
+	std::string result = text;
+	for (size_t i = 0; i < result.size(); i++)
+	{
+		if (toUpper && (result[i] >= 'a') && (result[i] <= 'z')) result[i] -= 'a' - 'A';
+		if (!toUpper && (result[i] >= 'A') && (result[i] <= 'Z')) result[i] += 'a' - 'A';
+	}
+	return (result);
+}
+
+
+// File name without the directories (and without the extension on request)
+static std::string fileName(const char * path, bool withExtension)
+{
+	const char * name = strrchr(path, '/');
+	std::string result = name ? name + 1 : path;
+	size_t dot = result.rfind('.');
+	if (!withExtension && (dot != std::string::npos) && dot) result.erase(dot);
+	return (result);
+}
+
+
+static std::vector<uint8_t> readFile(const char * path)
+{
+	FILE * file = fopen(path, "rb");
+	if (file == NULL) fail("can't open %s", path);
+
+	std::vector<uint8_t> data;
+	uint8_t buffer[65536];
+	size_t size;
+	while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0) data.insert(data.end(), buffer, buffer + size);
+	fclose(file);
+	return (data);
+}
+
+
+// Bit depth of the maximum sample value (1, 3, 7... only)
+static uint8_t bitsForMaxValue(uint32_t maxValue)
+{
+	uint8_t bits = 0;
+	while ((bits < 16) && (((uint32_t)1 << bits) - 1 < maxValue)) bits++;
+	return ((((uint32_t)1 << bits) - 1 == maxValue) ? bits : 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Number of the PPM/PGM header skipping the whitespaces and the comments
+static uint32_t pnmNumber(const std::vector<uint8_t> & data, size_t & position)
+{
+	while (position < data.size())
+	{
+		if (data[position] == '#')
+		{
+			while ((position < data.size()) && (data[position] != '\n')) position++;
+		}
+		else if (strchr(" \t\r\n", data[position])) position++;
+		else break;
+	}
+
+	uint32_t value = 0;
+	size_t start = position;
+	while ((position < data.size()) && (data[position] >= '0') && (data[position] <= '9')) value = value * 10 + (data[position++] - '0');
+	if (position == start) fail("%s", "wrong PPM/PGM header");
+	return (value);
+}
+
+
+// Binary PPM (P6) or PGM (P5) with up to 16 bits per sample (big-endian words)
+static void loadPNM(const char * path, DeltaCompSource & source)
+{
+	std::vector<uint8_t> data = readFile(path);
+	if ((data.size() < 2) || (data[0] != 'P') || ((data[1] != '5') && (data[1] != '6'))) fail("%s is not a binary PPM/PGM", path);
+
+	size_t position = 2;
+	source.color = (data[1] == '6');
+	source.alpha = false;
+	source.samplesCount = source.color ? 3 : 1;
+	source.width = pnmNumber(data, position);
+	source.height = pnmNumber(data, position);
+	uint32_t maxValue = pnmNumber(data, position);
+	position++;
+
+	source.bitsPerSample = bitsForMaxValue(maxValue);
+	if (!source.bitsPerSample) fail("%s: the maximum value must be 2^n - 1", path);
+
+	uint8_t bytesPerSample = (maxValue > 255) ? 2 : 1;
+	source.framesCount = source.width * source.height;
+	size_t samplesCount = (size_t)source.framesCount * source.samplesCount;
+	if (data.size() < position + samplesCount * bytesPerSample) fail("%s is truncated", path);
+
+	source.samples.resize(samplesCount);
+	for (size_t i = 0; i < samplesCount; i++, position += bytesPerSample)
+	{
+		source.samples[i] = (bytesPerSample == 2) ? (((uint32_t)data[position] << 8) | data[position + 1]) : data[position];
+	}
+}
+
+
+#if defined(DELTA_COMP_PNG)
+// PNG decoded into the formats WPF gives: grayscale of its own depth (1...16 bits),
+// RGB or RGBA of 8 or 16 bits, the palette images as RGB
+static void loadPNG(const char * path, DeltaCompSource & source)
+{
+	FILE * file = fopen(path, "rb");
+	if (file == NULL) fail("can't open %s", path);
+
+	png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+	png_infop info = png_create_info_struct(png);
+	if ((png == NULL) || (info == NULL) || setjmp(png_jmpbuf(png))) fail("can't decode %s", path);
+
+	png_init_io(png, file);
+	png_read_info(png, info);
+
+	uint8_t colorType = png_get_color_type(png, info);
+	uint8_t bitDepth = png_get_bit_depth(png, info);
+	if (colorType == PNG_COLOR_TYPE_PALETTE)
+	{
+		png_set_palette_to_rgb(png);
+		bitDepth = 8;
+	}
+	if (colorType == PNG_COLOR_TYPE_GRAY_ALPHA) png_set_gray_to_rgb(png);
+	if (bitDepth < 8) png_set_packing(png);
+	png_read_update_info(png, info);
+
+	source.width = png_get_image_width(png, info);
+	source.height = png_get_image_height(png, info);
+	source.framesCount = source.width * source.height;
+	source.samplesCount = png_get_channels(png, info);
+	source.bitsPerSample = bitDepth;
+	source.color = (source.samplesCount >= 3);
+	source.alpha = (source.samplesCount == 4);
+
+	size_t rowBytes = png_get_rowbytes(png, info);
+	std::vector<uint8_t> pixels(rowBytes * source.height);
+	std::vector<png_bytep> rows(source.height);
+	for (uint32_t y = 0; y < source.height; y++) rows[y] = &pixels[y * rowBytes];
+	png_read_image(png, &rows[0]);
+	png_destroy_read_struct(&png, &info, NULL);
+	fclose(file);
+
+	source.samples.resize((size_t)source.framesCount * source.samplesCount);
+	for (uint32_t y = 0; y < source.height; y++)
+	{
+		for (size_t i = 0; i < (size_t)source.width * source.samplesCount; i++)
+		{
+			source.samples[y * source.width * source.samplesCount + i] = (bitDepth == 16) ? (((uint32_t)rows[y][i * 2] << 8) | rows[y][i * 2 + 1]) : rows[y][i];
+		}
+	}
+}
+#endif
+
+
+// Raw data file (FileDataSource): the frames of the channels of 1-4 bytes
+static void loadRaw(const char * path, const char * format, bool littleEndian, DeltaCompSource & source)
+{
+	unsigned channels = 0, bytes = 0;
+	if ((sscanf(format, "%u,%u", &channels, &bytes) != 2) || !channels || (channels > DELTA_ENCODER_MAX_CHANNELS) || !bytes || (bytes > 4))
+	{
+		fail("wrong raw format %s (channels,bytes per channel)", format);
+	}
+
+	std::vector<uint8_t> data = readFile(path);
+	source.color = false;
+	source.alpha = false;
+	source.samplesCount = channels;
+	source.bitsPerSample = bytes * 8;
+	source.framesCount = data.size() / (channels * bytes);
+	source.width = 0;
+	source.height = 0;
+
+	source.samples.resize((size_t)source.framesCount * channels);
+	for (size_t i = 0; i < source.samples.size(); i++)
+	{
+		uint32_t value = 0;
+		for (uint8_t b = 0; b < bytes; b++) value = (value << 8) | data[i * bytes + (littleEndian ? (bytes - 1 - b) : b)];
+		source.samples[i] = value;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Value scaled to another bit depth (Channel.GetTargetValueForFrame(), Math.Round() rounds half to even)
+static uint32_t scaleValue(uint32_t value, uint8_t bits, uint8_t targetBits)
+{
+	if (bits == targetBits) return (value);
+	return ((uint32_t)rint((double)value / (double)(((uint64_t)1 << bits) - 1) * (double)(((uint64_t)1 << targetBits) - 1)));
+}
+
+
+// Channels of the frames in the order of the stream. The channel letters: r, g, b, a
+// of the color image, l - grayscale (the mixer of the color channels or the gray image),
+// the raw data channels are taken as they are.
+static void buildChannels(const DeltaCompSource & source, const std::string & channels, const uint8_t * targetBits, uint8_t squareSide, std::vector<uint32_t> * result)
+{
+	uint8_t grayscaleBits = (source.bitsPerSample > 8) ? 16 : 8;
+	std::vector<uint32_t> order;
+	if (squareSide > 1) order = DeltaEncoder::squaresOrder(source.width, source.height, squareSide);
+
+	for (uint8_t c = 0; c < channels.size(); c++)
+	{
+		int sample = -1;
+		uint8_t bits = source.bitsPerSample;
+		if (source.color && strchr("rgb", channels[c])) sample = strchr("rgb", channels[c]) - "rgb";
+		else if (source.alpha && (channels[c] == 'a')) sample = 3;
+		else if (!source.color && (source.samplesCount == 1) && (channels[c] == 'l')) sample = 0;
+		else if (!source.color && (channels[c] >= '1') && (channels[c] < '1' + source.samplesCount)) sample = channels[c] - '1';
+		else if (source.color && (channels[c] == 'l')) bits = grayscaleBits;
+		else fail("the source has no channel %s", channels.substr(c, 1).c_str());
+
+		result[c].resize(source.framesCount);
+		for (uint32_t frame = 0; frame < source.framesCount; frame++)
+		{
+			uint32_t pixel = order.empty() ? frame : order[frame];
+			const uint32_t * samples = &source.samples[(size_t)pixel * source.samplesCount];
+			uint32_t value;
+
+			if (sample >= 0) value = samples[sample];
+			else
+			{
+				double maxValue = (double)(((uint32_t)1 << source.bitsPerSample) - 1);
+				double mixed = 0;
+				for (uint8_t i = 0; i < 3; i++) mixed += grayscaleCoefficients[i] * ((double)samples[i] / maxValue);
+				value = (uint32_t)rint(mixed * (double)(((uint32_t)1 << grayscaleBits) - 1));
+			}
+
+			result[c][frame] = scaleValue(value, bits, targetBits[c]);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// The header as the application writes it: the XSLT part with LF, the data array
+// and the seek index by the StreamWriter of Windows with CRLF
+static void writeHeader(const char * path, const std::string & sourceName, const std::string & baseName, const std::string & platform,
+	const DeltaEncoder & encoder, uint32_t framesCount, uint32_t width, uint32_t height, uint8_t squareSide,
+	const std::vector<uint8_t> & data, const std::vector<DeltaEncoderSeekPoint> & seekIndex)
+{
+	FILE * file = fopen(path, "wb");
+	if (file == NULL) fail("can't create %s", path);
+
+	std::string prefix = translate(baseName, true);
+	const char * p = prefix.c_str();
+	std::string bitsPerChannel, bitsPerMethodDeclaration;
+	for (uint8_t c = 0; c < encoder.channelsCount; c++)
+	{
+		char value[8];
+		snprintf(value, sizeof(value), c ? ", %u" : "%u", encoder.bitsPerChannel[c]);
+		bitsPerChannel += value;
+		snprintf(value, sizeof(value), c ? ", %u" : "%u", encoder.bitsPerMethodDeclaration[c]);
+		bitsPerMethodDeclaration += value;
+	}
+	uint8_t deltaOption = encoder.getDeltaOption();
+
+	fprintf(file, "// %s\n\n// Includes\n#include \"Decompression.h\"\n\n", sourceName.c_str());
+	fprintf(file, "// %s definitions (you can get rid of this section if all other packaged data have the same parameters)\n", p);
+	fprintf(file, "#define %s_NUMBER_OF_FRAMES\t\t%u\n", p, framesCount);
+	fprintf(file, "#define %s_NUMBER_OF_CHANNELS\t\t%u\n", p, encoder.channelsCount);
+	fprintf(file, "#define %s_BITS_PER_CHANNELS\t\t{ %s }\n", p, bitsPerChannel.c_str());
+	fprintf(file, "#define %s_BLOCK_SIZE_BITS\t\t%u\n", p, encoder.getBlockSizeBits());
+	fprintf(file, "#define %s_BITS_PER_METHOD_DECLARATION\t\t{ %s }\n", p, bitsPerMethodDeclaration.c_str());
+	fprintf(file, "#define %s_BITS_PER_FRAME\t\t%u\n", p, encoder.bitsPerFrame);
+	fprintf(file, "#define %s_DELTA_OPTION\t\t%u\t// %s\n", p, deltaOption, deltaOptionNames[deltaOption & 3]);
+	fprintf(file, "#define %s_IMAGE_WIDTH\t\t%u\n", p, width);
+	fprintf(file, "#define %s_IMAGE_HEIGHT\t\t%u\n", p, height);
+	fprintf(file, "#define %s_SPLIT_TO_SQUARES\t\t%u\n", p, (squareSide > 1) ? 1 : 0);
+	fprintf(file, "#define %s_SQUARE_SIDE\t\t%u\n", p, (squareSide > 1) ? squareSide : 1);
+	fprintf(file, "#define %s_SQUARES_PER_WIDTH\t\t%s_IMAGE_WIDTH / %s_SQUARE_SIDE\n", p, p, p);
+	fprintf(file, "#define %s_SQUARES_PER_WIDTH_SIZE\t\t%s_IMAGE_WIDTH * %s_SQUARE_SIDE\n\n", p, p, p);
+
+	fprintf(file, "// A set of constants defining the initial conditions for decompression\n");
+	fprintf(file, "static const DecompressionContext %sDC = {\n", translate(baseName, false).c_str());
+	fprintf(file, "\t\t%s_NUMBER_OF_CHANNELS,\n\t\t%s_BITS_PER_CHANNELS,\n\t\t%s_BLOCK_SIZE_BITS,\n\t\t%s_BITS_PER_METHOD_DECLARATION,\n\t\t%s_BITS_PER_FRAME,\n", p, p, p, p, p);
+	fprintf(file, "#if defined(DECOMPRESSION_USE_SQUARES)\n");
+	fprintf(file, "\t\t%s_SPLIT_TO_SQUARES,\n\t\t%s_IMAGE_WIDTH,\n\t\t%s_SQUARE_SIDE,\n\t\t%s_SQUARES_PER_WIDTH,\n\t\t%s_SQUARES_PER_WIDTH_SIZE\n", p, p, p, p, p);
+	fprintf(file, "#endif\n};\n\n// End of %s definitions\n\n", p);
+
+	// AppendArrayElement(): the rows of 100 elements, the chunk size warnings on AVR
+	// and the padding of the last word read of the decoder (FinalizeExport())
+	fprintf(file, "static const uint8_t %sData[]%s = {\r\n\t", translate(baseName, false).c_str(), (platform == "avr") ? " PROGMEM" : "");
+	for (size_t i = 0, column = 0, chunkIndex = 0; i < data.size() + DELTA_COMP_DATA_PADDING; i++)
+	{
+		if (i) fprintf(file, ", ");
+		if ((platform == "avr") && (chunkIndex >= DELTA_COMP_AVR_CHUNK_SIZE))
+		{
+			fprintf(file, "\r\n// Limit of %u bytes reached.\r\n\t", DELTA_COMP_AVR_CHUNK_SIZE);
+			chunkIndex = 0;
+			column = 0;
+		}
+		if (column >= DELTA_COMP_ELEMENTS_PER_ROW)
+		{
+			fprintf(file, "\r\n\t");
+			column = 0;
+		}
+		fprintf(file, "0x%02X", (i < data.size()) ? data[i] : 0);
+		column++;
+		chunkIndex++;
+	}
+	fprintf(file, "};\r\n");
+
+	if (!seekIndex.empty())
+	{
+		fprintf(file, "\r\n// Seek index: the first frame of a block and the bit offset of its header\r\n");
+		fprintf(file, "#define %s_SEEK_POINTS\t\t%u\r\n", p, (unsigned)seekIndex.size());
+		fprintf(file, "static const DecompressionSeekPoint %sSeekIndex[%s_SEEK_POINTS]%s = {\r\n", translate(baseName, false).c_str(), p, (platform == "avr") ? " PROGMEM" : "");
+		for (size_t i = 0; i < seekIndex.size(); i++)
+		{
+			fprintf(file, "\t{%u, %u}%s\r\n", seekIndex[i].frame, seekIndex[i].bitOffset, (i < seekIndex.size() - 1) ? "," : "");
+		}
+		fprintf(file, "};\r\n");
+	}
+
+	fprintf(file, "\r\n// END-OF-FILE\r\n");
+	if (fclose(file)) fail("can't write %s", path);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Usage: deltacomp [--header name.h] [--output data.bin] [--platform avr|esp32|stm32|all] [--name name]
+//		[--channels rgb] [--bits 5,6,5] [--squares side] [--block-size-bits 8] [--delta-option 0-3]
+//		[--brute-force | --optimal] [--seek-index-step frames] [--threads count] [--raw channels,bytes [--little-endian]] source
+int main(int argc, char ** argv)
+{
+	const char * header = option(argc, argv, "header");
+	const char * output = option(argc, argv, "output");
+	const char * raw = option(argc, argv, "raw");
+	std::string platform = option(argc, argv, "platform") ? option(argc, argv, "platform") : "all";
+	uint8_t squareSide = option(argc, argv, "squares") ? atoi(option(argc, argv, "squares")) : 0;
+
+	// The last argument which is not an option value
+	const char * path = NULL;
+	for (int i = 1; i < argc; i++)
+	{
+		if ((argv[i][0] == '-') && (argv[i][1] == '-'))
+		{
+			if (strcmp(argv[i], "--brute-force") && strcmp(argv[i], "--optimal") && strcmp(argv[i], "--little-endian")) i++;
+			continue;
+		}
+		path = argv[i];
+	}
+	if (path == NULL) fail("no source file%s", "");
+	if ((header == NULL) && (output == NULL)) fail("nothing to write (--header or --output)%s", "");
+	if ((platform != "avr") && (platform != "esp32") && (platform != "stm32") && (platform != "all")) fail("unknown platform %s", platform.c_str());
+
+	// The image format by its signature
+	DeltaCompSource source;
+	uint8_t signature[4] = { 0, 0, 0, 0 };
+	FILE * file = fopen(path, "rb");
+	if (file == NULL) fail("can't open %s", path);
+	if (fread(signature, 1, sizeof(signature), file)) {}
+	fclose(file);
+
+	if (raw) loadRaw(path, raw, flag(argc, argv, "little-endian"), source);
+	else if ((signature[0] == 'P') && ((signature[1] == '5') || (signature[1] == '6'))) loadPNM(path, source);
+#if defined(DELTA_COMP_PNG)
+	else if (!memcmp(signature, "\x89PNG", 4)) loadPNG(path, source);
+#endif
+	else fail("unsupported source %s (PPM/PGM, PNG if built with libpng or --raw)", path);
+	if (!source.framesCount) fail("%s has no frames", path);
+
+	// The channels of the application by default: R, G, B or the grayscale one
+	std::string channels = option(argc, argv, "channels") ? option(argc, argv, "channels") : (source.color ? "rgb" : "l");
+	if (raw && !option(argc, argv, "channels"))
+	{
+		channels.clear();
+		for (uint8_t c = 0; c < source.samplesCount; c++) channels += (char)('1' + c);
+	}
+	if (channels.empty() || (channels.size() > DELTA_ENCODER_MAX_CHANNELS)) fail("wrong channels %s", channels.c_str());
+
+	// Target bit depths: one for all the channels or a list
+	uint8_t targetBits[DELTA_ENCODER_MAX_CHANNELS];
+	const char * bits = option(argc, argv, "bits");
+	for (uint8_t c = 0; c < channels.size(); c++)
+	{
+		uint8_t sourceBits = ((channels[c] == 'l') && source.color) ? ((source.bitsPerSample > 8) ? 16 : 8) : source.bitsPerSample;
+		targetBits[c] = bits ? atoi(bits) : sourceBits;
+		if (bits && strchr(bits, ',')) bits = strchr(bits, ',') + 1;
+		if (!targetBits[c] || (targetBits[c] > sourceBits)) fail("wrong bit depth of the channel %s", channels.substr(c, 1).c_str());
+	}
+
+	if (squareSide > 1)
+	{
+		if (raw || (squareSide > DELTA_COMP_MAX_SQUARE_SIDE) || (source.width % squareSide) || (source.height % squareSide))
+		{
+			fail("the squares must be 2...16 pixels dividing the image width and height%s", "");
+		}
+	}
+
+	DeltaEncoder encoder(targetBits, channels.size());
+	if (option(argc, argv, "block-size-bits")) encoder.setBlockSizeBits(atoi(option(argc, argv, "block-size-bits")));
+	encoder.setDeltaOption(option(argc, argv, "delta-option") ? atoi(option(argc, argv, "delta-option")) : DELTA_ENCODER_FIXED_WINDOW_FIRST);
+	encoder.useBruteForceBestBlockSearch = flag(argc, argv, "brute-force");
+	encoder.useOptimalBlockPartition = flag(argc, argv, "optimal");
+	encoder.seekIndexStep = option(argc, argv, "seek-index-step") ? strtoul(option(argc, argv, "seek-index-step"), NULL, 0) : 0;
+	encoder.threadsCount = option(argc, argv, "threads") ? strtoul(option(argc, argv, "threads"), NULL, 0) : 0;
+	if ((encoder.getBlockSizeBits() < 1) || (encoder.getBlockSizeBits() > 24) || (encoder.getDeltaOption() > 3)) fail("wrong compression parameters%s", "");
+
+	std::vector<uint32_t> frames[DELTA_ENCODER_MAX_CHANNELS];
+	buildChannels(source, channels, targetBits, squareSide, frames);
+
+	std::vector<uint8_t> data;
+	std::vector<DeltaEncoderSeekPoint> seekIndex;
+	encoder.compress(frames, source.framesCount, data, &seekIndex);
+
+	if (output)
+	{
+		FILE * file = fopen(output, "wb");
+		if ((file == NULL) || (fwrite(&data[0], 1, data.size(), file) != data.size())) fail("can't write %s", output);
+		fclose(file);
+	}
+	if (header)
+	{
+		std::string name = option(argc, argv, "name") ? option(argc, argv, "name") : fileName(header, false);
+		writeHeader(header, fileName(path, true), name, platform, encoder, source.framesCount, source.width, source.height, squareSide, data, seekIndex);
+	}
+
+	printf("%s: %u frames, %u channels, %u bits per frame, %u bytes, %u seek points\n", fileName(path, true).c_str(), source.framesCount,
+		encoder.channelsCount, encoder.bitsPerFrame, (unsigned)data.size(), (unsigned)seekIndex.size());
+	return (0);
+}
+
+// END-OF-FILE
@@ -0,0 +1,936 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+// Please refer to Compressor.cs for the description of the algorithms:
+// every method here is the port of the method of the same name.
+
+// Includes
+#include <float.h>
+#include <string.h>
+#include <thread>
+#include <algorithm>
+#include "DeltaEncoder.h"
+
+
+DeltaEncoder::DeltaEncoder(const uint8_t * bitsPerChannel, uint8_t channelsCount)
+{
+	this->channelsCount = channelsCount;
+	bitsPerFrame = 0;
+	for (uint8_t c = 0; c < channelsCount; c++)
+	{
+		this->bitsPerChannel[c] = bitsPerChannel[c];
+		bitsPerFrame += bitsPerChannel[c];
+	}
+
+	useBruteForceBestBlockSearch = true;
+	useOptimalBlockPartition = false;
+	seekIndexStep = 0;
+	threadsCount = 0;
+	deltaOption = DELTA_ENCODER_FIXED_WINDOW_FIRST;
+	setBlockSizeBits(DELTA_ENCODER_DEFAULT_BLOCK_SIZE_BITS);
+}
+
+
+void DeltaEncoder::setBlockSizeBits(uint8_t bits)
+{
+	blockSizeBits = bits;
+	maxBlockSize = (uint32_t)1 << blockSizeBits;
+	calculateHeaderBits();
+}
+
+
+void DeltaEncoder::setDeltaOption(uint8_t option)
+{
+	deltaOption = option;
+	calculateHeaderBits();
+}
+
+
+void DeltaEncoder::compress(const std::vector<uint32_t> * channels, uint32_t framesCount, std::vector<uint8_t> & data, std::vector<DeltaEncoderSeekPoint> * seekIndex)
+{
+	sourceChannels = channels;
+	totalFrames = framesCount;
+	output = &data;
+	bitsBuffer = 0;
+	bitsBufferCount = 0;
+	compressedBitsCount = 0;
+
+	buildMaxBlockLengths();
+	if (!useOptimalBlockPartition) fillBestBlocks();
+	std::vector<Block> mainBlockChain = useOptimalBlockPartition ? buildOptimalBlocks() : smartBuildBlocks(0, totalFrames);
+	std::vector<Block>().swap(bestBlocks);
+	for (uint8_t c = 0; c < channelsCount; c++)
+	{
+		fixedWindowLengths[c].clear();
+		fixedWindowInitialValues[c].clear();
+		floatingWindowLengths[c].clear();
+	}
+
+	// Seek points are placed at the beginning of the first block
+	// starting at or after every seekIndexStep frames
+	if (seekIndex) seekIndex->clear();
+	uint32_t nextSeekFrame = 0;
+
+	for (size_t i = 0; i < mainBlockChain.size(); i++)
+	{
+		if (seekIndex && (seekIndexStep > 0) && (mainBlockChain[i].startFrame >= nextSeekFrame))
+		{
+			DeltaEncoderSeekPoint point = { mainBlockChain[i].startFrame, compressedBitsCount };
+			seekIndex->push_back(point);
+			nextSeekFrame = mainBlockChain[i].startFrame + seekIndexStep;
+		}
+
+		compressBlock(mainBlockChain[i]);
+	}
+
+	finalizeCompressedData();
+}
+
+
+// The best blocks for the whole data (FillBestBlocksArray()): each position
+// is independent, so they are searched by all the threads at once
+void DeltaEncoder::fillBestBlocks()
+{
+	uint32_t threads = threadsCount ? threadsCount : std::thread::hardware_concurrency();
+	if ((threads <= 1) || (totalFrames < DELTA_ENCODER_FRAMES_PER_TASK)) return;
+
+	bestBlocks.resize(totalFrames);
+	nextBestBlock = 0;
+
+	std::vector<std::thread> pool;
+	for (uint32_t i = 1; i < threads; i++) pool.push_back(std::thread(&DeltaEncoder::fillBestBlocksThread, this));
+	fillBestBlocksThread();
+	for (size_t i = 0; i < pool.size(); i++) pool[i].join();
+}
+
+
+// Take the frames by tasks until the end of the data
+void DeltaEncoder::fillBestBlocksThread()
+{
+	while (true)
+	{
+		uint32_t position = nextBestBlock.fetch_add(DELTA_ENCODER_FRAMES_PER_TASK);
+		if (position >= totalFrames) break;
+
+		uint32_t end = ((totalFrames - position) > DELTA_ENCODER_FRAMES_PER_TASK) ? (position + DELTA_ENCODER_FRAMES_PER_TASK) : totalFrames;
+		for (; position < end; position++) bestBlocks[position] = getBestBlock(position, totalFrames);
+	}
+}
+
+
+// Frame number to pixel within the square (GetPixelForSquares())
+std::vector<uint32_t> DeltaEncoder::squaresOrder(uint16_t imageWidth, uint16_t imageHeight, uint8_t squareSide)
+{
+	uint16_t squaresPerImageWidth = imageWidth / squareSide;
+	uint16_t squareSize = (uint16_t)squareSide * squareSide;
+	std::vector<uint32_t> order((uint32_t)imageWidth * imageHeight);
+
+	for (uint32_t frame = 0; frame < order.size(); frame++)
+	{
+		uint32_t currentSquareNumber = frame / squareSize;
+		uint16_t squaresLine = currentSquareNumber / squaresPerImageWidth;
+		uint32_t firstPixel = (uint32_t)squaresLine * squareSize * squaresPerImageWidth + (currentSquareNumber % squaresPerImageWidth) * squareSide;
+		uint16_t internalOffset = frame % squareSize;
+
+		uint8_t row = internalOffset / squareSide;
+		uint8_t column = internalOffset - row * squareSide;
+		order[frame] = firstPixel + (uint32_t)row * imageWidth + column;
+	}
+	return (order);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Calculate the size of the header fields in bits
+void DeltaEncoder::calculateHeaderBits()
+{
+	headerBits = blockSizeBits;
+	for (uint8_t c = 0; c < channelsCount; c++)
+	{
+		bitsPerMethodDeclaration[c] = 0;
+		uint8_t currentChannelMethodsCount = getMethodsCount(c) - 1;
+		do
+		{
+			bitsPerMethodDeclaration[c]++;
+		}
+		while ((currentChannelMethodsCount >>= 1) > 0);
+
+		headerBits += bitsPerMethodDeclaration[c];
+	}
+}
+
+
+uint8_t DeltaEncoder::getMethodsCount(uint8_t channel)
+{
+	if ((deltaOption == DELTA_ENCODER_FIXED_WINDOW_FIRST) || (deltaOption == DELTA_ENCODER_ADAPTIVE_FLOATING_WINDOW_FIRST)) return (bitsPerChannel[channel] * 2);
+	return (bitsPerChannel[channel] + 1);
+}
+
+
+// The real method (window width) and the delta option
+uint8_t DeltaEncoder::getRealMethod(uint8_t method, uint8_t bitDepth, bool & afw)
+{
+	afw = false;
+
+	if (method > bitDepth)
+	{
+		method -= bitDepth;
+		if (deltaOption == DELTA_ENCODER_FIXED_WINDOW_FIRST) afw = true;
+	}
+	else if ((method > 0) && (method < bitDepth))
+	{
+		if ((deltaOption == DELTA_ENCODER_ADAPTIVE_FLOATING_WINDOW_ONLY) || (deltaOption == DELTA_ENCODER_ADAPTIVE_FLOATING_WINDOW_FIRST)) afw = true;
+	}
+	return (method);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Build blocks for a frames range using serial efficiency analysis
+std::vector<DeltaEncoder::Block> DeltaEncoder::smartBuildBlocks(uint32_t startFrame, uint32_t boundary)
+{
+	std::vector<Block> mainBlockChain;
+	std::vector<Block> alterBlockChain;
+
+	double alterBlockChainEfficiency = -DBL_MAX;
+	uint32_t currentPosition = startFrame;
+	Block mainBlock;
+	memset(&mainBlock, 0, sizeof(mainBlock));
+	mainBlock.efficiency = -DBL_MAX;
+	Block alterBlock = mainBlock;
+	bool lastBlockFinished = true;
+	bool alterBlockFound = false;
+
+	while (currentPosition < boundary)
+	{
+		// The blocks prepared earlier (if any) up to the end of the data
+		Block currentBlock = ((boundary == totalFrames) && !bestBlocks.empty()) ? bestBlocks[currentPosition] : getBestBlock(currentPosition, boundary);
+
+		if (lastBlockFinished)
+		{
+			mainBlock = currentBlock;
+			alterBlockChainEfficiency = currentBlock.efficiency;
+			currentPosition++;
+			lastBlockFinished = false;
+		}
+		else if (mainBlock.efficiency < currentBlock.efficiency)
+		{
+			alterBlockChain.clear();
+
+			Block mainBlockHead = mainBlock;
+			mainBlockHead.length = currentPosition - mainBlock.startFrame;
+			alterBlockChain.push_back(mainBlockHead);
+			alterBlockChain.push_back(currentBlock);
+
+			if ((mainBlock.startFrame + mainBlock.length) > (currentBlock.startFrame + currentBlock.length))
+			{
+				Block mainBlockTail = mainBlock;
+				mainBlockTail.startFrame = currentBlock.startFrame + currentBlock.length;
+				mainBlockTail.length = mainBlock.startFrame + mainBlock.length - mainBlockTail.startFrame;
+				alterBlockChain.push_back(mainBlockTail);
+			}
+
+			double currentBlockChainEfficiency = getChainEfficiency(alterBlockChain);
+
+			if (currentBlockChainEfficiency > alterBlockChainEfficiency)
+			{
+				alterBlockChainEfficiency = currentBlockChainEfficiency;
+				alterBlock = alterBlockChain[0];
+				alterBlockFound = true;
+			}
+		}
+
+		currentPosition++;
+
+		if (currentPosition >= mainBlock.startFrame + mainBlock.length)
+		{
+			if (alterBlockFound)
+			{
+				currentPosition = alterBlock.startFrame + alterBlock.length;
+				std::vector<Block> alterChain = smartBuildBlocks(alterBlock.startFrame, currentPosition);
+				mainBlockChain.insert(mainBlockChain.end(), alterChain.begin(), alterChain.end());
+			}
+			else
+			{
+				mainBlockChain.push_back(mainBlock);
+			}
+
+			alterBlockFound = false;
+			lastBlockFinished = true;
+		}
+	}
+
+	return (mainBlockChain);
+}
+
+
+// The chain of blocks with the minimum total number of bits (BuildOptimalBlocks()):
+// the shortest path over the frame positions, the lengths are checked one by one
+// up to the longest compressed method, the longer uncompressed blocks come from
+// the minimum of the sliding window of the previous positions
+std::vector<DeltaEncoder::Block> DeltaEncoder::buildOptimalBlocks()
+{
+	std::vector<uint64_t> bits(totalFrames + 1, UINT64_MAX);
+	std::vector<uint32_t> previous(totalFrames + 1, 0);
+	std::vector<uint32_t> rawQueue(totalFrames + 1);
+	uint32_t rawHead = 0, rawTail = 0;
+	uint8_t fixedWidths[DELTA_ENCODER_MAX_CHANNELS];
+	uint8_t floatingWidths[DELTA_ENCODER_MAX_CHANNELS];
+
+	bits[0] = 0;
+	for (uint32_t position = 0; position <= totalFrames; position++)
+	{
+		// Uncompressed blocks ending here
+		if (position > 0)
+		{
+			uint32_t last = position - 1;
+			while ((rawHead < rawTail) && (getRawPathBits(bits, rawQueue[rawTail - 1]) >= getRawPathBits(bits, last))) rawTail--;
+			rawQueue[rawTail++] = last;
+			if ((position - rawQueue[rawHead]) > maxBlockSize) rawHead++;
+
+			uint64_t rawBits = (uint64_t)(getRawPathBits(bits, rawQueue[rawHead]) + headerBits + (int64_t)bitsPerFrame * position);
+			if (rawBits < bits[position])
+			{
+				bits[position] = rawBits;
+				previous[position] = rawQueue[rawHead];
+			}
+		}
+
+		if (position == totalFrames) break;
+
+		// The longest compressed method at this position limits the lengths to check
+		uint32_t limit = ((totalFrames - position) > maxBlockSize) ? maxBlockSize : (totalFrames - position);
+		uint32_t bound = 0;
+		for (uint8_t c = 0; c < channelsCount; c++)
+		{
+			fixedWidths[c] = 0;
+			floatingWidths[c] = 0;
+			for (uint8_t w = 0; w < bitsPerChannel[c]; w++)
+			{
+				if (!fixedWindowLengths[c][w].empty() && (fixedWindowLengths[c][w][position] > bound)) bound = fixedWindowLengths[c][w][position];
+				if (!floatingWindowLengths[c][w].empty() && (floatingWindowLengths[c][w][position] > bound)) bound = floatingWindowLengths[c][w][position];
+			}
+		}
+		if (bound > limit) bound = limit;
+
+		for (uint32_t length = 1; length <= bound; length++)
+		{
+			uint64_t blockBits = headerBits;
+			for (uint8_t c = 0; c < channelsCount; c++)
+			{
+				// The narrowest applicable window is the cheapest one
+				fixedWidths[c] = getApplicableWidth(fixedWindowLengths[c], fixedWidths[c], position, length);
+				floatingWidths[c] = getApplicableWidth(floatingWindowLengths[c], floatingWidths[c], position, length);
+				blockBits += getOptimalChannelBits(c, length, fixedWidths[c], floatingWidths[c]);
+			}
+
+			if ((bits[position] + blockBits) < bits[position + length])
+			{
+				bits[position + length] = bits[position] + blockBits;
+				previous[position + length] = position;
+			}
+		}
+	}
+
+	// Collect the blocks from the end of the path
+	std::vector<Block> mainBlockChain;
+	for (uint32_t end = totalFrames; end > 0; end = previous[end])
+	{
+		Block block;
+		block.startFrame = previous[end];
+		block.length = end - block.startFrame;
+
+		for (uint8_t c = 0; c < channelsCount; c++)
+		{
+			uint8_t bitDepth = bitsPerChannel[c];
+			uint8_t fixedWidth = getApplicableWidth(fixedWindowLengths[c], 0, block.startFrame, block.length);
+			uint8_t floatingWidth = getApplicableWidth(floatingWindowLengths[c], 0, block.startFrame, block.length);
+			uint64_t channelBits = (uint64_t)block.length * bitDepth;
+			block.methods[c] = bitDepth;
+			block.initialValues[c] = 0;
+
+			if ((fixedWidth < bitDepth) && ((bitDepth + (uint64_t)block.length * fixedWidth) < channelBits))
+			{
+				channelBits = bitDepth + (uint64_t)block.length * fixedWidth;
+				block.methods[c] = getMethodIndex(c, fixedWidth, false);
+				block.initialValues[c] = fixedWindowInitialValues[c][fixedWidth][block.startFrame];
+			}
+
+			if ((floatingWidth < bitDepth) && ((bitDepth + (uint64_t)(block.length - 1) * floatingWidth) < channelBits))
+			{
+				block.methods[c] = getMethodIndex(c, floatingWidth, true);
+				block.initialValues[c] = getFrameForChannel(block.startFrame, c);
+			}
+		}
+
+		block.efficiency = getBlockEfficiency(block.length, block.methods);
+		mainBlockChain.push_back(block);
+	}
+
+	std::reverse(mainBlockChain.begin(), mainBlockChain.end());
+	return (mainBlockChain);
+}
+
+
+// The narrowest window (starting from the specified one) with the block length
+// not less than the specified one, or the bit depth of the channel if there is none
+uint8_t DeltaEncoder::getApplicableWidth(const std::vector<std::vector<uint32_t> > & lengths, uint8_t width, uint32_t position, uint32_t length)
+{
+	while ((width < lengths.size()) && (lengths[width].empty() || (lengths[width][position] < length))) width++;
+	return (width);
+}
+
+
+// The bits of the cheapest method of the channel for the block length
+uint64_t DeltaEncoder::getOptimalChannelBits(uint8_t channel, uint32_t length, uint8_t fixedWidth, uint8_t floatingWidth)
+{
+	uint8_t bitDepth = bitsPerChannel[channel];
+	uint64_t channelBits = (uint64_t)length * bitDepth;
+	if ((fixedWidth < bitDepth) && ((bitDepth + (uint64_t)length * fixedWidth) < channelBits)) channelBits = bitDepth + (uint64_t)length * fixedWidth;
+	if ((floatingWidth < bitDepth) && ((bitDepth + (uint64_t)(length - 1) * floatingWidth) < channelBits)) channelBits = bitDepth + (uint64_t)(length - 1) * floatingWidth;
+	return (channelBits);
+}
+
+
+// The method index of the window width and type for the delta option used
+uint8_t DeltaEncoder::getMethodIndex(uint8_t channel, uint8_t width, bool afw)
+{
+	for (uint8_t m = 0; m < getMethodsCount(channel); m++)
+	{
+		bool methodAfw = false;
+		if ((getRealMethod(m, bitsPerChannel[channel], methodAfw) == width) && (methodAfw == afw)) return (m);
+	}
+	return (bitsPerChannel[channel]);
+}
+
+
+DeltaEncoder::Block DeltaEncoder::getBestBlock(uint32_t position, uint32_t boundary)
+{
+	if (useBruteForceBestBlockSearch) return (getBestBlockBruteForce(position, boundary));
+	return (getBestBlockFast(position, boundary));
+}
+
+
+// The best method of every channel and the methods of the same length for the others
+DeltaEncoder::Block DeltaEncoder::getBestBlockFast(uint32_t position, uint32_t boundary)
+{
+	Block bestBlock;
+	memset(&bestBlock, 0, sizeof(bestBlock));
+	bestBlock.startFrame = position;
+	bestBlock.efficiency = -DBL_MAX;
+
+	uint8_t bestMethods[DELTA_ENCODER_MAX_CHANNELS];
+	uint32_t bestInitialValues[DELTA_ENCODER_MAX_CHANNELS];
+	uint32_t bestLengths[DELTA_ENCODER_MAX_CHANNELS];
+
+	for (uint8_t c = 0; c < channelsCount; c++)
+	{
+		Method bestMethod = getBestMethod(position, c, boundary, false);
+		bestMethods[c] = bestMethod.index;
+		bestInitialValues[c] = bestMethod.initialValue;
+		bestLengths[c] = bestMethod.length;
+	}
+
+	for (uint8_t c = 0; c < channelsCount; c++)
+	{
+		uint32_t currentLength = bestLengths[c];
+
+		uint8_t currentMethods[DELTA_ENCODER_MAX_CHANNELS];
+		uint32_t currentInitialValues[DELTA_ENCODER_MAX_CHANNELS];
+
+		currentMethods[c] = bestMethods[c];
+		currentInitialValues[c] = bestInitialValues[c];
+
+		for (uint8_t cc = 0; cc < channelsCount; cc++)
+		{
+			if (cc == c) continue;
+
+			if (bestLengths[cc] != currentLength)
+			{
+				Method currentMethod = getBestMethod(position, cc, position + currentLength, true);
+				currentMethods[cc] = currentMethod.index;
+				currentInitialValues[cc] = currentMethod.initialValue;
+			}
+			else
+			{
+				currentMethods[cc] = bestMethods[cc];
+				currentInitialValues[cc] = bestInitialValues[cc];
+			}
+		}
+
+		double efficiency = getBlockEfficiency(currentLength, currentMethods);
+
+		if (efficiency > bestBlock.efficiency)
+		{
+			memcpy(bestBlock.methods, currentMethods, channelsCount);
+			memcpy(bestBlock.initialValues, currentInitialValues, channelsCount * sizeof(uint32_t));
+			bestBlock.length = currentLength;
+			bestBlock.efficiency = efficiency;
+		}
+	}
+
+	return (bestBlock);
+}
+
+
+// All the combinations of the methods of all channels
+DeltaEncoder::Block DeltaEncoder::getBestBlockBruteForce(uint32_t position, uint32_t boundary)
+{
+	Block bestBlock;
+	memset(&bestBlock, 0, sizeof(bestBlock));
+	Method currentMethods[DELTA_ENCODER_MAX_CHANNELS];
+	bestBlock.startFrame = position;
+	bestBlock.efficiency = -DBL_MAX;
+
+	std::vector<Method> allMethods[DELTA_ENCODER_MAX_CHANNELS];
+	for (uint8_t c = 0; c < channelsCount; c++)
+	{
+		uint8_t methodsCount = getMethodsCount(c);
+		allMethods[c].resize(methodsCount);
+
+		for (uint8_t m = 0; m < methodsCount; m++)
+		{
+			bool afw;
+			uint8_t realMethod = getRealMethod(m, bitsPerChannel[c], afw);
+			Method & method = allMethods[c][m];
+			method.initialValue = 0;
+
+			if (realMethod != bitsPerChannel[c])
+			{
+				if (afw) method.length = getMaxBlockLength3(position, realMethod, c, method.initialValue);
+				else method.length = getMaxBlockLength(position, realMethod, c, method.initialValue);
+			}
+			else
+			{
+				method.length = maxBlockSize;
+			}
+
+			method.index = m;
+		}
+	}
+
+	// The lowest bits per frame of the channels after each one (their methods at the longest lengths)
+	double minBitsPerFrame[DELTA_ENCODER_MAX_CHANNELS + 1];
+	minBitsPerFrame[channelsCount] = 0;
+	for (int c = channelsCount - 1; c >= 0; c--)
+	{
+		double channelMinBits = DBL_MAX;
+		for (uint8_t m = 0; m < allMethods[c].size(); m++)
+		{
+			uint32_t length = (allMethods[c][m].length < (boundary - position)) ? allMethods[c][m].length : (boundary - position);
+			double bits = (double)getCompressedBitsForMethod(length, m, bitsPerChannel[c]) / length;
+			if (bits < channelMinBits) channelMinBits = bits;
+		}
+		minBitsPerFrame[c] = minBitsPerFrame[c + 1] + channelMinBits;
+	}
+
+	// The block of the fast search is one of the combinations (or a shorter one),
+	// so the combinations which can't reach its efficiency are skipped from the start
+	double minEfficiency = getBestBlockFast(position, boundary).efficiency - DELTA_ENCODER_EFFICIENCY_BOUND_MARGIN;
+
+	uint8_t methods[DELTA_ENCODER_MAX_CHANNELS];
+	searchBestBlockRecursive(position, boundary, 0, currentMethods, allMethods, bestBlock, methods, minBitsPerFrame, minEfficiency);
+	return (bestBlock);
+}
+
+
+void DeltaEncoder::searchBestBlockRecursive(uint32_t position, uint32_t boundary, uint8_t currentChannel, Method * currentMethods, std::vector<Method> * allMethods, Block & bestBlock, uint8_t * methods, const double * minBitsPerFrame, double minEfficiency)
+{
+	for (uint8_t m = 0; m < getMethodsCount(currentChannel); m++)
+	{
+		currentMethods[currentChannel] = allMethods[currentChannel][m];
+		methods[currentChannel] = m;
+
+		// The length of the block is the shortest one of its methods
+		uint32_t minLength = boundary - position;
+		for (uint8_t c = 0; c <= currentChannel; c++)
+		{
+			if (minLength > currentMethods[c].length) minLength = currentMethods[c].length;
+		}
+
+		uint8_t nextChannel = currentChannel + 1;
+		if (nextChannel < channelsCount)
+		{
+			// The next channels can only shorten the block, so the combinations which can't be better
+			// than the best one found even with their best methods are skipped
+			uint64_t bits = headerBits;
+			for (uint8_t c = 0; c <= currentChannel; c++) bits += getCompressedBitsForMethod(minLength, methods[c], bitsPerChannel[c]);
+			double maxEfficiency = 1.0 - ((double)bits / minLength + minBitsPerFrame[nextChannel]) / bitsPerFrame;
+			if ((maxEfficiency < minEfficiency) || (maxEfficiency < (bestBlock.efficiency - DELTA_ENCODER_EFFICIENCY_BOUND_MARGIN))) continue;
+
+			searchBestBlockRecursive(position, boundary, nextChannel, currentMethods, allMethods, bestBlock, methods, minBitsPerFrame, minEfficiency);
+		}
+		else
+		{
+			double efficiency = getBlockEfficiency(minLength, methods);
+
+			if (efficiency > bestBlock.efficiency)
+			{
+				memcpy(bestBlock.methods, methods, channelsCount);
+				for (uint8_t c = 0; c < channelsCount; c++) bestBlock.initialValues[c] = currentMethods[c].initialValue;
+				bestBlock.length = minLength;
+				bestBlock.efficiency = efficiency;
+			}
+		}
+	}
+}
+
+
+DeltaEncoder::Method DeltaEncoder::getBestMethod(uint32_t position, uint8_t channel, uint32_t boundary, bool fill)
+{
+	Method bestMethod = { 0, 0, 0 };
+	double bestEfficiency = -DBL_MAX;
+
+	for (uint8_t m = 0; m < getMethodsCount(channel); m++)
+	{
+		uint32_t initialValue = 0;
+		uint32_t length;
+
+		bool afw;
+		uint8_t realMethod = getRealMethod(m, bitsPerChannel[channel], afw);
+
+		// The method can't be better than the one found earlier
+		double maxTheoreticalEfficiency = 1.0 - ((double)m / (double)bitsPerChannel[channel]);
+		if (maxTheoreticalEfficiency < bestEfficiency) continue;
+
+		if (realMethod != bitsPerChannel[channel])
+		{
+			if (afw) length = getMaxBlockLength3(position, realMethod, channel, initialValue);
+			else length = getMaxBlockLength(position, realMethod, channel, initialValue);
+		}
+		else
+		{
+			length = maxBlockSize;
+		}
+
+		uint32_t endOfBlock = position + length;
+		if (fill && (endOfBlock < boundary)) continue;
+		if (endOfBlock > boundary) length = boundary - position;
+
+		double efficiency = getMethodEfficiency(length, m, channel);
+
+		if (efficiency > bestEfficiency)
+		{
+			bestEfficiency = efficiency;
+			bestMethod.index = m;
+			bestMethod.initialValue = initialValue;
+			bestMethod.length = length;
+		}
+	}
+
+	return (bestMethod);
+}
+
+
+// Maximum fixed window block length
+uint32_t DeltaEncoder::getMaxBlockLength(uint32_t position, uint8_t method, uint8_t channel, uint32_t & initialValue)
+{
+	initialValue = fixedWindowInitialValues[channel][method][position];
+	return (fixedWindowLengths[channel][method][position]);
+}
+
+
+// Maximum adaptive floating window block length
+uint32_t DeltaEncoder::getMaxBlockLength3(uint32_t position, uint8_t method, uint8_t channel, uint32_t & initialValue)
+{
+	initialValue = getFrameForChannel(position, channel);
+	return (floatingWindowLengths[channel][method][position]);
+}
+
+
+// The maximum block lengths of the methods used for every frame (BuildMaxBlockLengths()):
+// the neighboring positions share almost the whole window, so a single pass per method is enough
+void DeltaEncoder::buildMaxBlockLengths()
+{
+	if (!totalFrames) return;
+	std::vector<uint32_t> minQueue(totalFrames), maxQueue(totalFrames);
+
+	for (uint8_t c = 0; c < channelsCount; c++)
+	{
+		fixedWindowLengths[c].assign(bitsPerChannel[c], std::vector<uint32_t>());
+		fixedWindowInitialValues[c].assign(bitsPerChannel[c], std::vector<uint32_t>());
+		floatingWindowLengths[c].assign(bitsPerChannel[c], std::vector<uint32_t>());
+
+		for (uint8_t m = 0; m < getMethodsCount(c); m++)
+		{
+			bool afw = false;
+			uint8_t realMethod = getRealMethod(m, bitsPerChannel[c], afw);
+			if (realMethod == bitsPerChannel[c]) continue;
+
+			if (afw)
+			{
+				if (!floatingWindowLengths[c][realMethod].empty()) continue;
+				floatingWindowLengths[c][realMethod].resize(totalFrames);
+				fillFloatingWindowLengths(realMethod, c, &floatingWindowLengths[c][realMethod][0]);
+			}
+			else
+			{
+				if (!fixedWindowLengths[c][realMethod].empty()) continue;
+				fixedWindowLengths[c][realMethod].resize(totalFrames);
+				fixedWindowInitialValues[c][realMethod].resize(totalFrames);
+				fillFixedWindowLengths(realMethod, c, &fixedWindowLengths[c][realMethod][0], &fixedWindowInitialValues[c][realMethod][0], &minQueue[0], &maxQueue[0]);
+			}
+		}
+	}
+}
+
+
+// Fixed window: the window [position, end) only moves forward, so the minimum and maximum
+// of its frames are kept in the monotonic queues of the frame numbers
+void DeltaEncoder::fillFixedWindowLengths(uint8_t method, uint8_t channel, uint32_t * lengths, uint32_t * initialValues, uint32_t * minQueue, uint32_t * maxQueue)
+{
+	const uint32_t * frames = &sourceChannels[channel][0];
+	uint32_t maxDelta = (uint32_t)(((uint64_t)1 << method) - 1);
+	uint32_t minHead = 0, minTail = 0, maxHead = 0, maxTail = 0;
+	uint32_t end = 0;
+
+	for (uint32_t position = 0; position < totalFrames; position++)
+	{
+		// The previous frame leaves the window
+		if ((minHead < minTail) && (minQueue[minHead] < position)) minHead++;
+		if ((maxHead < maxTail) && (maxQueue[maxHead] < position)) maxHead++;
+
+		uint32_t limit = ((totalFrames - position) > maxBlockSize) ? (position + maxBlockSize) : totalFrames;
+		while (end < limit)
+		{
+			uint32_t currentFrame = frames[end];
+			uint32_t min = ((minHead < minTail) && (frames[minQueue[minHead]] < currentFrame)) ? frames[minQueue[minHead]] : currentFrame;
+			uint32_t max = ((maxHead < maxTail) && (frames[maxQueue[maxHead]] > currentFrame)) ? frames[maxQueue[maxHead]] : currentFrame;
+			if ((max - min) > maxDelta) break;
+
+			while ((minHead < minTail) && (frames[minQueue[minTail - 1]] >= currentFrame)) minTail--;
+			minQueue[minTail++] = end;
+			while ((maxHead < maxTail) && (frames[maxQueue[maxTail - 1]] <= currentFrame)) maxTail--;
+			maxQueue[maxTail++] = end;
+			end++;
+		}
+
+		lengths[position] = end - position;
+		initialValues[position] = frames[minQueue[minHead]];
+	}
+}
+
+
+// Adaptive floating window: the window depends only on the previous frame, so the block
+// of the position continues with the block of the next one if that frame fits the window
+void DeltaEncoder::fillFloatingWindowLengths(uint8_t method, uint8_t channel, uint32_t * lengths)
+{
+	const uint32_t * frames = &sourceChannels[channel][0];
+	uint32_t windowWidth = (uint32_t)1 << method;
+	uint32_t halfWindowWidth = windowWidth >> 1;
+	uint32_t frameWidth = (uint32_t)((uint64_t)1 << bitsPerChannel[channel]);
+	uint32_t maxFrameStart = frameWidth - windowWidth;
+
+	lengths[totalFrames - 1] = 1;
+	for (uint32_t position = totalFrames - 1; position-- > 0;)
+	{
+		uint32_t lastFrame = frames[position];
+		uint32_t windowStart;
+		if (halfWindowWidth < lastFrame)
+		{
+			windowStart = lastFrame - halfWindowWidth;
+			if (windowStart > maxFrameStart) windowStart = maxFrameStart;
+		}
+		else
+		{
+			windowStart = 0;
+		}
+
+		uint32_t currentFrame = frames[position + 1];
+		if ((currentFrame < windowStart) || ((currentFrame - windowStart) >= windowWidth)) lengths[position] = 1;
+		else lengths[position] = (lengths[position + 1] < maxBlockSize) ? (lengths[position + 1] + 1) : maxBlockSize;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t DeltaEncoder::getCompressedBitsForMethod(uint32_t length, uint8_t method, uint8_t bitDepth)
+{
+	uint64_t methodBits = 0;
+
+	if (method != bitDepth) methodBits += bitDepth;
+
+	bool afw;
+	uint8_t realMethod = getRealMethod(method, bitDepth, afw);
+
+	if (afw) length--;
+	methodBits += (uint32_t)(length * realMethod);
+
+	return (methodBits);
+}
+
+
+uint64_t DeltaEncoder::getBitsPerBlock(uint32_t length, const uint8_t * methods)
+{
+	uint64_t bitsPerBlock = headerBits;
+
+	for (uint8_t c = 0; c < channelsCount; c++)
+	{
+		bitsPerBlock += getCompressedBitsForMethod(length, methods[c], bitsPerChannel[c]);
+	}
+
+	return (bitsPerBlock);
+}
+
+
+// Method efficiency (1 - method bits / raw bits)
+double DeltaEncoder::getMethodEfficiency(uint32_t length, uint8_t method, uint8_t channel)
+{
+	uint8_t bitDepth = bitsPerChannel[channel];
+	double bitsPerMethod = (double)blockSizeBits / channelsCount + (double)bitsPerMethodDeclaration[channel];
+	bitsPerMethod += (double)getCompressedBitsForMethod(length, method, bitDepth);
+
+	return (1.0 - bitsPerMethod / ((double)length * (double)bitDepth));
+}
+
+
+// Block efficiency (1 - block bits / raw bits)
+double DeltaEncoder::getBlockEfficiency(uint32_t length, const uint8_t * methods)
+{
+	return (1.0 - (double)getBitsPerBlock(length, methods) / ((double)length * (double)bitsPerFrame));
+}
+
+
+double DeltaEncoder::getChainEfficiency(const std::vector<Block> & chain)
+{
+	uint32_t length = 0;
+	uint64_t bits = 0;
+	for (size_t i = 0; i < chain.size(); i++)
+	{
+		length += chain[i].length;
+		bits += getBitsPerBlock(chain[i].length, chain[i].methods);
+	}
+
+	return (1.0 - (double)bits / ((double)length * (double)bitsPerFrame));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Compress one block into the bitstream
+void DeltaEncoder::compressBlock(const Block & block)
+{
+	uint32_t position = block.startFrame;
+
+	uint8_t methods[DELTA_ENCODER_MAX_CHANNELS];
+	uint64_t windows[DELTA_ENCODER_MAX_CHANNELS];
+	uint32_t halfWindows[DELTA_ENCODER_MAX_CHANNELS];
+	uint32_t lastValues[DELTA_ENCODER_MAX_CHANNELS];
+	uint64_t ranges[DELTA_ENCODER_MAX_CHANNELS];
+	bool useInitialValue[DELTA_ENCODER_MAX_CHANNELS];
+
+	for (uint8_t c = 0; c < channelsCount; c++)
+	{
+		windows[c] = 0; // The adaptive floating window flag
+		ranges[c] = (uint32_t)((uint64_t)1 << bitsPerChannel[c]);
+		useInitialValue[c] = true;
+	}
+
+	// Block length (decreased by 1)
+	addBitsToCompressedData(block.length - 1, blockSizeBits);
+
+	// The method of every channel is followed by its initial value
+	// (SEQUENTIAL_METHODS_AND_INITIAL_VALUES_DECLARATION of the compressor)
+	for (uint8_t c = 0; c < channelsCount; c++)
+	{
+		methods[c] = block.methods[c];
+		addBitsToCompressedData(methods[c], bitsPerMethodDeclaration[c]);
+		if (methods[c] == bitsPerChannel[c]) continue;
+
+		addBitsToCompressedData(block.initialValues[c], bitsPerChannel[c]);
+
+		bool afw;
+		methods[c] = getRealMethod(methods[c], bitsPerChannel[c], afw);
+
+		if (afw)
+		{
+			windows[c] = (uint64_t)1 << methods[c];
+			halfWindows[c] = (uint32_t)(windows[c] >> 1);
+			lastValues[c] = block.initialValues[c];
+			useInitialValue[c] = true;
+		}
+	}
+
+	for (uint32_t length = 0; length < block.length; length++, position++)
+	{
+		for (uint8_t c = 0; c < channelsCount; c++)
+		{
+			if (methods[c] == 0) continue;
+
+			uint32_t currentFrame = getFrameForChannel(position, c);
+
+			if (methods[c] == bitsPerChannel[c])
+			{
+				// No compression
+				addBitsToCompressedData(currentFrame, methods[c]);
+			}
+			else if (windows[c] > 0)
+			{
+				// The first frame is the initial value
+				if (useInitialValue[c])
+				{
+					useInitialValue[c] = false;
+				}
+				else
+				{
+					uint32_t windowStart = (halfWindows[c] < lastValues[c]) ? (lastValues[c] - halfWindows[c]) : 0;
+					if ((windowStart + windows[c]) > ranges[c]) windowStart = (uint32_t)(ranges[c] - windows[c]);
+
+					lastValues[c] = currentFrame;
+					addBitsToCompressedData(currentFrame - windowStart, methods[c]);
+				}
+			}
+			else
+			{
+				addBitsToCompressedData(currentFrame - block.initialValues[c], methods[c]);
+			}
+		}
+	}
+}
+
+
+// Write the bits MSB first
+void DeltaEncoder::addBitsToCompressedData(uint64_t bits, uint8_t count)
+{
+	bitsBuffer <<= count;
+	bitsBuffer |= bits;
+	bitsBufferCount += count;
+	compressedBitsCount += count;
+
+	while (bitsBufferCount >= 8)
+	{
+		output->push_back((uint8_t)((bitsBuffer >> (bitsBufferCount -= 8)) & 0xFF));
+	}
+}
+
+
+// The remaining bits as the last data byte
+void DeltaEncoder::finalizeCompressedData()
+{
+	if (bitsBufferCount > 0) output->push_back((uint8_t)((bitsBuffer << (8 - bitsBufferCount)) & 0xFF));
+	bitsBufferCount = 0;
+}
+
+// END-OF-FILE
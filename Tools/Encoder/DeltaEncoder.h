@@ -0,0 +1,187 @@
+/*
+
+MIT License
+
+Copyright (c) 2024 Dmitry Muravyev (youtube.com/@DmitryMuravyev)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+
+The host port of the compressor (Compressor.cs) for the tools: the same blocks,
+methods and efficiency calculations, so the data is byte-identical to the one
+the application exports with the same parameters.
+
+The frames are given by the channel values in the order of the stream, i.e. the caller
+has already reordered the pixels of the image split into squares (see squaresOrder()).
+
+*/
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include <stdint.h>
+#include <vector>
+#include <atomic>
+
+#ifndef _DELTA_ENCODER_
+#define _DELTA_ENCODER_
+
+// Delta options (the same values as the compressor exports)
+#define DELTA_ENCODER_FIXED_WINDOW_ONLY					0
+#define DELTA_ENCODER_ADAPTIVE_FLOATING_WINDOW_ONLY		1
+#define DELTA_ENCODER_FIXED_WINDOW_FIRST				2
+#define DELTA_ENCODER_ADAPTIVE_FLOATING_WINDOW_FIRST	3
+
+#define DELTA_ENCODER_MAX_CHANNELS			8
+#define DELTA_ENCODER_DEFAULT_BLOCK_SIZE_BITS	8
+// Frames a thread takes at once from the best blocks search
+#define DELTA_ENCODER_FRAMES_PER_TASK		256
+// Margin of the efficiency bound of the brute force search for the rounding
+#define DELTA_ENCODER_EFFICIENCY_BOUND_MARGIN	1e-9
+
+// Seek index entry: the first frame of a block and the offset of its header in bits
+struct DeltaEncoderSeekPoint
+{
+	uint32_t frame;
+	uint32_t bitOffset;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////
+
+class DeltaEncoder {
+
+public:
+
+	// Channels of the frame (their target bit depths, the first one is the most significant)
+	DeltaEncoder(const uint8_t * bitsPerChannel, uint8_t channelsCount);
+
+	// Compression parameters (the defaults are the ones of the application)
+	void setBlockSizeBits(uint8_t bits);
+	void setDeltaOption(uint8_t option);
+	uint8_t getBlockSizeBits() const { return (blockSizeBits); }
+	uint8_t getDeltaOption() const { return (deltaOption); }
+
+	bool useBruteForceBestBlockSearch;
+	bool useOptimalBlockPartition; // The minimum total bits instead of the block search
+	uint32_t seekIndexStep; // 0 - don't build the seek index
+	uint32_t threadsCount; // Threads of the best blocks search: 0 - all the cores, 1 - no threads
+
+	// Results of the parameters
+	uint8_t channelsCount;
+	uint8_t bitsPerFrame;
+	uint8_t bitsPerChannel[DELTA_ENCODER_MAX_CHANNELS];
+	uint8_t bitsPerMethodDeclaration[DELTA_ENCODER_MAX_CHANNELS];
+
+	// Compress the frames (channels[c][frame]) into the data, the seek index is built on request
+	void compress(const std::vector<uint32_t> * channels, uint32_t framesCount, std::vector<uint8_t> & data, std::vector<DeltaEncoderSeekPoint> * seekIndex = NULL);
+
+	// Order of the pixels in the stream of the image split into squares
+	static std::vector<uint32_t> squaresOrder(uint16_t imageWidth, uint16_t imageHeight, uint8_t squareSide);
+
+private:
+
+	// The single compression method of the channel
+	struct Method
+	{
+		uint32_t length;
+		uint8_t index;
+		uint32_t initialValue;
+	};
+
+	// Methods of all channels for the block
+	struct Block
+	{
+		uint32_t startFrame;
+		uint32_t length;
+		uint8_t methods[DELTA_ENCODER_MAX_CHANNELS];
+		uint32_t initialValues[DELTA_ENCODER_MAX_CHANNELS]; // 0 for uncompressed data
+		double efficiency;
+	};
+
+	uint8_t headerBits;
+	uint8_t blockSizeBits;
+	uint32_t maxBlockSize;
+	uint8_t deltaOption;
+
+	// Compression state
+	const std::vector<uint32_t> * sourceChannels;
+	uint32_t totalFrames;
+	std::vector<uint8_t> * output;
+	uint64_t bitsBuffer;
+	uint8_t bitsBufferCount;
+	uint32_t compressedBitsCount;
+
+	// The best block of every frame up to the end of the data (searched in parallel)
+	std::vector<Block> bestBlocks;
+	std::atomic<uint32_t> nextBestBlock;
+
+	// Maximum block lengths of the methods for every frame ([channel][real method][frame])
+	std::vector<std::vector<uint32_t> > fixedWindowLengths[DELTA_ENCODER_MAX_CHANNELS];
+	std::vector<std::vector<uint32_t> > fixedWindowInitialValues[DELTA_ENCODER_MAX_CHANNELS];
+	std::vector<std::vector<uint32_t> > floatingWindowLengths[DELTA_ENCODER_MAX_CHANNELS];
+
+	void calculateHeaderBits();
+	uint8_t getMethodsCount(uint8_t channel);
+	uint8_t getRealMethod(uint8_t method, uint8_t bitDepth, bool & afw);
+
+	void fillBestBlocks();
+	void fillBestBlocksThread();
+	std::vector<Block> smartBuildBlocks(uint32_t startFrame, uint32_t boundary);
+	std::vector<Block> buildOptimalBlocks();
+	uint8_t getApplicableWidth(const std::vector<std::vector<uint32_t> > & lengths, uint8_t width, uint32_t position, uint32_t length);
+	uint64_t getOptimalChannelBits(uint8_t channel, uint32_t length, uint8_t fixedWidth, uint8_t floatingWidth);
+	uint8_t getMethodIndex(uint8_t channel, uint8_t width, bool afw);
+	// Bits of the path to the position minus the bits of the frames before it
+	inline int64_t getRawPathBits(const std::vector<uint64_t> & bits, uint32_t position) { return ((int64_t)bits[position] - (int64_t)bitsPerFrame * position); }
+	Block getBestBlock(uint32_t position, uint32_t boundary);
+	Block getBestBlockFast(uint32_t position, uint32_t boundary);
+	Block getBestBlockBruteForce(uint32_t position, uint32_t boundary);
+	void searchBestBlockRecursive(uint32_t position, uint32_t boundary, uint8_t currentChannel, Method * currentMethods, std::vector<Method> * allMethods, Block & bestBlock, uint8_t * methods, const double * minBitsPerFrame, double minEfficiency);
+	Method getBestMethod(uint32_t position, uint8_t channel, uint32_t boundary, bool fill);
+	uint32_t getMaxBlockLength(uint32_t position, uint8_t method, uint8_t channel, uint32_t & initialValue);
+	uint32_t getMaxBlockLength3(uint32_t position, uint8_t method, uint8_t channel, uint32_t & initialValue);
+	void buildMaxBlockLengths();
+	void fillFixedWindowLengths(uint8_t method, uint8_t channel, uint32_t * lengths, uint32_t * initialValues, uint32_t * minQueue, uint32_t * maxQueue);
+	void fillFloatingWindowLengths(uint8_t method, uint8_t channel, uint32_t * lengths);
+
+	uint64_t getCompressedBitsForMethod(uint32_t length, uint8_t method, uint8_t bitDepth);
+	uint64_t getBitsPerBlock(uint32_t length, const uint8_t * methods);
+	double getMethodEfficiency(uint32_t length, uint8_t method, uint8_t channel);
+	double getBlockEfficiency(uint32_t length, const uint8_t * methods);
+	double getChainEfficiency(const std::vector<Block> & chain);
+
+	void compressBlock(const Block & block);
+	inline uint32_t getFrameForChannel(uint32_t frame, uint8_t channel) { return (sourceChannels[channel][frame]); }
+	void addBitsToCompressedData(uint64_t bits, uint8_t count);
+	void finalizeCompressedData();
+};
+
+
+#endif // end _DELTA_ENCODER_
+
+// END-OF-FILE